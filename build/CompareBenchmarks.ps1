@@ -0,0 +1,99 @@
+# This file is part of the FidelityFX SDK.
+#
+# Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+# Runs the sample in benchmark mode once per configuration and compares the
+# GPU time of one timestamp, by default the one of the FSR 2 upscaler.
+#
+# A configuration is a set of json globals which override FSR2_Sample.json on
+# the command line of the sample, "benchmark" is always set. A configuration
+# may also name its own sample executable, for comparing two builds. Run it
+# from the bin directory, so that the sample finds its config and media:
+#
+#   ..\build\CompareBenchmarks.ps1 -Sample .\FSR2_Sample_DX12.exe -Configurations ([ordered]@{
+#       "3x3 nearest depth" = '{ "fsr2MotionVectorDilationMode": 0 }'
+#       "none"              = '{ "fsr2MotionVectorDilationMode": 1 }'
+#   })
+
+param(
+    [Parameter(Mandatory = $true)] [string] $Sample,
+    [Parameter(Mandatory = $true)] [System.Collections.IDictionary] $Configurations,
+    [string] $Timestamp = "FSR 2.0 API",
+    [string] $Results = "Sponza.csv",
+    [int] $Runs = 1
+)
+
+$ErrorActionPreference = "Stop"
+
+function Read-Timings([string] $path, [string] $label)
+{
+    # The first line that names the timestamp is the header, every later line is one frame
+    $column = -1
+    $timings = @()
+    foreach ($line in Get-Content $path) {
+        $fields = $line.Split(",") | ForEach-Object { $_.Trim() }
+        if ($column -lt 0) {
+            $column = [array]::IndexOf($fields, $label)
+        } elseif ($fields.Count -gt $column -and $fields[$column] -ne "") {
+            $timings += [double]::Parse($fields[$column], [cultureinfo]::InvariantCulture)
+        }
+    }
+
+    if ($column -lt 0) {
+        throw "$path has no timestamp named '$label'"
+    }
+    return $timings
+}
+
+$rows = @()
+foreach ($name in $Configurations.Keys) {
+
+    $globals = $Configurations[$name] | ConvertFrom-Json
+    $executable = $Sample
+    if ($globals.PSObject.Properties.Name -contains "executable") {
+        $executable = $globals.executable
+        $globals.PSObject.Properties.Remove("executable")
+    }
+    $globals | Add-Member -NotePropertyName "benchmark" -NotePropertyValue $true -Force
+    $arguments = $globals | ConvertTo-Json -Compress
+
+    $timings = @()
+    for ($run = 0; $run -lt $Runs; ++$run) {
+        Remove-Item $Results -ErrorAction SilentlyContinue
+        Start-Process -FilePath $executable -ArgumentList $arguments -Wait
+        $timings += Read-Timings $Results $Timestamp
+        Copy-Item $Results ("{0}.{1}.csv" -f [IO.Path]::GetFileNameWithoutExtension($Results), ($name -replace "[^\w]+", "_"))
+    }
+
+    $sorted = $timings | Sort-Object
+    $rows += [pscustomobject]@{
+        Configuration = $name
+        Frames        = $timings.Count
+        "Mean (us)"   = [math]::Round(($timings | Measure-Object -Average).Average, 2)
+        "Median (us)" = [math]::Round($sorted[[int][math]::Floor($sorted.Count / 2)], 2)
+    }
+}
+
+# Relative to the first configuration, which is the baseline
+$baseline = $rows[0]."Median (us)"
+foreach ($row in $rows) {
+    $row | Add-Member -NotePropertyName "Relative" -NotePropertyValue ("{0:P1}" -f ($row."Median (us)" / $baseline - 1))
+}
+$rows | Format-Table -AutoSize
@@ -73,6 +73,10 @@ void FSR2Sample::OnParseCommandLine(LPSTR lpCmdLine, uint32_t* pWidth, uint32_t*
         m_VsyncEnabled = jData.value("vsync", m_VsyncEnabled);
         m_FreesyncHDROptionEnabled = jData.value("FreesyncHDROptionEnabled", m_FreesyncHDROptionEnabled);
         m_bIsBenchmarking = jData.value("benchmark", m_bIsBenchmarking);
+        m_UIState.nFsr2MotionVectorDilationMode = jData.value("fsr2MotionVectorDilationMode", m_UIState.nFsr2MotionVectorDilationMode);
+        m_UIState.bFsr2GroupsharedRcas = jData.value("fsr2GroupsharedRcas", m_UIState.bFsr2GroupsharedRcas);
+        m_UIState.bFsr2RcasTimestamp = jData.value("fsr2RcasTimestamp", m_UIState.bFsr2RcasTimestamp);
+        m_UIState.nParticleEmitterCount = jData.value("particleEmitterCount", m_UIState.nParticleEmitterCount);
         m_stablePowerState = jData.value("stablePowerState", m_stablePowerState);
         m_fontSize = jData.value("fontsize", m_fontSize);
     };
@@ -22,6 +22,30 @@
 #include "Renderer.h"
 #include "UI.h"
 
+// Bake a slab under the floor of Sponza for PF_SDFCollision, so the sparks land on it whether or not the floor is on screen
+static bool BakeFloorCollisionVolume(ParticleCollisionVolume& volume)
+{
+    const float boundsMin[3] = { -16.0f, -0.5f, -8.0f };
+    const float boundsMax[3] = { 16.0f, 0.0f, 8.0f };
+
+    float positions[8 * 3];
+    for (int corner = 0; corner < 8; ++corner)
+    {
+        positions[corner * 3 + 0] = (corner & 1) ? boundsMax[0] : boundsMin[0];
+        positions[corner * 3 + 1] = (corner & 2) ? boundsMax[1] : boundsMin[1];
+        positions[corner * 3 + 2] = (corner & 4) ? boundsMax[2] : boundsMin[2];
+    }
+
+    // Two triangles per face, the baker doesn't depend on the winding
+    const unsigned int indices[] = {
+        0, 2, 6,  0, 6, 4,     1, 5, 7,  1, 7, 3,     // -x, +x
+        0, 4, 5,  0, 5, 1,     2, 3, 7,  2, 7, 6,     // -y, +y
+        0, 1, 3,  0, 3, 2,     4, 6, 7,  4, 7, 5,     // -z, +z
+    };
+
+    return BakeParticleCollisionVolume(positions, 8, indices, _countof(indices), 0.1f, 0.3f, volume);
+}
+
 //--------------------------------------------------------------------------------------
 //
 // OnCreate
@@ -125,6 +149,11 @@ void Renderer::OnCreate(Device* pDevice, SwapChain *pSwapChain, float FontSize,
     m_ResourceViewHeaps.AllocCBV_SRV_UAVDescriptor(3, &m_UpscaleSRVs);
 
     m_pGPUParticleSystem = IParticleSystem::CreateGPUSystem("..\\media\\atlas.dds");
+
+    ParticleCollisionVolume collisionVolume;
+    if (BakeFloorCollisionVolume(collisionVolume))
+        m_pGPUParticleSystem->SetCollisionVolume(collisionVolume);
+
     m_pGPUParticleSystem->OnCreateDevice(*pDevice, m_UploadHeap, m_ResourceViewHeaps, m_VidMemBufferPool, m_ConstantBufferRing);
 
     m_GpuFrameRateLimiter.OnCreate(pDevice, &m_ResourceViewHeaps);
@@ -267,7 +296,7 @@ void Renderer::OnCreateWindowSizeDependentResources(SwapChain *pSwapChain, UISta
         }
 
         // create upscale context
-        UpscaleContext::FfxUpscaleInitParams upscaleParams = { pState->m_nUpscaleType, m_bInvertedDepth, m_pDevice, pSwapChain->GetFormat(), &m_UploadHeap, backBufferCount };
+        UpscaleContext::FfxUpscaleInitParams upscaleParams = { pState->m_nUpscaleType, m_bInvertedDepth, m_pDevice, pSwapChain->GetFormat(), &m_UploadHeap, backBufferCount, pState->nFsr2MotionVectorDilationMode, pState->bFsr2GroupsharedRcas, pState->bFsr2RcasTimestamp, &m_GPUTimer };
         m_pUpscaleContext = UpscaleContext::CreateUpscaleContext(upscaleParams);
     }
     m_pUpscaleContext->OnCreateWindowSizeDependentResources(
@@ -586,6 +615,7 @@ void Renderer::OnRender(UIState* pState, const Camera& Cam, SwapChain* pSwapChai
     {
         m_state.flags = IParticleSystem::PF_Streaks | IParticleSystem::PF_DepthCull | IParticleSystem::PF_Sort;
         m_state.flags |= pState->nReactiveMaskMode == REACTIVE_MASK_MODE_ON ? IParticleSystem::PF_Reactive : 0;
+        m_state.flags |= (pState->bParticleSDFCollision && pState->m_activeScene == 1) ? IParticleSystem::PF_SDFCollision : 0;
 
         const Camera& camera = pState->camera;
         m_state.constantData.m_ViewProjection = camera.GetProjection() * camera.GetView();
@@ -601,7 +631,10 @@ void Renderer::OnRender(UIState* pState, const Camera& Cam, SwapChain* pSwapChai
         m_state.constantData.m_AmbientColor *= fLightMod;
 
         m_state.constantData.m_FrameTime = pState->m_bPlayAnimations ? (0.001f * (float)pState->deltaTime) : 0.0f;
+        m_state.constantData.m_ReactiveScale = pState->fParticleReactiveScale;
+        m_state.constantData.m_ReactiveMax = pState->fParticleReactiveMax;
         PopulateEmitters(pState->m_bPlayAnimations, pState->m_activeScene, 0.001f * (float)pState->deltaTime);
+        SplitEmitters(pState->nParticleEmitterCount);
     }
 
     // command buffer calls
@@ -756,7 +789,8 @@ void Renderer::OnRender(UIState* pState, const Camera& Cam, SwapChain* pSwapChai
                 if (pState->bRenderParticleSystem)
                 {
                     pCmdLst1->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(m_GBuffer.m_DepthBuffer.GetResource(), D3D12_RESOURCE_STATE_DEPTH_WRITE, D3D12_RESOURCE_STATE_DEPTH_READ | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE));
-                    m_pGPUParticleSystem->Render(pCmdLst1, m_ConstantBufferRing, m_state.flags, m_state.emitters, m_state.numEmitters, m_state.constantData);
+                    m_pGPUParticleSystem->Render(pCmdLst1, m_ConstantBufferRing, m_state.flags, m_state.splitEmitters.data(), (int)m_state.splitEmitters.size(), m_state.constantData);
+                    m_GPUTimer.GetTimeStamp(pCmdLst1, "GPU Particles");
                     pCmdLst1->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(m_GBuffer.m_DepthBuffer.GetResource(), D3D12_RESOURCE_STATE_DEPTH_READ | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE, D3D12_RESOURCE_STATE_DEPTH_WRITE));
                 }
 
@@ -884,7 +918,10 @@ void Renderer::OnRender(UIState* pState, const Camera& Cam, SwapChain* pSwapChai
         pCmdLst1->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(pGBuffer->m_UpscaleTransparencyAndComposition.GetResource(), D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE, D3D12_RESOURCE_STATE_RENDER_TARGET));
         pCmdLst1->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(pGBuffer->m_HDR.GetResource(), D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE));
 
-        if(bUseUpscale)
+        // with "fsr2RcasTimestamp" the FSR2 context writes the "FSR 2.0 API" timestamp itself, before RCAS
+        if (bUseUpscale && pState->bFsr2RcasTimestamp && pState->m_nUpscaleType == UPSCALE_TYPE_FSR_2_0)
+            m_GPUTimer.GetTimeStamp(pCmdLst1, "FSR 2.0 RCAS");
+        else if (bUseUpscale)
             m_GPUTimer.GetTimeStamp(pCmdLst1, m_pUpscaleContext->Name().c_str());
         else if(pState->bUseTAA && !pState->bUseRcas)
             m_GPUTimer.GetTimeStamp(pCmdLst1, "TAA");
@@ -1144,6 +1181,31 @@ void Renderer::PopulateEmitters(bool playAnimations, int activeScene, float fram
 }
 
 
+// Splits the particles of the scene's emitters over emitterCount emitters, to measure the cost of the emitter count on its own. The copies of
+// an emitter keep its colors and lighting center and share its particles, but every copy emits at least one particle per frame so that it
+// takes part in the emit dispatch. An emitterCount up to the number of scene emitters keeps the scene's emitters
+void Renderer::SplitEmitters(int emitterCount)
+{
+    m_state.splitEmitters.assign(m_state.emitters, m_state.emitters + m_state.numEmitters);
+    if (m_state.numEmitters == 0 || emitterCount <= m_state.numEmitters)
+        return;
+
+    m_state.splitEmitters.clear();
+    for (int i = 0; i < emitterCount; i++)
+    {
+        const int source = i % m_state.numEmitters;
+        const int copy = i / m_state.numEmitters;
+        const int numCopies = (emitterCount - source + m_state.numEmitters - 1) / m_state.numEmitters;
+        const int numToEmit = m_state.emitters[source].m_NumToEmit;
+
+        IParticleSystem::EmitterParams emitter = m_state.emitters[source];
+        emitter.m_NumToEmit = std::max<int>(1, numToEmit * (copy + 1) / numCopies - numToEmit * copy / numCopies);
+        emitter.m_ColorIndex = source;
+        m_state.splitEmitters.push_back(emitter);
+    }
+}
+
+
 void Renderer::BuildDevUI(UIState* pState)
 {
     if (m_pUpscaleContext)
@@ -73,6 +73,7 @@ private:
         float                               frameTime = 0.0f;
         int                                 numEmitters = 0;
         IParticleSystem::EmitterParams      emitters[10] = {};
+        std::vector<IParticleSystem::EmitterParams> splitEmitters;
         int                                 flags = 0;
         IParticleSystem::ConstantData       constantData = {};
     };
@@ -85,6 +86,7 @@ private:
 
     void ResetScene();
     void PopulateEmitters(bool playAnimations, int activeScene, float frameTime);
+    void SplitEmitters(int emitterCount);
 
     Device                         *m_pDevice;
 
@@ -121,6 +121,7 @@ void FSR2Sample::BuildUI()
                 m_activeCamera = 0;
             ImGui::Combo("Camera", &m_activeCamera, cameraControl, min((int)(m_pGltfLoader->m_cameras.size() + 2), _countof(cameraControl)));
             ImGui::Checkbox("Camera Headbobbing", &m_UIState.m_bHeadBobbing);
+            ImGui::Checkbox("Particle SDF Collision", &m_UIState.bParticleSDFCollision);
 
             auto getterLambda = [](void* data, int idx, const char** out_str)->bool { *out_str = ((std::vector<std::string> *)data)->at(idx).c_str(); return true; };
             if (ImGui::Combo("Model", &m_UIState.m_activeScene, getterLambda, &m_sceneNames, (int)m_sceneNames.size()))
@@ -228,9 +229,17 @@ void FSR2Sample::BuildUI()
 
                 const char* reactiveOptions[] = { "Disabled", "Manual Reactive Mask Generation", "Autogen FSR2 Helper Function" };
                 ImGui::Combo("Reactive Mask mode", (int*)(&m_UIState.nReactiveMaskMode), reactiveOptions, _countof(reactiveOptions));
+                if (m_UIState.nReactiveMaskMode == REACTIVE_MASK_MODE_ON)
+                {
+                    ImGui::SliderFloat("Particle Reactive Scale", &m_UIState.fParticleReactiveScale, 0.0f, 4.0f);
+                    ImGui::SliderFloat("Particle Reactive Max", &m_UIState.fParticleReactiveMax, 0.0f, 1.0f);
+                }
 
                 ImGui::Checkbox("Use Transparency and Composition Mask", &m_UIState.bCompositionMask);
 
+                const char* debugViewOptions[] = { "None", "Dilated Motion Vectors", "Depth Clip", "Lock Status", "Reactive Masks", "Temporal Reactive Factor", "Accumulation Weight", "Luma Instability", "Tiled" };
+                ImGui::Combo("Debug view", &m_UIState.nFsr2DebugView, debugViewOptions, _countof(debugViewOptions));
+
                 if (m_pRenderer &&
                     ImGui::CollapsingHeader("Dev Options", ImGuiTreeNodeFlags_DefaultOpen))
                 {
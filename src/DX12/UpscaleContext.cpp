@@ -67,6 +67,10 @@ UpscaleContext::UpscaleContext(std::string name)
 void UpscaleContext::OnCreate(const FfxUpscaleInitParams& initParams)
 {
     m_bInvertedDepth = initParams.bInvertedDepth;
+    m_nFsr2MotionVectorDilationMode = initParams.nFsr2MotionVectorDilationMode;
+    m_bFsr2GroupsharedRcas = initParams.bFsr2GroupsharedRcas;
+    m_bFsr2RcasTimestamp = initParams.bFsr2RcasTimestamp;
+    m_pGPUTimer = initParams.pGPUTimer;
     m_pDevice = initParams.pDevice;
     m_OutputFormat = initParams.outFormat;
     m_Type = initParams.nType;
@@ -94,6 +94,39 @@ static void onFSR2Msg(FfxFsr2MsgType type, const wchar_t* message)
     OutputDebugStringW(L"\n");
 }
 
+// With "fsr2RcasTimestamp" the jobs FSR2 scheduled before its RCAS job are executed as soon as the RCAS job is
+// scheduled, and the "FSR 2.0 API" timestamp is written after them, so the renderer's next timestamp covers RCAS alone.
+static FfxFsr2ScheduleGpuJobFunc s_fpScheduleGpuJob = nullptr;
+static GPUTimestamps* s_pRcasGPUTimer = nullptr;
+static ID3D12GraphicsCommandList* s_rcasCommandList = {};
+static bool s_bRcasTimestampWritten = false;
+
+static FfxErrorCode scheduleGpuJobBeforeRcasTimestamp(FfxFsr2Interface* backendInterface, const FfxGpuJobDescription* job)
+{
+    bool isRcasJob = false;
+    if (job->jobType == FFX_GPU_JOB_COMPUTE)
+    {
+        for (uint32_t srvIndex = 0; srvIndex < job->computeJobDescriptor.pipeline.srvCount; ++srvIndex)
+        {
+            isRcasJob = isRcasJob || wcscmp(job->computeJobDescriptor.srvNames[srvIndex], L"r_rcas_input") == 0;
+        }
+    }
+
+    if (isRcasJob && s_pRcasGPUTimer != nullptr)
+    {
+        const FfxErrorCode errorCode = backendInterface->fpExecuteGpuJobs(backendInterface, ffxGetCommandListDX12(s_rcasCommandList));
+        if (errorCode != FFX_OK)
+        {
+            return errorCode;
+        }
+
+        s_pRcasGPUTimer->GetTimeStamp(s_rcasCommandList, "FSR 2.0 API");
+        s_bRcasTimestampWritten = true;
+    }
+
+    return s_fpScheduleGpuJob(backendInterface, job);
+}
+
 void UpscaleContext_FSR2_API::OnCreateWindowSizeDependentResources(
     ID3D12Resource* input,
     ID3D12Resource* output,
@@ -118,11 +151,16 @@ void UpscaleContext_FSR2_API::OnCreateWindowSizeDependentResources(
     initializationParameters.displaySize.width = displayWidth;
     initializationParameters.displaySize.height = displayHeight;
     initializationParameters.flags = FFX_FSR2_ENABLE_AUTO_EXPOSURE;
+    initializationParameters.motionVectorDilationMode = (FfxFsr2MotionVectorDilationMode)m_nFsr2MotionVectorDilationMode;
 
     if (m_bInvertedDepth) {
         initializationParameters.flags |= FFX_FSR2_ENABLE_DEPTH_INVERTED | FFX_FSR2_ENABLE_DEPTH_INFINITE;
     }
 
+    if (m_bFsr2GroupsharedRcas) {
+        initializationParameters.flags |= FFX_FSR2_ENABLE_GROUPSHARED_RCAS;
+    }
+
     if (m_enableDebugCheck)
     {
         initializationParameters.flags |= FFX_FSR2_ENABLE_DEBUG_CHECKING;
@@ -142,6 +180,12 @@ void UpscaleContext_FSR2_API::OnCreateWindowSizeDependentResources(
     memcpy(&s_initializationParameters, &initializationParameters, sizeof(FfxFsr2ContextDescription));
 #endif // #if COMPILE_FROM_HLSL
 
+    if (m_bFsr2RcasTimestamp)
+    {
+        s_fpScheduleGpuJob = initializationParameters.callbacks.fpScheduleGpuJob;
+        initializationParameters.callbacks.fpScheduleGpuJob = scheduleGpuJobBeforeRcasTimestamp;
+    }
+
     const uint64_t memoryUsageBefore = getMemoryUsageSnapshot(m_pDevice->GetDevice());
     ffxFsr2ContextCreate(&context, &initializationParameters);
     const uint64_t memoryUsageAfter = getMemoryUsageSnapshot(m_pDevice->GetDevice());
@@ -242,6 +286,7 @@ void UpscaleContext_FSR2_API::Draw(ID3D12GraphicsCommandList* pCommandList, cons
     dispatchParameters.reset = false;
     dispatchParameters.enableSharpening = pState->bUseRcas;
     dispatchParameters.sharpness = pState->sharpening;
+    dispatchParameters.debugView = (FfxFsr2DebugView)pState->nFsr2DebugView;
     dispatchParameters.frameTimeDelta = (float)pState->deltaTime;
     dispatchParameters.preExposure = 1.0f;
     dispatchParameters.renderSize.width = pState->renderWidth;
@@ -251,7 +296,24 @@ void UpscaleContext_FSR2_API::Draw(ID3D12GraphicsCommandList* pCommandList, cons
     dispatchParameters.cameraFovAngleVertical = pState->camera.GetFovV();
     pState->bReset = false;
 
+    if (m_bFsr2RcasTimestamp)
+    {
+        s_pRcasGPUTimer = m_pGPUTimer;
+        s_rcasCommandList = pCommandList;
+        s_bRcasTimestampWritten = false;
+    }
+
     FfxErrorCode errorCode = ffxFsr2ContextDispatch(&context, &dispatchParameters);
     FFX_ASSERT(errorCode == FFX_OK);
 
+    // without sharpening there is no RCAS job, the renderer's "FSR 2.0 RCAS" timestamp is then empty
+    if (m_bFsr2RcasTimestamp)
+    {
+        if (!s_bRcasTimestampWritten)
+        {
+            m_pGPUTimer->GetTimeStamp(pCommandList, "FSR 2.0 API");
+        }
+        s_pRcasGPUTimer = nullptr;
+    }
+
 }
@@ -49,6 +49,7 @@ ConstantBuffer<RootConstantData> rootConstData                          : regist
 
 [[vk::binding(1, 2)]] RWStructuredBuffer<uint>  DstBuffer               : register(u0, space4);         // The sorted keys or prefixed data
 [[vk::binding(3, 2)]] RWStructuredBuffer<uint>  DstPayload              : register(u0, space5);         // the sorted payload data
+[[vk::binding(4, 2)]] RWStructuredBuffer<uint>  SegmentHeads            : register(u0, space13);        // First sorted index of each segment (segmented sort only)
 
 [[vk::binding(0, 3)]] RWStructuredBuffer<uint>  ScanSrc                 : register(u0, space6);         // Source for Scan Data
 [[vk::binding(1, 3)]] RWStructuredBuffer<uint>  ScanDst                 : register(u0, space7);         // Destination for Scan Data
@@ -116,6 +117,13 @@ void FPS_Scatter(uint localID : SV_GroupThreadID, uint groupID : SV_GroupID)
     );
 }
 
+// FPS SegmentHeads (segmented sort only, the shift bit holds the number of segment bits)
+[numthreads(FFX_PARALLELSORT_THREADGROUP_SIZE, 1, 1)]
+void FPS_SegmentHeads(uint KeyIndex : SV_DispatchThreadID)
+{
+    FFX_ParallelSort_SegmentHeads_uint(KeyIndex, CBuffer.NumKeys, rootConstData.CShiftBit, SrcBuffer, SegmentHeads);
+}
+
 [numthreads(1, 1, 1)]
 void FPS_SetupIndirectParameters(uint localID : SV_GroupThreadID)
 {
@@ -43,10 +43,33 @@ uint WriteEmitterProperties( uint emitterIndex, uint textureIndex, bool isStreak
 }
 
 
+// Binary search for the last emitter whose emit start is not after the particle
+uint FindEmitter( uint particleIndex )
+{
+    uint first = 0;
+    uint count = g_NumEmitters;
+    while ( count > 0 )
+    {
+        uint step = count / 2;
+        if ( g_Emitters[ first + step ].m_EmitStart <= particleIndex )
+        {
+            first += step + 1;
+            count -= step + 1;
+        }
+        else
+        {
+            count = step;
+        }
+    }
+
+    return first - 1;
+}
+
+
 groupshared int g_ldsNumParticlesAvailable;
 
 
-// Emit particles, one per thread, in blocks of 1024 at a time
+// Emit particles for every emitter in the constant buffer, one per thread, in blocks of 1024 at a time
 [numthreads(1024,1,1)]
 void CS_Emit( uint3 localIdx : SV_GroupThreadID, uint3 globalIdx : SV_DispatchThreadID )
 {
@@ -61,8 +84,16 @@ void CS_Emit( uint3 localIdx : SV_GroupThreadID, uint3 globalIdx : SV_DispatchTh
     // Check to make sure we don't emit more particles than we specified
     if ( globalIdx.x < g_ldsNumParticlesAvailable )
     {
+        // Take the particles for the whole wave with a single atomic, each lane then pops its own entry off the dead list
+        uint numEmittingLanes = WaveActiveCountBits( true );
+        uint laneOffset = WavePrefixCountBits( true );
+
         int numDeadParticles = 0;
-        InterlockedAdd( g_DeadList[ 0 ], -1, numDeadParticles );
+        if ( WaveIsFirstLane() )
+        {
+            InterlockedAdd( g_DeadList[ 0 ], -(int)numEmittingLanes, numDeadParticles );
+        }
+        numDeadParticles = WaveReadLaneFirst( numDeadParticles ) - (int)laneOffset;
 
         if ( numDeadParticles > 0 && numDeadParticles <= g_MaxParticles )
         {
@@ -77,19 +108,21 @@ void CS_Emit( uint3 localIdx : SV_GroupThreadID, uint3 globalIdx : SV_DispatchTh
             float2 uv2 = float2( (globalIdx.x + 1) / 1024.0, g_ElapsedTime );
             float3 randomValues1 = g_RandomBuffer.SampleLevel( g_samWrapPoint, uv2, 0 ).xyz;
 
-            float velocityMagnitude = length( g_vEmitterVelocity.xyz );
+            EmitterData emitter = g_Emitters[ FindEmitter( globalIdx.x ) ];
+
+            float velocityMagnitude = length( emitter.m_EmitterVelocity.xyz );
 
-            pb.m_Position = g_vEmitterPosition.xyz + ( randomValues0.xyz * g_PositionVariance.xyz );
+            pb.m_Position = emitter.m_EmitterPosition.xyz + ( randomValues0.xyz * emitter.m_PositionVariance.xyz );
 
-            pa.m_StreakLengthAndEmitterProperties = WriteEmitterProperties( g_EmitterIndex, g_TextureIndex, g_EmitterStreaks ? true : false );
+            pa.m_StreakLengthAndEmitterProperties = WriteEmitterProperties( emitter.m_EmitterIndex, emitter.m_TextureIndex, emitter.m_EmitterStreaks ? true : false );
             pa.m_CollisionCount = 0;
 
-            pb.m_Mass = g_Mass;
-            pb.m_Velocity = g_vEmitterVelocity.xyz + ( randomValues1.xyz * velocityMagnitude * g_VelocityVariance );
-            pb.m_Lifespan = g_ParticleLifeSpan;
+            pb.m_Mass = emitter.m_Mass;
+            pb.m_Velocity = emitter.m_EmitterVelocity.xyz + ( randomValues1.xyz * velocityMagnitude * emitter.m_VelocityVariance );
+            pb.m_Lifespan = emitter.m_ParticleLifeSpan;
             pb.m_Age = pb.m_Lifespan;
-            pb.m_StartSize = g_StartSize;
-            pb.m_EndSize = g_EndSize;
+            pb.m_StartSize = emitter.m_StartSize;
+            pb.m_EndSize = emitter.m_EndSize;
 
             int index = g_DeadList[ numDeadParticles ];
 
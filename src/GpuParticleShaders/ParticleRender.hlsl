@@ -71,8 +71,8 @@ struct PS_INPUT
 
     uint    g_ScreenWidth;
     uint    g_ScreenHeight;
-    uint    g_pads0;
-    uint    g_pads1;
+    float   g_ReactiveScale;
+    float   g_ReactiveMax;
 };
 
 [[vk::binding( 7, 0 )]] SamplerState g_samClampLinear   : register( s0 );
@@ -165,10 +165,15 @@ PS_INPUT VS_StructuredBuffer( uint VertexId : SV_VertexID )
 
 struct PS_OUTPUT
 {
+#if defined (OIT)
+    float4 accumulation : SV_TARGET0;
+    float revealage : SV_TARGET1;
+#else
     float4 color : SV_TARGET0;
 #if defined (REACTIVE)
     float reactiveMask : SV_TARGET2;
 #endif
+#endif
 };
 
 
@@ -206,7 +211,7 @@ PS_OUTPUT PS_Billboard( PS_INPUT In )
     albedo *= g_ParticleTexture.SampleLevel( g_samClampLinear, In.TexCoord, 0 );	// 2d
 
                                                                                     // Multiply in the particle color
-    output.color = albedo * In.Color;
+    float4 color = albedo * In.Color;
 
     // Calculate the UV based the screen space position
     float3 n = 0;
@@ -253,10 +258,26 @@ PS_OUTPUT PS_Billboard( PS_INPUT In )
     float3 lighting = g_AmbientColor.rgb + ndotl * g_SunColor.rgb;
 
     // Multiply lighting term in
-    output.color.rgb *= lighting;
+    color.rgb *= lighting;
+
+#if defined (OIT)
+    // Weighted blended OIT: accumulate premultiplied color weighted by coverage and view depth, so nearer particles
+    // dominate the average without sorting. The revealage target multiplies up the transmittance ( 1 - alpha ).
+    // The weight falls off by e every 25 units of the sample's scene, a steeper falloff lets the nearest layer win
+    // over an average that is closer to back to front blending
+    float viewDepth = abs( In.ViewPos.z );
+    float weight = color.a * clamp( exp( -viewDepth / 25.0 ), 1e-2, 1.0 );
+
+    output.accumulation = float4( color.rgb * color.a, color.a ) * weight;
+    output.revealage = color.a;
+#else
+    output.color = color;
 
 #if defined (REACTIVE)
-    output.reactiveMask = max( output.color.r, max( output.color.g, output.color.b ) ) * albedo.a;
+    // Bright, opaque particles are the most reactive. The target is max blended so overlapping particles keep the
+    // strongest coverage, and the result is bound directly as the FSR2 reactive mask
+    output.reactiveMask = min( max( color.r, max( color.g, color.b ) ) * albedo.a * g_ReactiveScale, g_ReactiveMax );
+#endif
 #endif
 
     return output;
@@ -0,0 +1,105 @@
+//
+// Copyright (c) 2021 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+//
+//  Composites the weighted blended OIT targets written by ParticleRender.hlsl over the scene
+//
+
+
+// The weighted premultiplied color and coverage sums
+[[vk::binding( 0, 0 )]] Texture2D<float4>   g_AccumulationTexture   : register( t0 );
+
+// The product of ( 1 - alpha ) of every particle covering the pixel
+[[vk::binding( 1, 0 )]] Texture2D<float>    g_RevealageTexture      : register( t1 );
+
+// Shared with ParticleRender.hlsl, only the reactive mask controls are used here
+[[vk::binding( 2, 0 )]] cbuffer RenderingConstantBuffer : register( b0 )
+{
+    matrix  g_mProjection;
+    matrix  g_mProjectionInv;
+
+    float4  g_SunColor;
+    float4  g_AmbientColor;
+    float4  g_SunDirectionVS;
+
+    uint    g_ScreenWidth;
+    uint    g_ScreenHeight;
+    float   g_ReactiveScale;
+    float   g_ReactiveMax;
+};
+
+
+struct VS_OUTPUT
+{
+    float4 Position : SV_POSITION;
+};
+
+
+// Full screen triangle from the vertex ID
+VS_OUTPUT VS_FullscreenTriangle( uint VertexId : SV_VertexID )
+{
+    VS_OUTPUT Output = (VS_OUTPUT)0;
+
+    float2 uv = float2( ( VertexId << 1 ) & 2, VertexId & 2 );
+    Output.Position = float4( uv * 2 - 1, 0, 1 );
+
+    return Output;
+}
+
+
+struct PS_OUTPUT
+{
+    float4 color : SV_TARGET0;
+#if defined (REACTIVE)
+    float reactiveMask : SV_TARGET2;
+#endif
+};
+
+
+// Blended as color * ( 1 - revealage ) + scene * revealage
+PS_OUTPUT PS_ResolveOIT( VS_OUTPUT In )
+{
+    PS_OUTPUT output = (PS_OUTPUT)0;
+
+    int3 pixel = int3( In.Position.xy, 0 );
+    float revealage = g_RevealageTexture.Load( pixel );
+
+    // Leave pixels without particles untouched, including the reactive mask
+    if ( revealage >= 1.0 )
+        discard;
+
+    float4 accumulation = g_AccumulationTexture.Load( pixel );
+
+    // Many heavily weighted layers can overflow the fp16 coverage sum
+    if ( isinf( accumulation.a ) )
+        accumulation.a = max( accumulation.r, max( accumulation.g, accumulation.b ) );
+
+    float3 averageColor = accumulation.rgb / max( accumulation.a, 1e-5 );
+
+    output.color = float4( averageColor, revealage );
+
+#if defined (REACTIVE)
+    output.reactiveMask = min( max( averageColor.r, max( averageColor.g, averageColor.b ) ) * ( 1.0 - revealage ) * g_ReactiveScale, g_ReactiveMax );
+#endif
+
+    return output;
+}
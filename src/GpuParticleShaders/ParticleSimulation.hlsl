@@ -82,6 +82,62 @@ float3 calcViewSpacePositionFromDepth( float2 normalizedScreenPosition, int2 tex
 }
 
 
+// Fetch a voxel of the collision volume from its slice in the texture
+float loadCollisionVolume( int3 voxel )
+{
+    return g_CollisionVolume.Load( int3( voxel.x, voxel.y + voxel.z * g_CollisionVolumeResolution.y, 0 ) );
+}
+
+
+// Trilinear sample of the collision volume at a world position, returning the gradient of the distance in xyz and the distance in w.
+// Matches SampleParticleCollisionVolume on the CPU
+bool sampleCollisionVolume( float3 position, out float4 gradientAndDistance )
+{
+    gradientAndDistance = 0;
+
+    // Trilinear filtering needs two voxels along each axis
+    if ( any( g_CollisionVolumeResolution < 2 ) )
+        return false;
+
+    float3 local = ( position - g_CollisionVolumeMin.xyz ) / g_CollisionVolumeMin.w;
+    if ( any( local < 0.0 ) || any( local > (float3)g_CollisionVolumeResolution ) )
+        return false;
+
+    // Voxel centres are at half integer coordinates, clamp to the outermost ones
+    float3 coord = clamp( local - 0.5, 0.0, (float3)( g_CollisionVolumeResolution - 1 ) );
+    int3 cell = min( (int3)coord, (int3)g_CollisionVolumeResolution - 2 );
+    float3 f = coord - (float3)cell;
+
+    float d000 = loadCollisionVolume( cell + int3( 0, 0, 0 ) );
+    float d100 = loadCollisionVolume( cell + int3( 1, 0, 0 ) );
+    float d010 = loadCollisionVolume( cell + int3( 0, 1, 0 ) );
+    float d110 = loadCollisionVolume( cell + int3( 1, 1, 0 ) );
+    float d001 = loadCollisionVolume( cell + int3( 0, 0, 1 ) );
+    float d101 = loadCollisionVolume( cell + int3( 1, 0, 1 ) );
+    float d011 = loadCollisionVolume( cell + int3( 0, 1, 1 ) );
+    float d111 = loadCollisionVolume( cell + int3( 1, 1, 1 ) );
+
+    // Blend along X first, the gradient is the derivative of the trilinear blend within the cell
+    float d00 = lerp( d000, d100, f.x );
+    float d10 = lerp( d010, d110, f.x );
+    float d01 = lerp( d001, d101, f.x );
+    float d11 = lerp( d011, d111, f.x );
+
+    float d0 = lerp( d00, d10, f.y );
+    float d1 = lerp( d01, d11, f.y );
+
+    float gx0 = lerp( d100 - d000, d110 - d010, f.y );
+    float gx1 = lerp( d101 - d001, d111 - d011, f.y );
+
+    gradientAndDistance.x = lerp( gx0, gx1, f.z );
+    gradientAndDistance.y = lerp( d10 - d00, d11 - d01, f.z );
+    gradientAndDistance.z = d1 - d0;
+    gradientAndDistance.xyz /= g_CollisionVolumeMin.w;
+    gradientAndDistance.w = lerp( d0, d1, f.z );
+    return true;
+}
+
+
 // Simulate 256 particles per thread group, one thread per particle
 [numthreads(256,1,1)]
 void CS_Simulate( uint3 id : SV_DispatchThreadID )
@@ -194,6 +250,31 @@ void CS_Simulate( uint3 id : SV_DispatchThreadID )
             }
         }
 
+        // Collide with the signed distance field. It covers the scene whether or not it is on screen, so doesn't need the depth buffer
+        float4 gradientAndDistance;
+        if ( g_CollideWithVolume && g_FrameTime > 0.0 && !IsSleeping( emitterProperties ) && sampleCollisionVolume( vNewPosition, gradientAndDistance ) )
+        {
+            float penetration = radius - gradientAndDistance.w;
+            if ( penetration > 0.0 && any( gradientAndDistance.xyz != 0.0 ) )
+            {
+                float3 surfaceNormal = normalize( gradientAndDistance.xyz );
+
+                // Push the particle back out to the surface
+                vNewPosition += surfaceNormal * penetration;
+
+                // Only respond if the particle is still moving into the surface. The velocity into it bounces back and friction slows the rest
+                float normalSpeed = dot( pb.m_Velocity, surfaceNormal );
+                if ( normalSpeed < 0.0 )
+                {
+                    float3 normalVelocity = normalSpeed * surfaceNormal;
+                    float3 tangentVelocity = pb.m_Velocity - normalVelocity;
+                    pb.m_Velocity = ( 1.0 - g_CollisionFriction ) * tangentVelocity - g_CollisionBounce * normalVelocity;
+                }
+
+                pa.m_CollisionCount++;
+            }
+        }
+
         // Put particle to sleep if the velocity is small
         if ( g_EnableSleepState && pa.m_CollisionCount > 10 && length( pb.m_Velocity ) < 0.01 )
         {
@@ -273,21 +354,36 @@ void CS_Simulate( uint3 id : SV_DispatchThreadID )
         {
             pb.m_Age = -1;
 
+            // One atomic per wave, each lane writes to its own slot after the wave's base index
+            uint numDeadLanes = WaveActiveCountBits( true );
+            uint laneOffset = WavePrefixCountBits( true );
+
             uint dstIdx = 0;
-            InterlockedAdd( g_DeadList[ 0 ], 1, dstIdx );
+            if ( WaveIsFirstLane() )
+            {
+                InterlockedAdd( g_DeadList[ 0 ], numDeadLanes, dstIdx );
+            }
+            dstIdx = WaveReadLaneFirst( dstIdx ) + laneOffset;
             g_DeadList[ dstIdx + 1 ] = id.x;
         }
         else
         {
-            // Alive particles are added to the alive list
+            // Alive particles are added to the alive list, again with one atomic per wave
+            uint numAliveLanes = WaveActiveCountBits( true );
+            uint laneOffset = WavePrefixCountBits( true );
+
             int index = 0;
-            InterlockedAdd( g_AliveParticleCount[ 0 ], 1, index );
+            if ( WaveIsFirstLane() )
+            {
+                InterlockedAdd( g_AliveParticleCount[ 0 ], numAliveLanes, index );
+
+                uint dstIdx = 0;
+                // 6 indices per particle billboard
+                InterlockedAdd( g_DrawArgs[ 0 ].IndexCountPerInstance, 6 * numAliveLanes, dstIdx );
+            }
+            index = WaveReadLaneFirst( index ) + laneOffset;
             g_IndexBuffer[ index ] = id.x;
             g_DistanceBuffer[ index ] = pb.m_DistanceToEye;
-
-            uint dstIdx = 0;
-            // 6 indices per particle billboard
-            InterlockedAdd( g_DrawArgs[ 0 ].IndexCountPerInstance, 6, dstIdx );
         }
 
         // Write the particle data back to the global particle buffer
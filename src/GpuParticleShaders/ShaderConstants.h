@@ -24,3 +24,6 @@
 
 // Maximum number of emitters supported
 #define NUM_EMITTERS                    4
+
+// Maximum number of emitters spawned by a single emit dispatch, keeps the emitter constant buffer within 16KB
+#define NUM_EMITTERS_PER_DISPATCH       128
@@ -91,31 +91,49 @@ struct IndirectCommand
     float   g_FrameTime;
 
     int     g_MaxParticles;
+    int     g_CollideWithVolume;
+    float   g_CollisionBounce;
+    float   g_CollisionFriction;
+
+    float4  g_CollisionVolumeMin;           // xyz is the corner of the volume, w the size of a voxel
+    uint3   g_CollisionVolumeResolution;
     uint    g_Pad0;
-    uint    g_Pad1;
-    uint    g_Pad2;
 };
 
+struct EmitterData
+{
+    float4  m_EmitterPosition;
+    float4  m_EmitterVelocity;
+    float4  m_PositionVariance;
+
+    uint    m_EmitStart;            // The number of particles emitted by the emitters before this one
+    float   m_ParticleLifeSpan;
+    float   m_StartSize;
+    float   m_EndSize;
+
+    float   m_VelocityVariance;
+    float   m_Mass;
+    uint    m_EmitterIndex;
+    uint    m_EmitterStreaks;
+
+    uint    m_TextureIndex;
+    uint    m_pads0;
+    uint    m_pads1;
+    uint    m_pads2;
+};
+
+// All the emitters spawning this frame, one thread per particle finds its emitter from the emit starts
 [[vk::binding( 12, 0 )]] cbuffer EmitterConstantBuffer : register( b1 )
 {
-    float4  g_vEmitterPosition;
-    float4  g_vEmitterVelocity;
-    float4  g_PositionVariance;
-
-    int     g_MaxParticlesThisFrame;
-    float   g_ParticleLifeSpan;
-    float   g_StartSize;
-    float   g_EndSize;
-
-    float   g_VelocityVariance;
-    float   g_Mass;
-    uint    g_EmitterIndex;
-    uint    g_EmitterStreaks;
-
-    uint    g_TextureIndex;
-    uint    g_pads0;
-    uint    g_pads1;
-    uint    g_pads2;
+    uint        g_NumEmitters;
+    int         g_MaxParticlesThisFrame;
+    uint        g_pads0;
+    uint        g_pads1;
+
+    EmitterData g_Emitters[ NUM_EMITTERS_PER_DISPATCH ];
 };
 
 [[vk::binding( 13, 0 )]] SamplerState g_samWrapPoint : register( s0 );
+
+// The signed distance field the particles collide with, the Z slices of the volume are stacked vertically
+[[vk::binding( 14, 0 )]] Texture2D<float>                           g_CollisionVolume           : register( t2 );
@@ -0,0 +1,328 @@
+//
+// Copyright (c) 2021 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#include "ParticleCollision.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+
+struct Float3
+{
+    float x, y, z;
+};
+
+static Float3 operator+( const Float3& a, const Float3& b ) { return { a.x + b.x, a.y + b.y, a.z + b.z }; }
+static Float3 operator-( const Float3& a, const Float3& b ) { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+static Float3 operator*( const Float3& a, float s ) { return { a.x * s, a.y * s, a.z * s }; }
+static float dot( const Float3& a, const Float3& b ) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+
+static float GetAxis( const Float3& v, int axis ) { return axis == 0 ? v.x : ( axis == 1 ? v.y : v.z ); }
+
+
+// Closest point on the triangle abc to p, from Real-Time Collision Detection (Ericson) 5.1.5
+static Float3 ClosestPointOnTriangle( const Float3& p, const Float3& a, const Float3& b, const Float3& c )
+{
+    Float3 ab = b - a;
+    Float3 ac = c - a;
+    Float3 ap = p - a;
+    float d1 = dot( ab, ap );
+    float d2 = dot( ac, ap );
+    if ( d1 <= 0.0f && d2 <= 0.0f )
+        return a;
+
+    Float3 bp = p - b;
+    float d3 = dot( ab, bp );
+    float d4 = dot( ac, bp );
+    if ( d3 >= 0.0f && d4 <= d3 )
+        return b;
+
+    float vc = d1 * d4 - d3 * d2;
+    if ( vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f )
+        return a + ab * ( d1 / ( d1 - d3 ) );
+
+    Float3 cp = p - c;
+    float d5 = dot( ab, cp );
+    float d6 = dot( ac, cp );
+    if ( d6 >= 0.0f && d5 <= d6 )
+        return c;
+
+    float vb = d5 * d2 - d1 * d6;
+    if ( vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f )
+        return a + ac * ( d2 / ( d2 - d6 ) );
+
+    float va = d3 * d6 - d5 * d4;
+    if ( va <= 0.0f && ( d4 - d3 ) >= 0.0f && ( d5 - d6 ) >= 0.0f )
+        return b + ( c - b ) * ( ( d4 - d3 ) / ( ( d4 - d3 ) + ( d5 - d6 ) ) );
+
+    float denom = 1.0f / ( va + vb + vc );
+    return a + ab * ( vb * denom ) + ac * ( vc * denom );
+}
+
+
+// Intersect the line through the point (u, v) parallel to the axis with the triangle. Returns true and the coordinate along the
+// axis when the line crosses it
+static bool IntersectAxisLine( int axis, float u, float v, const Float3& a, const Float3& b, const Float3& c, float& t )
+{
+    int axisU = ( axis + 1 ) % 3;
+    int axisV = ( axis + 2 ) % 3;
+
+    float au = GetAxis( a, axisU ) - u, av = GetAxis( a, axisV ) - v;
+    float bu = GetAxis( b, axisU ) - u, bv = GetAxis( b, axisV ) - v;
+    float cu = GetAxis( c, axisU ) - u, cv = GetAxis( c, axisV ) - v;
+
+    // Twice the signed areas of the sub triangles opposite each vertex
+    float wa = bu * cv - bv * cu;
+    float wb = cu * av - cv * au;
+    float wc = au * bv - av * bu;
+    float area = wa + wb + wc;
+    if ( area == 0.0f )
+        return false;
+
+    // Walk the triangle counter clockwise so the two triangles sharing an edge walk it in opposite directions, then only one of
+    // them owns a line that passes exactly through it
+    float winding = area > 0.0f ? 1.0f : -1.0f;
+    auto ownsPoint = []( float w, float edgeU, float edgeV ) { return w > 0.0f || ( w == 0.0f && ( edgeV > 0.0f || ( edgeV == 0.0f && edgeU < 0.0f ) ) ); };
+
+    if ( !ownsPoint( wa * winding, ( cu - bu ) * winding, ( cv - bv ) * winding ) ||
+         !ownsPoint( wb * winding, ( au - cu ) * winding, ( av - cv ) * winding ) ||
+         !ownsPoint( wc * winding, ( bu - au ) * winding, ( bv - av ) * winding ) )
+        return false;
+
+    t = ( wa * GetAxis( a, axis ) + wb * GetAxis( b, axis ) + wc * GetAxis( c, axis ) ) / area;
+    return true;
+}
+
+
+bool BakeParticleCollisionVolume( const float* positions, int numVertices, const unsigned int* indices, int numIndices, float voxelSize, float padding, ParticleCollisionVolume& volume )
+{
+    int numTriangles = numIndices / 3;
+    if ( numVertices <= 0 || numTriangles <= 0 || voxelSize <= 0.0f )
+        return false;
+
+    std::vector<Float3> triangles( numTriangles * 3 );
+    Float3 boundsMin = { FLT_MAX, FLT_MAX, FLT_MAX };
+    Float3 boundsMax = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+    for ( int i = 0; i < numTriangles * 3; i++ )
+    {
+        if ( (int)indices[ i ] >= numVertices )
+            return false;
+
+        const float* position = &positions[ indices[ i ] * 3 ];
+        triangles[ i ] = { position[ 0 ], position[ 1 ], position[ 2 ] };
+
+        boundsMin = { std::min( boundsMin.x, position[ 0 ] ), std::min( boundsMin.y, position[ 1 ] ), std::min( boundsMin.z, position[ 2 ] ) };
+        boundsMax = { std::max( boundsMax.x, position[ 0 ] ), std::max( boundsMax.y, position[ 1 ] ), std::max( boundsMax.z, position[ 2 ] ) };
+    }
+
+    boundsMin = boundsMin - Float3{ padding, padding, padding };
+    boundsMax = boundsMax + Float3{ padding, padding, padding };
+
+    int resolution[ 3 ] = {};
+    for ( int axis = 0; axis < 3; axis++ )
+    {
+        // Trilinear filtering needs two voxels along each axis
+        resolution[ axis ] = std::max( 2, (int)std::ceil( ( GetAxis( boundsMax, axis ) - GetAxis( boundsMin, axis ) ) / voxelSize ) );
+    }
+
+    if ( resolution[ 0 ] > g_maxCollisionVolumeAtlasHeight || resolution[ 1 ] * resolution[ 2 ] > g_maxCollisionVolumeAtlasHeight )
+        return false;
+
+    volume.m_BoundsMin[ 0 ] = boundsMin.x;
+    volume.m_BoundsMin[ 1 ] = boundsMin.y;
+    volume.m_BoundsMin[ 2 ] = boundsMin.z;
+    volume.m_VoxelSize = voxelSize;
+    volume.m_Resolution[ 0 ] = resolution[ 0 ];
+    volume.m_Resolution[ 1 ] = resolution[ 1 ];
+    volume.m_Resolution[ 2 ] = resolution[ 2 ];
+    volume.m_Distances.assign( resolution[ 0 ] * resolution[ 1 ] * resolution[ 2 ], 0.0f );
+
+    auto voxelCentre = [ & ]( int axis, int i ) { return GetAxis( boundsMin, axis ) + ( (float)i + 0.5f ) * voxelSize; };
+    auto voxelIndex = [ & ]( const int coords[ 3 ] ) { return coords[ 0 ] + resolution[ 0 ] * ( coords[ 1 ] + resolution[ 1 ] * coords[ 2 ] ); };
+
+    // Cast a line through every row of voxel centres along each axis, a voxel is inside for that axis if an odd number of
+    // crossings come before it. Voting over the three axes hides the odd miscounted crossing through a shared vertex
+    std::vector<unsigned char> insideVotes( volume.m_Distances.size(), 0 );
+    std::vector<float> crossings;
+    for ( int axis = 0; axis < 3; axis++ )
+    {
+        int axisU = ( axis + 1 ) % 3;
+        int axisV = ( axis + 2 ) % 3;
+
+        for ( int v = 0; v < resolution[ axisV ]; v++ )
+        {
+            for ( int u = 0; u < resolution[ axisU ]; u++ )
+            {
+                crossings.clear();
+                for ( int t = 0; t < numTriangles; t++ )
+                {
+                    float crossing;
+                    if ( IntersectAxisLine( axis, voxelCentre( axisU, u ), voxelCentre( axisV, v ), triangles[ t * 3 ], triangles[ t * 3 + 1 ], triangles[ t * 3 + 2 ], crossing ) )
+                        crossings.push_back( crossing );
+                }
+                std::sort( crossings.begin(), crossings.end() );
+
+                size_t numBefore = 0;
+                for ( int i = 0; i < resolution[ axis ]; i++ )
+                {
+                    float centre = voxelCentre( axis, i );
+                    while ( numBefore < crossings.size() && crossings[ numBefore ] < centre )
+                        numBefore++;
+
+                    int coords[ 3 ];
+                    coords[ axis ] = i;
+                    coords[ axisU ] = u;
+                    coords[ axisV ] = v;
+                    insideVotes[ voxelIndex( coords ) ] += ( numBefore & 1 ) ? 1 : 0;
+                }
+            }
+        }
+    }
+
+    // Brute force distance to the nearest triangle. This is meant for baking simplified collision proxies offline
+    for ( int z = 0; z < resolution[ 2 ]; z++ )
+    {
+        for ( int y = 0; y < resolution[ 1 ]; y++ )
+        {
+            for ( int x = 0; x < resolution[ 0 ]; x++ )
+            {
+                Float3 p = { voxelCentre( 0, x ), voxelCentre( 1, y ), voxelCentre( 2, z ) };
+
+                float minDistanceSq = FLT_MAX;
+                for ( int t = 0; t < numTriangles; t++ )
+                {
+                    Float3 delta = p - ClosestPointOnTriangle( p, triangles[ t * 3 ], triangles[ t * 3 + 1 ], triangles[ t * 3 + 2 ] );
+                    minDistanceSq = std::min( minDistanceSq, dot( delta, delta ) );
+                }
+
+                int coords[ 3 ] = { x, y, z };
+                int index = voxelIndex( coords );
+                float distance = std::sqrt( minDistanceSq );
+                volume.m_Distances[ index ] = insideVotes[ index ] >= 2 ? -distance : distance;
+            }
+        }
+    }
+
+    return true;
+}
+
+
+bool SampleParticleCollisionVolume( const ParticleCollisionVolume& volume, const float position[ 3 ], float gradientAndDistance[ 4 ] )
+{
+    int cell[ 3 ];
+    float frac[ 3 ];
+    for ( int axis = 0; axis < 3; axis++ )
+    {
+        int resolution = volume.m_Resolution[ axis ];
+        if ( resolution < 2 )
+            return false;
+
+        float local = ( position[ axis ] - volume.m_BoundsMin[ axis ] ) / volume.m_VoxelSize;
+        if ( local < 0.0f || local > (float)resolution )
+            return false;
+
+        // Voxel centres are at half integer coordinates, clamp to the outermost ones
+        float coord = std::min( std::max( local - 0.5f, 0.0f ), (float)( resolution - 1 ) );
+        cell[ axis ] = std::min( (int)coord, resolution - 2 );
+        frac[ axis ] = coord - (float)cell[ axis ];
+    }
+
+    auto load = [ & ]( int dx, int dy, int dz )
+    {
+        int x = cell[ 0 ] + dx;
+        int y = cell[ 1 ] + dy;
+        int z = cell[ 2 ] + dz;
+        return volume.m_Distances[ x + volume.m_Resolution[ 0 ] * ( y + volume.m_Resolution[ 1 ] * z ) ];
+    };
+
+    float d000 = load( 0, 0, 0 ), d100 = load( 1, 0, 0 ), d010 = load( 0, 1, 0 ), d110 = load( 1, 1, 0 );
+    float d001 = load( 0, 0, 1 ), d101 = load( 1, 0, 1 ), d011 = load( 0, 1, 1 ), d111 = load( 1, 1, 1 );
+
+    float fx = frac[ 0 ], fy = frac[ 1 ], fz = frac[ 2 ];
+
+    // Blend along X first, the gradient is the derivative of the trilinear blend within the cell
+    float d00 = d000 + ( d100 - d000 ) * fx;
+    float d10 = d010 + ( d110 - d010 ) * fx;
+    float d01 = d001 + ( d101 - d001 ) * fx;
+    float d11 = d011 + ( d111 - d011 ) * fx;
+
+    float d0 = d00 + ( d10 - d00 ) * fy;
+    float d1 = d01 + ( d11 - d01 ) * fy;
+
+    float gx0 = ( d100 - d000 ) + ( ( d110 - d010 ) - ( d100 - d000 ) ) * fy;
+    float gx1 = ( d101 - d001 ) + ( ( d111 - d011 ) - ( d101 - d001 ) ) * fy;
+
+    gradientAndDistance[ 0 ] = ( gx0 + ( gx1 - gx0 ) * fz ) / volume.m_VoxelSize;
+    gradientAndDistance[ 1 ] = ( ( d10 - d00 ) + ( ( d11 - d01 ) - ( d10 - d00 ) ) * fz ) / volume.m_VoxelSize;
+    gradientAndDistance[ 2 ] = ( d1 - d0 ) / volume.m_VoxelSize;
+    gradientAndDistance[ 3 ] = d0 + ( d1 - d0 ) * fz;
+    return true;
+}
+
+
+void SimulateParticleCollisionReference( const ParticleCollisionVolume& volume, float bounce, float friction, float frameTime, ParticleCollisionReferenceState* pParticles, int numParticles )
+{
+    const float gravity = -9.81f;
+    const float wind = 0.1f * 0.70710678f;     // normalize( float3( 1, 1, 0 ) ) * 0.1
+
+    for ( int i = 0; i < numParticles; i++ )
+    {
+        ParticleCollisionReferenceState& particle = pParticles[ i ];
+
+        particle.m_Velocity[ 1 ] += particle.m_Mass * gravity * frameTime;
+
+        particle.m_Velocity[ 0 ] += wind * frameTime;
+        particle.m_Velocity[ 1 ] += wind * frameTime;
+
+        for ( int axis = 0; axis < 3; axis++ )
+            particle.m_Position[ axis ] += particle.m_Velocity[ axis ] * frameTime;
+
+        float gradientAndDistance[ 4 ];
+        if ( frameTime <= 0.0f || !SampleParticleCollisionVolume( volume, particle.m_Position, gradientAndDistance ) )
+            continue;
+
+        float penetration = particle.m_Radius - gradientAndDistance[ 3 ];
+        float gradientLength = std::sqrt( gradientAndDistance[ 0 ] * gradientAndDistance[ 0 ] + gradientAndDistance[ 1 ] * gradientAndDistance[ 1 ] + gradientAndDistance[ 2 ] * gradientAndDistance[ 2 ] );
+        if ( penetration <= 0.0f || gradientLength <= 0.0f )
+            continue;
+
+        float normal[ 3 ] = { gradientAndDistance[ 0 ] / gradientLength, gradientAndDistance[ 1 ] / gradientLength, gradientAndDistance[ 2 ] / gradientLength };
+
+        // Push the particle back out to the surface
+        for ( int axis = 0; axis < 3; axis++ )
+            particle.m_Position[ axis ] += normal[ axis ] * penetration;
+
+        // Only respond if the particle is still moving into the surface
+        float normalSpeed = particle.m_Velocity[ 0 ] * normal[ 0 ] + particle.m_Velocity[ 1 ] * normal[ 1 ] + particle.m_Velocity[ 2 ] * normal[ 2 ];
+        if ( normalSpeed < 0.0f )
+        {
+            for ( int axis = 0; axis < 3; axis++ )
+            {
+                float normalVelocity = normalSpeed * normal[ axis ];
+                float tangentVelocity = particle.m_Velocity[ axis ] - normalVelocity;
+                particle.m_Velocity[ axis ] = ( 1.0f - friction ) * tangentVelocity - bounce * normalVelocity;
+            }
+        }
+
+        particle.m_CollisionCount++;
+    }
+}
@@ -0,0 +1,61 @@
+//
+// Copyright (c) 2021 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#pragma once
+
+#include <vector>
+
+// The volume is uploaded as a 2D texture with the Z slices stacked vertically, so Y * Z resolution can't exceed the texture size limit
+static const int g_maxCollisionVolumeAtlasHeight = 16384;
+
+// A world space signed distance field that the particles collide with when PF_SDFCollision is set. Unlike the depth buffer it
+// covers geometry that is off screen or occluded and doesn't depend on the render resolution
+struct ParticleCollisionVolume
+{
+    float               m_BoundsMin[ 3 ] = {};      // World position of the corner of the first voxel
+    float               m_VoxelSize = 1.0f;         // Size of a voxel in world units
+    int                 m_Resolution[ 3 ] = {};     // Number of voxels in X, Y and Z
+    std::vector<float>  m_Distances;                // Signed distance at each voxel centre, X fastest then Y then Z. Negative inside
+};
+
+// Bake the signed distance field of an indexed triangle mesh. positions holds 3 floats per vertex and indices 3 per triangle.
+// The volume covers the bounds of the mesh grown by padding on each side. The sign comes from a majority vote of the ray
+// crossing parity along each axis, so the mesh should be closed but the winding doesn't matter. Returns false if the mesh is
+// empty or the volume would be too large to upload
+bool BakeParticleCollisionVolume( const float* positions, int numVertices, const unsigned int* indices, int numIndices, float voxelSize, float padding, ParticleCollisionVolume& volume );
+
+// Trilinear sample of the volume at a world position, matching sampleCollisionVolume in ParticleSimulation.hlsl. Returns the
+// gradient of the distance in xyz and the distance in w. Positions outside the volume return false
+bool SampleParticleCollisionVolume( const ParticleCollisionVolume& volume, const float position[ 3 ], float gradientAndDistance[ 4 ] );
+
+// The part of a particle's state that the collision reference integrates
+struct ParticleCollisionReferenceState
+{
+    float   m_Position[ 3 ] = {};
+    float   m_Velocity[ 3 ] = {};
+    float   m_Mass = 0.0f;
+    float   m_Radius = 0.0f;
+    int     m_CollisionCount = 0;
+};
+
+// CPU reference of one CS_Simulate step for particles that are awake: gravity, wind, integration and the response to the
+// collision volume, with bounce scaling the velocity along the surface normal and friction removing part of the rest
+void SimulateParticleCollisionReference( const ParticleCollisionVolume& volume, float bounce, float friction, float frameTime, ParticleCollisionReferenceState* pParticles, int numParticles );
@@ -0,0 +1,77 @@
+//
+// Copyright (c) 2021 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#include "ParticleOIT.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+
+float ParticleOITWeight( float alpha, float viewDepth )
+{
+    viewDepth = fabsf( viewDepth );
+    return alpha * std::min( std::max( expf( -viewDepth / 25.0f ), 1e-2f ), 1.0f );
+}
+
+
+void ResolveParticleOITReference( const ParticleOITFragment* pFragments, int numFragments, const float sceneColor[ 3 ], float result[ 3 ] )
+{
+    // Additive accumulation of the weighted premultiplied color and coverage, multiplicative revealage
+    float accumulation[ 4 ] = {};
+    float revealage = 1.0f;
+    for ( int i = 0; i < numFragments; i++ )
+    {
+        const float* color = pFragments[ i ].m_Color;
+        const float weight = ParticleOITWeight( color[ 3 ], pFragments[ i ].m_ViewDepth );
+        for ( int c = 0; c < 3; c++ )
+            accumulation[ c ] += color[ c ] * color[ 3 ] * weight;
+        accumulation[ 3 ] += color[ 3 ] * weight;
+        revealage *= 1.0f - color[ 3 ];
+    }
+
+    // Pixels without particles are discarded by the resolve
+    if ( revealage >= 1.0f )
+    {
+        std::copy( sceneColor, sceneColor + 3, result );
+        return;
+    }
+
+    for ( int c = 0; c < 3; c++ )
+    {
+        const float averageColor = accumulation[ c ] / std::max( accumulation[ 3 ], 1e-5f );
+        result[ c ] = averageColor * ( 1.0f - revealage ) + sceneColor[ c ] * revealage;
+    }
+}
+
+
+void BlendParticlesSortedReference( const ParticleOITFragment* pFragments, int numFragments, const float sceneColor[ 3 ], float result[ 3 ] )
+{
+    std::vector<ParticleOITFragment> sorted( pFragments, pFragments + numFragments );
+    std::stable_sort( sorted.begin(), sorted.end(), []( const ParticleOITFragment& a, const ParticleOITFragment& b ) { return fabsf( a.m_ViewDepth ) > fabsf( b.m_ViewDepth ); } );
+
+    std::copy( sceneColor, sceneColor + 3, result );
+    for ( const ParticleOITFragment& fragment : sorted )
+    {
+        for ( int c = 0; c < 3; c++ )
+            result[ c ] = fragment.m_Color[ c ] * fragment.m_Color[ 3 ] + result[ c ] * ( 1.0f - fragment.m_Color[ 3 ] );
+    }
+}
@@ -0,0 +1,39 @@
+//
+// Copyright (c) 2021 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#pragma once
+
+// One particle fragment covering a pixel, its lit color with alpha and its view space depth
+struct ParticleOITFragment
+{
+    float   m_Color[ 4 ] = {};
+    float   m_ViewDepth = 0.0f;
+};
+
+// The weight of a fragment in the accumulation target, matching PS_Billboard with OIT defined
+float ParticleOITWeight( float alpha, float viewDepth );
+
+// CPU reference of the OIT accumulation and revealage blends followed by PS_ResolveOIT over the scene color of one pixel.
+// The fragments can be in any order
+void ResolveParticleOITReference( const ParticleOITFragment* pFragments, int numFragments, const float sceneColor[ 3 ], float result[ 3 ] );
+
+// Back to front alpha blending of the same fragments, what the sorted render path produces
+void BlendParticlesSortedReference( const ParticleOITFragment* pFragments, int numFragments, const float sceneColor[ 3 ], float result[ 3 ] );
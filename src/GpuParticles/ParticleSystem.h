@@ -22,6 +22,7 @@
 #pragma once
 
 #include "stdafx.h"
+#include "ParticleCollision.h"
 
 // Implementation-agnostic particle system interface
 struct IParticleSystem
@@ -31,7 +32,9 @@ struct IParticleSystem
         PF_Sort                     = 1 << 0,      // Sort the particles
         PF_DepthCull                = 1 << 1,      // Do per-tile depth buffer culling
         PF_Streaks                  = 1 << 2,      // Streak the particles based on velocity
-        PF_Reactive                 = 1 << 3       // Particles also write to the reactive mask
+        PF_Reactive                 = 1 << 3,      // Particles also write to the reactive mask
+        PF_OIT                      = 1 << 4,      // Weighted blended order independent transparency, no sort needed. Vulkan only, the DX12 particle system ignores it
+        PF_SDFCollision             = 1 << 5       // Collide the particles with the volume given to SetCollisionVolume
     };
 
     // Per-emitter parameters
@@ -48,6 +51,7 @@ struct IParticleSystem
         float           m_VelocityVariance = 0.0f;  // Variance in velocity of each particle
         int             m_TextureIndex = 0;         // Index of the texture in the atlas
         bool            m_Streaks = false;          // Streak the particles in the direction of travel
+        int             m_ColorIndex = -1;          // Index of the colors and lighting center in ConstantData, the index of the emitter when negative
     };
 
     struct ConstantData
@@ -67,6 +71,14 @@ struct IParticleSystem
         math::Vector4   m_AmbientColor = {};
 
         float           m_FrameTime = 0.0f;
+
+        // Reactive mask written by PF_Reactive is min( max( rgb ) * alpha * scale, max )
+        float           m_ReactiveScale = 1.0f;
+        float           m_ReactiveMax = 1.0f;
+
+        // Response to PF_SDFCollision. Bounce scales the velocity into the surface, friction is the fraction of the velocity along it lost per collision
+        float           m_CollisionBounce = 0.5f;
+        float           m_CollisionFriction = 0.1f;
     };
 
     // Create a GPU particle system. Add more factory functions to create other types of system eg CPU-updated system
@@ -85,6 +97,9 @@ struct IParticleSystem
     virtual void OnResizedSwapChain( int width, int height, Texture& depthBuffer, VkFramebuffer frameBuffer ) = 0;
 #endif
 
+    // The volume is copied and uploaded in OnCreateDevice, so set it before then. Calls after OnCreateDevice are ignored
+    virtual void SetCollisionVolume( const ParticleCollisionVolume& volume ) = 0;
+
     virtual void OnReleasingSwapChain() = 0;
     virtual void OnDestroyDevice() = 0;
 
@@ -68,18 +68,22 @@ struct SimulationConstantBuffer
     float           m_FrameTime = 0.0f;
 
     int             m_MaxParticles = 0;
+    int             m_CollideWithVolume = 0;
+    float           m_CollisionBounce = 0.0f;
+    float           m_CollisionFriction = 0.0f;
+
+    math::Vector4   m_CollisionVolumeMin = {};      // xyz is the corner of the volume, w the size of a voxel
+    UINT            m_CollisionVolumeResolution[ 3 ] = {};
     UINT            m_pad01 = 0;
-    UINT            m_pad02 = 0;
-    UINT            m_pad03 = 0;
 };
 
-struct EmitterConstantBuffer
+struct EmitterData
 {
     math::Vector4    m_EmitterPosition = {};
     math::Vector4    m_EmitterVelocity = {};
     math::Vector4    m_PositionVariance = {};
 
-    int             m_MaxParticlesThisFrame = 0;
+    int             m_EmitStart = 0;
     float           m_ParticleLifeSpan = 0.0f;
     float           m_StartSize = 0.0f;
     float           m_EndSize = 0.0f;
@@ -93,6 +97,50 @@ struct EmitterConstantBuffer
     int             m_pads[ 3 ] = {};
 };
 
+struct EmitterConstantBuffer
+{
+    int             m_NumEmitters = 0;
+    int             m_MaxParticlesThisFrame = 0;
+    int             m_pads[ 2 ] = {};
+
+    EmitterData     m_Emitters[ NUM_EMITTERS_PER_DISPATCH ] = {};
+};
+
+
+// Packs the emitters with particles to spawn into the emitter constant buffer, starting at firstEmitter. Returns the emitter to continue
+// from when there are more than NUM_EMITTERS_PER_DISPATCH of them
+inline int FillEmitterConstants( EmitterConstantBuffer& constants, int firstEmitter, int numEmitters, const IParticleSystem::EmitterParams* emitters )
+{
+    constants.m_NumEmitters = 0;
+    constants.m_MaxParticlesThisFrame = 0;
+
+    int i = firstEmitter;
+    for ( ; i < numEmitters && constants.m_NumEmitters < NUM_EMITTERS_PER_DISPATCH; i++ )
+    {
+        const IParticleSystem::EmitterParams& emitter = emitters[ i ];
+        if ( emitter.m_NumToEmit <= 0 )
+            continue;
+
+        EmitterData& data = constants.m_Emitters[ constants.m_NumEmitters++ ];
+        data.m_EmitterPosition = emitter.m_Position;
+        data.m_EmitterVelocity = emitter.m_Velocity;
+        data.m_EmitStart = constants.m_MaxParticlesThisFrame;
+        data.m_ParticleLifeSpan = emitter.m_ParticleLifeSpan;
+        data.m_StartSize = emitter.m_StartSize;
+        data.m_EndSize = emitter.m_EndSize;
+        data.m_PositionVariance = emitter.m_PositionVariance;
+        data.m_VelocityVariance = emitter.m_VelocityVariance;
+        data.m_Mass = emitter.m_Mass;
+        data.m_Index = ( emitter.m_ColorIndex >= 0 ) ? emitter.m_ColorIndex : i;
+        data.m_Streaks = emitter.m_Streaks ? 1 : 0;
+        data.m_TextureIndex = emitter.m_TextureIndex;
+
+        constants.m_MaxParticlesThisFrame += emitter.m_NumToEmit;
+    }
+
+    return i;
+}
+
 
 // The rasterization path constant buffer
 struct RenderingConstantBuffer
@@ -104,7 +152,8 @@ struct RenderingConstantBuffer
     math::Vector4    m_SunDirectionVS = {};
     UINT        m_ScreenWidth = 0;
     UINT        m_ScreenHeight = 0;
-    UINT        m_pads[ 2 ] = {};
+    float       m_ReactiveScale = 1.0f;
+    float       m_ReactiveMax = 1.0f;
 };
 
 struct CullingConstantBuffer
@@ -75,6 +75,7 @@ private:
     virtual void OnDestroyDevice();
 
     virtual void Reset();
+    virtual void SetCollisionVolume( const ParticleCollisionVolume& volume );
 
     virtual void Render( ID3D12GraphicsCommandList* pCommandList, DynamicBufferRing& constantBufferRing, int flags, const EmitterParams* pEmitters, int nNumEmitters, const ConstantData& constantData );
 
@@ -83,6 +84,7 @@ private:
     void Sort( ID3D12GraphicsCommandList* pCommandList );
 
     void FillRandomTexture( UploadHeap& uploadHeap );
+    void FillCollisionVolumeTexture( UploadHeap& uploadHeap );
 
     void CreateSimulationAssets();
     void CreateRasterizedRenderingAssets();
@@ -103,11 +105,14 @@ private:
     Texture                     m_RenderingBuffer = {};
     Texture                     m_IndirectArgsBuffer = {};
     Texture                     m_RandomTexture = {};
+    Texture                     m_CollisionVolumeTexture = {};
+
+    ParticleCollisionVolume     m_CollisionVolume = {};
 
     const int                   m_SimulationUAVDescriptorTableCount = 9;
     CBV_SRV_UAV                 m_SimulationUAVDescriptorTable = {};
 
-    const int                   m_SimulationSRVDescriptorTableCount = 2;
+    const int                   m_SimulationSRVDescriptorTableCount = 3;
     CBV_SRV_UAV                 m_SimulationSRVDescriptorTable = {};
 
     const int                   m_RasterizationSRVDescriptorTableCount = 6;
@@ -167,6 +172,17 @@ void GPUParticleSystem::Reset()
     m_ResetSystem = true;
 }
 
+
+void GPUParticleSystem::SetCollisionVolume( const ParticleCollisionVolume& volume )
+{
+    // The texture is only uploaded in OnCreateDevice. Ignore later calls so the constants keep matching the uploaded volume
+    assert( m_pDevice == nullptr && "SetCollisionVolume must be called before OnCreateDevice" );
+    if ( m_pDevice != nullptr )
+        return;
+
+    m_CollisionVolume = volume;
+}
+
 void GPUParticleSystem::Render( ID3D12GraphicsCommandList* pCommandList, DynamicBufferRing& constantBufferRing, int flags, const EmitterParams* pEmitters, int nNumEmitters, const ConstantData& constantData )
 {
     std::vector<D3D12_RESOURCE_BARRIER> barriersBeforeSimulation;
@@ -201,6 +217,17 @@ void GPUParticleSystem::Render( ID3D12GraphicsCommandList* pCommandList, Dynamic
     simulationConstants.m_MaxParticles = g_maxParticles;
     simulationConstants.m_FrameTime = constantData.m_FrameTime;
 
+    if ( ( flags & PF_SDFCollision ) && !m_CollisionVolume.m_Distances.empty() )
+    {
+        simulationConstants.m_CollideWithVolume = 1;
+        simulationConstants.m_CollisionBounce = constantData.m_CollisionBounce;
+        simulationConstants.m_CollisionFriction = constantData.m_CollisionFriction;
+        simulationConstants.m_CollisionVolumeMin = math::Vector4( m_CollisionVolume.m_BoundsMin[ 0 ], m_CollisionVolume.m_BoundsMin[ 1 ], m_CollisionVolume.m_BoundsMin[ 2 ], m_CollisionVolume.m_VoxelSize );
+        simulationConstants.m_CollisionVolumeResolution[ 0 ] = m_CollisionVolume.m_Resolution[ 0 ];
+        simulationConstants.m_CollisionVolumeResolution[ 1 ] = m_CollisionVolume.m_Resolution[ 1 ];
+        simulationConstants.m_CollisionVolumeResolution[ 2 ] = m_CollisionVolume.m_Resolution[ 2 ];
+    }
+
     math::Vector4 sunDirectionVS = constantData.m_View * constantData.m_SunDirection;
 
     m_ElapsedTime += constantData.m_FrameTime;
@@ -296,6 +323,8 @@ void GPUParticleSystem::Render( ID3D12GraphicsCommandList* pCommandList, Dynamic
         cb->m_SunDirectionVS = sunDirectionVS;
         cb->m_ScreenWidth = m_ScreenWidth;
         cb->m_ScreenHeight = m_ScreenHeight;
+        cb->m_ReactiveScale = constantData.m_ReactiveScale;
+        cb->m_ReactiveMax = constantData.m_ReactiveMax;
 
         pCommandList->SetGraphicsRootSignature( m_pRasterizationRootSignature );
         pCommandList->SetGraphicsRootDescriptorTable( 0, m_RasterizationSRVDescriptorTable.GetGPU() );
@@ -393,6 +422,9 @@ void GPUParticleSystem::OnCreateDevice(Device &device, UploadHeap& uploadHeap, R
     // Initialize the random numbers texture
     FillRandomTexture( uploadHeap );
 
+    // Upload the signed distance field for PF_SDFCollision
+    FillCollisionVolumeTexture( uploadHeap );
+
     m_Atlas.InitFromFile( &device, &uploadHeap, m_AtlasPath, true );
 
     CreateSimulationAssets();
@@ -419,11 +451,12 @@ void GPUParticleSystem::CreateSimulationAssets()
     m_heaps->AllocCBV_SRV_UAVDescriptor( m_SimulationSRVDescriptorTableCount, &m_SimulationSRVDescriptorTable );
     // depth buffer                                                     // t0
     m_RandomTexture.CreateSRV( 1, &m_SimulationSRVDescriptorTable );    // t1
+    m_CollisionVolumeTexture.CreateSRV( 2, &m_SimulationSRVDescriptorTable );   // t2
 
     {
         CD3DX12_DESCRIPTOR_RANGE DescRange[2] = {};
         DescRange[0].Init( D3D12_DESCRIPTOR_RANGE_TYPE_UAV, m_SimulationUAVDescriptorTableCount, 0 );             // u0 - u8
-        DescRange[1].Init( D3D12_DESCRIPTOR_RANGE_TYPE_SRV, m_SimulationSRVDescriptorTableCount, 0 );             // t0 - t1
+        DescRange[1].Init( D3D12_DESCRIPTOR_RANGE_TYPE_SRV, m_SimulationSRVDescriptorTableCount, 0 );             // t0 - t2
 
         CD3DX12_ROOT_PARAMETER rootParamters[4] = {};
         rootParamters[0].InitAsDescriptorTable( 1, &DescRange[0], D3D12_SHADER_VISIBILITY_ALL ); // uavs
@@ -535,6 +568,13 @@ void GPUParticleSystem::CreateRasterizedRenderingAssets()
     descPso.BlendState.RenderTarget[0].DestBlendAlpha = D3D12_BLEND_ZERO;
     descPso.BlendState.RenderTarget[0].BlendOpAlpha = D3D12_BLEND_OP_ADD;
 
+    descPso.BlendState.RenderTarget[2].SrcBlend = D3D12_BLEND_ONE;
+    descPso.BlendState.RenderTarget[2].DestBlend = D3D12_BLEND_ONE;
+    descPso.BlendState.RenderTarget[2].BlendOp = D3D12_BLEND_OP_MAX;
+    descPso.BlendState.RenderTarget[2].SrcBlendAlpha = D3D12_BLEND_ONE;
+    descPso.BlendState.RenderTarget[2].DestBlendAlpha = D3D12_BLEND_ONE;
+    descPso.BlendState.RenderTarget[2].BlendOpAlpha = D3D12_BLEND_OP_MAX;
+
     descPso.BlendState.RenderTarget[0].RenderTargetWriteMask = D3D12_COLOR_WRITE_ENABLE_ALL;
     descPso.BlendState.RenderTarget[1].RenderTargetWriteMask = 0;
     descPso.BlendState.RenderTarget[2].RenderTargetWriteMask = 0;
@@ -629,6 +669,7 @@ void GPUParticleSystem::OnDestroyDevice()
     m_AliveDistanceBuffer.OnDestroy();
     m_AliveCountBuffer.OnDestroy();
     m_RandomTexture.OnDestroy();
+    m_CollisionVolumeTexture.OnDestroy();
     m_Atlas.OnDestroy();
     m_IndirectArgsBuffer.OnDestroy();
 
@@ -670,32 +711,21 @@ void GPUParticleSystem::Emit( ID3D12GraphicsCommandList* pCommandList, DynamicBu
 {
     pCommandList->SetPipelineState( m_pEmitPipeline );
 
-    // Run CS for each emitter
-    for ( int i = 0; i < numEmitters; i++ )
+    // Run CS once for all the emitters, each thread finds its emitter from the prefix sum of the emit counts
+    int nextEmitter = 0;
+    while ( nextEmitter < numEmitters )
     {
-        const EmitterParams& emitter = emitters[ i ];
+        EmitterConstantBuffer* constants = nullptr;
+        D3D12_GPU_VIRTUAL_ADDRESS constantBuffer;
+        constantBufferRing.AllocConstantBuffer( sizeof(*constants), (void**)&constants, &constantBuffer );
+        nextEmitter = FillEmitterConstants( *constants, nextEmitter, numEmitters, emitters );
 
-        if ( emitter.m_NumToEmit > 0 )
+        if ( constants->m_MaxParticlesThisFrame > 0 )
         {
-            EmitterConstantBuffer* constants = nullptr;
-            D3D12_GPU_VIRTUAL_ADDRESS constantBuffer;
-            constantBufferRing.AllocConstantBuffer( sizeof(*constants), (void**)&constants, &constantBuffer );
-            constants->m_EmitterPosition = emitter.m_Position;
-            constants->m_EmitterVelocity = emitter.m_Velocity;
-            constants->m_MaxParticlesThisFrame = emitter.m_NumToEmit;
-            constants->m_ParticleLifeSpan = emitter.m_ParticleLifeSpan;
-            constants->m_StartSize = emitter.m_StartSize;
-            constants->m_EndSize = emitter.m_EndSize;
-            constants->m_PositionVariance = emitter.m_PositionVariance;
-            constants->m_VelocityVariance = emitter.m_VelocityVariance;
-            constants->m_Mass = emitter.m_Mass;
-            constants->m_Index = i;
-            constants->m_Streaks = emitter.m_Streaks ? 1 : 0;
-            constants->m_TextureIndex = emitter.m_TextureIndex;
             pCommandList->SetComputeRootConstantBufferView( 3, constantBuffer );
 
             // Dispatch enough thread groups to spawn the requested particles
-            int numThreadGroups = align( emitter.m_NumToEmit, 1024 ) / 1024;
+            int numThreadGroups = align( constants->m_MaxParticlesThisFrame, 1024 ) / 1024;
             pCommandList->Dispatch( numThreadGroups, 1, 1 );
 
             pCommandList->ResourceBarrier( 1, &CD3DX12_RESOURCE_BARRIER::UAV( m_DeadListBuffer.GetResource() ) );
@@ -743,3 +773,22 @@ void GPUParticleSystem::FillRandomTexture( UploadHeap& uploadHeap )
 
     delete[] values;
 }
+
+
+// Upload the collision volume with its Z slices stacked vertically. Without a volume a single texel keeps the descriptor valid
+void GPUParticleSystem::FillCollisionVolumeTexture( UploadHeap& uploadHeap )
+{
+    const float emptyVolume = FLT_MAX;
+    bool hasVolume = !m_CollisionVolume.m_Distances.empty();
+
+    IMG_INFO header = {};
+    header.width = hasVolume ? m_CollisionVolume.m_Resolution[ 0 ] : 1;
+    header.height = hasVolume ? m_CollisionVolume.m_Resolution[ 1 ] * m_CollisionVolume.m_Resolution[ 2 ] : 1;
+    header.depth = 1;
+    header.arraySize = 1;
+    header.mipMapCount = 1;
+    header.format = DXGI_FORMAT_R32_FLOAT;
+    header.bitCount = 32;
+
+    m_CollisionVolumeTexture.InitFromData( m_pDevice, "CollisionVolume", uploadHeap, header, hasVolume ? m_CollisionVolume.m_Distances.data() : &emptyVolume );
+}
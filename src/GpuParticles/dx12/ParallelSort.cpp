@@ -44,7 +44,7 @@ void FFXParallelSort::CompileRadixPipeline(const char* shaderFile, const DefineL
 	SetName(pPipeline, entryPoint);
 }
 
-void FFXParallelSort::OnCreate(Device* pDevice, ResourceViewHeaps* pResourceViewHeaps, DynamicBufferRing* pConstantBufferRing, UploadHeap* pUploadHeap, Texture* elementCount, Texture* listA, Texture* listB)
+void FFXParallelSort::OnCreate(Device* pDevice, ResourceViewHeaps* pResourceViewHeaps, DynamicBufferRing* pConstantBufferRing, UploadHeap* pUploadHeap, Texture* elementCount, Texture* listA, Texture* listB, Texture* segmentHeads, uint32_t segmentBits)
 {
 	m_pDevice = pDevice;
 	m_pUploadHeap = pUploadHeap;
@@ -52,6 +52,8 @@ void FFXParallelSort::OnCreate(Device* pDevice, ResourceViewHeaps* pResourceView
 	m_pConstantBufferRing = pConstantBufferRing;
     m_SrcKeyBuffer = listA;
     m_SrcPayloadBuffer = listB;
+    m_SegmentHeadsBuffer = segmentHeads;
+    m_SegmentBits = segmentHeads ? segmentBits : 0;
     m_MaxNumThreadgroups = 800;
 
     // Allocate UAVs to use for data
@@ -66,6 +68,8 @@ void FFXParallelSort::OnCreate(Device* pDevice, ResourceViewHeaps* pResourceView
 	m_pResourceViewHeaps->AllocCBV_SRV_UAVDescriptor(1, &m_IndirectConstantBufferUAV);
 	m_pResourceViewHeaps->AllocCBV_SRV_UAVDescriptor(1, &m_IndirectCountScatterArgsUAV);
 	m_pResourceViewHeaps->AllocCBV_SRV_UAVDescriptor(1, &m_IndirectReduceScanArgsUAV);
+	if (m_SegmentHeadsBuffer)
+		m_pResourceViewHeaps->AllocCBV_SRV_UAVDescriptor(1, &m_SegmentHeadsUAV);
 
 	// The DstKey and DstPayload buffers will be used as src/dst when sorting. A copy of the 
 	// source key/payload will be copied into them before hand so we can keep our original values
@@ -94,6 +98,8 @@ void FFXParallelSort::OnCreate(Device* pDevice, ResourceViewHeaps* pResourceView
 	m_DstPayloadTempBuffer[1].CreateBufferUAV(1, nullptr, &m_DstPayloadUAVTable);
 
     elementCount->CreateSRV( 0, &m_ElementCountSRV, 0 );
+	if (m_SegmentHeadsBuffer)
+		m_SegmentHeadsBuffer->CreateBufferUAV(0, nullptr, &m_SegmentHeadsUAV);
 
 	// We are just going to fudge the indirect execution parameters for each resolution
 	ResourceDesc = CD3DX12_RESOURCE_DESC::Buffer(sizeof(uint32_t), D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS);
@@ -142,8 +148,8 @@ void FFXParallelSort::OnCreate(Device* pDevice, ResourceViewHeaps* pResourceView
 	}
 	// Create root signature for Radix sort passes
 	{
-		D3D12_DESCRIPTOR_RANGE descRange[16];
-		D3D12_ROOT_PARAMETER rootParams[17];
+		D3D12_DESCRIPTOR_RANGE descRange[17];
+		D3D12_ROOT_PARAMETER rootParams[18];
 
 		// Constant buffer table (always have 1)
 		descRange[0] = { D3D12_DESCRIPTOR_RANGE_TYPE_CBV, 1, 0, 0, D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND };
@@ -227,8 +233,13 @@ void FFXParallelSort::OnCreate(Device* pDevice, ResourceViewHeaps* pResourceView
 		rootParams[16].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE; rootParams[16].ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL;
 		rootParams[16].DescriptorTable = { 1, &descRange[15] };
 
+		// SegmentHeads (segmented sort only)
+		descRange[16] = { D3D12_DESCRIPTOR_RANGE_TYPE_UAV, 1, 0, 13, D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND };
+		rootParams[17].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE; rootParams[17].ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL;
+		rootParams[17].DescriptorTable = { 1, &descRange[16] };
+
 		D3D12_ROOT_SIGNATURE_DESC rootSigDesc = {};
-		rootSigDesc.NumParameters = 17;
+		rootSigDesc.NumParameters = 18;
 		rootSigDesc.pParameters = rootParams;
 		rootSigDesc.NumStaticSamplers = 0;
 		rootSigDesc.pStaticSamplers = nullptr;
@@ -278,6 +289,10 @@ void FFXParallelSort::OnCreate(Device* pDevice, ResourceViewHeaps* pResourceView
 		// Radix scatter with payload (key and payload redistribution)
 		defines["kRS_ValueCopy"] = std::to_string(1);
 		CompileRadixPipeline("ParallelSortCS.hlsl", &defines, "FPS_Scatter", m_pFPSScatterPayloadPipeline);
+
+		// Segment heads (segmented sort only)
+		if (m_SegmentHeadsBuffer)
+			CompileRadixPipeline("ParallelSortCS.hlsl", &defines, "FPS_SegmentHeads", m_pFPSSegmentHeadsPipeline);
 	}
 }
 
@@ -301,6 +316,8 @@ void FFXParallelSort::OnDestroy()
 	m_pFPSScanAddPipeline->Release();
 	m_pFPSScatterPipeline->Release();
 	m_pFPSScatterPayloadPipeline->Release();
+	if (m_pFPSSegmentHeadsPipeline)
+		m_pFPSSegmentHeadsPipeline->Release();
 
 	// Release all of our resources
 	m_DstKeyTempBuffer[0].OnDestroy();
@@ -513,6 +530,21 @@ void FFXParallelSort::Draw(ID3D12GraphicsCommandList* pCommandList)
 			std::swap(ReadPayloadBufferInfo, WritePayloadBufferInfo);
 	}
 
+	// Find where each segment starts in the sorted list, which is back in the source buffer after the 8 passes
+	if (m_SegmentHeadsBuffer)
+	{
+		pCommandList->SetComputeRoot32BitConstant(2, m_SegmentBits, 0);
+		pCommandList->SetComputeRootDescriptorTable(3, ReadBufferInfo->resourceGPUHandle);		// SrcBuffer
+		pCommandList->SetComputeRootDescriptorTable(17, m_SegmentHeadsUAV.GetGPU());			// SegmentHeads
+		pCommandList->SetPipelineState(m_pFPSSegmentHeadsPipeline);
+
+		// One thread per key plus one for the end of the list, the shader early outs past the indirect key count
+		pCommandList->Dispatch((NumKeys + FFX_PARALLELSORT_THREADGROUP_SIZE) / FFX_PARALLELSORT_THREADGROUP_SIZE, 1, 1);
+
+		barriers[0] = CD3DX12_RESOURCE_BARRIER::UAV(m_SegmentHeadsBuffer->GetResource());
+		pCommandList->ResourceBarrier(1, barriers);
+	}
+
 	// When we are all done, transition indirect buffers back to UAV for the next frame (if doing indirect dispatch)
 	if (bIndirectDispatch)
 	{
@@ -45,7 +45,7 @@ typedef struct RdxDX12ResourceInfo
 class FFXParallelSort
 {
 public:
-	void OnCreate(Device* pDevice, ResourceViewHeaps* pResourceViewHeaps, DynamicBufferRing* pConstantBufferRing, UploadHeap* pUploadHeap, Texture* elementCount, Texture* listA, Texture* listB);
+	void OnCreate(Device* pDevice, ResourceViewHeaps* pResourceViewHeaps, DynamicBufferRing* pConstantBufferRing, UploadHeap* pUploadHeap, Texture* elementCount, Texture* listA, Texture* listB, Texture* segmentHeads = nullptr, uint32_t segmentBits = 0);
 	void OnDestroy();
 
 	void Draw(ID3D12GraphicsCommandList* pCommandList);
@@ -67,6 +67,10 @@ private:
     CBV_SRV_UAV	m_SrcKeyUAV;		// 32 bit source key UAVs
 	CBV_SRV_UAV	m_SrcPayloadUAV;		// 32 bit source payload UAVs
 
+    Texture*    m_SegmentHeadsBuffer = nullptr;	// Optional first sorted index of each segment, keys then carry the segment in their top m_SegmentBits bits
+    CBV_SRV_UAV m_SegmentHeadsUAV;
+    uint32_t    m_SegmentBits = 0;
+
     Texture     m_DstKeyTempBuffer[ 2 ];
     CBV_SRV_UAV m_DstKeyUAVTable;		// 32 bit destination key UAVs
 
@@ -86,6 +90,7 @@ private:
 	ID3D12PipelineState* m_pFPSScanAddPipeline			= nullptr;
 	ID3D12PipelineState* m_pFPSScatterPipeline			= nullptr;
 	ID3D12PipelineState* m_pFPSScatterPayloadPipeline	= nullptr;
+	ID3D12PipelineState* m_pFPSSegmentHeadsPipeline		= nullptr;
 		
 	// Resources for indirect execution of algorithm
 	Texture		m_IndirectKeyCounts;			// Buffer to hold num keys for indirect dispatch
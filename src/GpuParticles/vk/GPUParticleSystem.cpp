@@ -113,6 +113,7 @@ private:
     virtual void OnDestroyDevice();
 
     virtual void Reset();
+    virtual void SetCollisionVolume( const ParticleCollisionVolume& volume );
 
     virtual void Render( VkCommandBuffer commandBuffer, DynamicBufferRing& constantBufferRing, int flags, const EmitterParams* pEmitters, int nNumEmitters, const ConstantData& constantData );
 
@@ -121,8 +122,10 @@ private:
     void Sort( VkCommandBuffer commandBuffer );
 
     void FillRandomTexture( UploadHeap& uploadHeap );
+    void FillCollisionVolumeTexture( UploadHeap& uploadHeap );
     void CreateSimulationAssets( DynamicBufferRing& constantBufferRing );
     void CreateRasterizedRenderingAssets( DynamicBufferRing& constantBufferRing );
+    void CreateOITRenderingAssets( DynamicBufferRing& constantBufferRing );
 
     VkPipeline CreatePipeline( const char* filename, const char* entry, VkPipelineLayout layout, const DefineList* defines );
 
@@ -149,8 +152,21 @@ private:
     Texture                     m_RandomTexture = {};
     VkImageView                 m_RandomTextureSRV = {};
 
+    Texture                     m_CollisionVolumeTexture = {};
+    VkImageView                 m_CollisionVolumeTextureSRV = {};
+    ParticleCollisionVolume     m_CollisionVolume = {};
+
     VkImage                     m_DepthBuffer = {};
     VkImageView                 m_DepthBufferSRV = {};
+    VkImageView                 m_DepthBufferDSV = {};
+
+    // Weighted blended OIT targets, accumulated without sorting then composited over the scene
+    VkRenderPass                m_OITRenderPass = VK_NULL_HANDLE;
+    VkFramebuffer               m_OITFrameBuffer = VK_NULL_HANDLE;
+    Texture                     m_OITAccumulation = {};
+    VkImageView                 m_OITAccumulationSRV = {};
+    Texture                     m_OITRevealage = {};
+    VkImageView                 m_OITRevealageSRV = {};
 
     VkDescriptorSetLayout       m_SimulationDescriptorSetLayout = VK_NULL_HANDLE;
     VkDescriptorSet             m_SimulationDescriptorSet = VK_NULL_HANDLE;
@@ -158,6 +174,9 @@ private:
     VkDescriptorSetLayout       m_RasterizationDescriptorSetLayout = VK_NULL_HANDLE;
     VkDescriptorSet             m_RasterizationDescriptorSet = VK_NULL_HANDLE;
 
+    VkDescriptorSetLayout       m_OITResolveDescriptorSetLayout = VK_NULL_HANDLE;
+    VkDescriptorSet             m_OITResolveDescriptorSet = VK_NULL_HANDLE;
+
     VkSampler                   m_samplers[ 3 ] = {};
 
     UINT                        m_ScreenWidth = 0;
@@ -171,11 +190,14 @@ private:
 
     VkPipelineLayout            m_SimulationPipelineLayout = VK_NULL_HANDLE;
     VkPipelineLayout            m_RasterizationPipelineLayout = VK_NULL_HANDLE;
+    VkPipelineLayout            m_OITResolvePipelineLayout = VK_NULL_HANDLE;
 
     VkPipeline                  m_SimulationPipeline = VK_NULL_HANDLE;
     VkPipeline                  m_EmitPipeline = VK_NULL_HANDLE;
     VkPipeline                  m_ResetParticlesPipeline = VK_NULL_HANDLE;
     VkPipeline                  m_RasterizationPipelines[ NumStreakModes ][ NumReactiveModes ] = {};
+    VkPipeline                  m_OITRasterizationPipelines[ NumStreakModes ] = {};
+    VkPipeline                  m_OITResolvePipelines[ NumReactiveModes ] = {};
 
     bool                        m_ResetSystem = true;
     FFXParallelSort             m_SortLib = {};
@@ -205,6 +227,17 @@ void GPUParticleSystem::Reset()
 }
 
 
+void GPUParticleSystem::SetCollisionVolume( const ParticleCollisionVolume& volume )
+{
+    // The texture is only uploaded in OnCreateDevice. Ignore later calls so the constants keep matching the uploaded volume
+    assert( m_pDevice == nullptr && "SetCollisionVolume must be called before OnCreateDevice" );
+    if ( m_pDevice != nullptr )
+        return;
+
+    m_CollisionVolume = volume;
+}
+
+
 void GPUParticleSystem::Render( VkCommandBuffer commandBuffer, DynamicBufferRing& constantBufferRing, int flags, const EmitterParams* pEmitters, int nNumEmitters, const ConstantData& constantData )
 {
     SimulationConstantBuffer simulationConstants = {};
@@ -226,6 +259,17 @@ void GPUParticleSystem::Render( VkCommandBuffer commandBuffer, DynamicBufferRing
     simulationConstants.m_MaxParticles = g_maxParticles;
     simulationConstants.m_FrameTime = constantData.m_FrameTime;
 
+    if ( ( flags & PF_SDFCollision ) && !m_CollisionVolume.m_Distances.empty() )
+    {
+        simulationConstants.m_CollideWithVolume = 1;
+        simulationConstants.m_CollisionBounce = constantData.m_CollisionBounce;
+        simulationConstants.m_CollisionFriction = constantData.m_CollisionFriction;
+        simulationConstants.m_CollisionVolumeMin = math::Vector4( m_CollisionVolume.m_BoundsMin[ 0 ], m_CollisionVolume.m_BoundsMin[ 1 ], m_CollisionVolume.m_BoundsMin[ 2 ], m_CollisionVolume.m_VoxelSize );
+        simulationConstants.m_CollisionVolumeResolution[ 0 ] = m_CollisionVolume.m_Resolution[ 0 ];
+        simulationConstants.m_CollisionVolumeResolution[ 1 ] = m_CollisionVolume.m_Resolution[ 1 ];
+        simulationConstants.m_CollisionVolumeResolution[ 2 ] = m_CollisionVolume.m_Resolution[ 2 ];
+    }
+
     math::Vector4 sunDirectionVS = constantData.m_View * constantData.m_SunDirection;
 
     m_ElapsedTime += constantData.m_FrameTime;
@@ -297,8 +341,10 @@ void GPUParticleSystem::Render( VkCommandBuffer commandBuffer, DynamicBufferRing
     {
         UserMarker marker( commandBuffer, "rasterization" );
 
-        // Sort if requested. Not doing so results in the particles rendering out of order and not blending correctly
-        if ( flags & PF_Sort )
+        // Sort if requested. Not doing so results in the particles rendering out of order and not blending correctly, unless
+        // they are composited with OIT which doesn't depend on the draw order
+        bool oit = ( flags & PF_OIT ) != 0;
+        if ( ( flags & PF_Sort ) && !oit )
         {
             UserMarker marker( commandBuffer, "sorting" );
 
@@ -325,6 +371,8 @@ void GPUParticleSystem::Render( VkCommandBuffer commandBuffer, DynamicBufferRing
         cb->m_SunDirectionVS = sunDirectionVS;
         cb->m_ScreenWidth = m_ScreenWidth;
         cb->m_ScreenHeight = m_ScreenHeight;
+        cb->m_ReactiveScale = constantData.m_ReactiveScale;
+        cb->m_ReactiveMax = constantData.m_ReactiveMax;
 
         uint32_t uniformOffsets[1] = { (uint32_t)constantBuffer.offset };
         vkCmdBindDescriptorSets( commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_RasterizationPipelineLayout, 0, 1, &m_RasterizationDescriptorSet, 1, uniformOffsets );
@@ -336,18 +384,59 @@ void GPUParticleSystem::Render( VkCommandBuffer commandBuffer, DynamicBufferRing
         renderPassBegin.renderArea.extent.width = m_ScreenWidth;
         renderPassBegin.renderArea.extent.height = m_ScreenHeight;
 
-        vkCmdBeginRenderPass( commandBuffer, &renderPassBegin, VK_SUBPASS_CONTENTS_INLINE );
-
         StreakMode streaks = flags & PF_Streaks ? StreaksOn : StreaksOff;
         ReactiveMode reactive = flags & PF_Reactive ? ReactiveOn : ReactiveOff;
 
-        vkCmdBindPipeline( commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_RasterizationPipelines[ streaks ][ reactive ] );
+        if ( oit )
+        {
+            // Accumulation starts empty and revealage fully transparent
+            VkClearValue clearValues[ 2 ] = {};
+            clearValues[ 1 ].color.float32[ 0 ] = 1.0f;
+
+            VkRenderPassBeginInfo oitRenderPassBegin = renderPassBegin;
+            oitRenderPassBegin.renderPass = m_OITRenderPass;
+            oitRenderPassBegin.framebuffer = m_OITFrameBuffer;
+            oitRenderPassBegin.clearValueCount = _countof( clearValues );
+            oitRenderPassBegin.pClearValues = clearValues;
+
+            vkCmdBeginRenderPass( commandBuffer, &oitRenderPassBegin, VK_SUBPASS_CONTENTS_INLINE );
+
+            vkCmdBindPipeline( commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_OITRasterizationPipelines[ streaks ] );
+
+            vkCmdBindIndexBuffer( commandBuffer, m_IndexBuffer.buffer, m_IndexBuffer.offset, VK_INDEX_TYPE_UINT32 );
+
+            vkCmdDrawIndexedIndirect( commandBuffer, m_IndirectArgsBuffer.Resource(), 0, 1, sizeof( IndirectCommand ) );
+
+            vkCmdEndRenderPass( commandBuffer );
+
+            VkMemoryBarrier memoryBarrier = {};
+            memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+            memoryBarrier.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+            memoryBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+            vkCmdPipelineBarrier( commandBuffer, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_DEPENDENCY_BY_REGION_BIT, 1, &memoryBarrier, 0, nullptr, 0, nullptr );
+
+            // Composite over the scene with a full screen triangle
+            vkCmdBeginRenderPass( commandBuffer, &renderPassBegin, VK_SUBPASS_CONTENTS_INLINE );
+
+            vkCmdBindDescriptorSets( commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_OITResolvePipelineLayout, 0, 1, &m_OITResolveDescriptorSet, 1, uniformOffsets );
+            vkCmdBindPipeline( commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_OITResolvePipelines[ reactive ] );
+
+            vkCmdDraw( commandBuffer, 3, 1, 0, 0 );
+
+            vkCmdEndRenderPass( commandBuffer );
+        }
+        else
+        {
+            vkCmdBeginRenderPass( commandBuffer, &renderPassBegin, VK_SUBPASS_CONTENTS_INLINE );
+
+            vkCmdBindPipeline( commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_RasterizationPipelines[ streaks ][ reactive ] );
 
-        vkCmdBindIndexBuffer( commandBuffer, m_IndexBuffer.buffer, m_IndexBuffer.offset, VK_INDEX_TYPE_UINT32 );
+            vkCmdBindIndexBuffer( commandBuffer, m_IndexBuffer.buffer, m_IndexBuffer.offset, VK_INDEX_TYPE_UINT32 );
 
-        vkCmdDrawIndexedIndirect( commandBuffer, m_IndirectArgsBuffer.Resource(), 0, 1, sizeof( IndirectCommand ) );
+            vkCmdDrawIndexedIndirect( commandBuffer, m_IndirectArgsBuffer.Resource(), 0, 1, sizeof( IndirectCommand ) );
 
-        vkCmdEndRenderPass( commandBuffer );
+            vkCmdEndRenderPass( commandBuffer );
+        }
     }
 }
 
@@ -454,10 +543,14 @@ void GPUParticleSystem::OnCreateDevice( Device& device, UploadHeap& uploadHeap,
     // Initialize the random numbers texture
     FillRandomTexture( uploadHeap );
 
+    // Upload the signed distance field for PF_SDFCollision
+    FillCollisionVolumeTexture( uploadHeap );
+
     m_Atlas.InitFromFile( &device, &uploadHeap, m_AtlasPath, true );
     m_Atlas.CreateSRV( &m_AtlasSRV );
 
     CreateSimulationAssets( constantBufferRing );
+    CreateOITRenderingAssets( constantBufferRing );
     CreateRasterizedRenderingAssets( constantBufferRing );
 
     // Create the SortLib resources
@@ -501,8 +594,9 @@ void GPUParticleSystem::CreateSimulationAssets( DynamicBufferRing& constantBuffe
     // 11 - PerFrameConstantBuffer
     // 12 - EmitterConstantBuffer
     // 13 - g_samWrapPoint
+    // 14 - g_CollisionVolume
 
-    std::vector<VkDescriptorSetLayoutBinding> layout_bindings( 14 );
+    std::vector<VkDescriptorSetLayoutBinding> layout_bindings( 15 );
     int binding = 0;
     for ( int i = 0; i < 9; i++ )
     {
@@ -542,6 +636,15 @@ void GPUParticleSystem::CreateSimulationAssets( DynamicBufferRing& constantBuffe
         binding++;
     }
 
+    {
+        layout_bindings[binding].binding = binding;
+        layout_bindings[binding].descriptorType = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+        layout_bindings[binding].descriptorCount = 1;
+        layout_bindings[binding].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+        layout_bindings[binding].pImmutableSamplers = nullptr;
+        binding++;
+    }
+
     assert( binding == layout_bindings.size() );
 
     m_heaps->CreateDescriptorSetLayoutAndAllocDescriptorSet( &layout_bindings, &m_SimulationDescriptorSetLayout, &m_SimulationDescriptorSet );
@@ -570,6 +673,7 @@ void GPUParticleSystem::CreateSimulationAssets( DynamicBufferRing& constantBuffe
     m_AliveCountBuffer.SetDescriptorSet( 8, m_SimulationDescriptorSet, true );
     // depth buffer
     SetDescriptorSet( m_pDevice->GetDevice(), 10, m_RandomTextureSRV, nullptr, m_SimulationDescriptorSet );
+    SetDescriptorSet( m_pDevice->GetDevice(), 14, m_CollisionVolumeTextureSRV, nullptr, m_SimulationDescriptorSet );
 
     // Create pipelines
     //
@@ -583,6 +687,47 @@ void GPUParticleSystem::CreateSimulationAssets( DynamicBufferRing& constantBuffe
 }
 
 
+void GPUParticleSystem::CreateOITRenderingAssets( DynamicBufferRing& constantBufferRing )
+{
+    // Accumulation and revealage are cleared every frame and left ready for sampling by the resolve. The scene depth is only tested against
+    VkAttachmentDescription colorAttachments[ 2 ];
+    AttachClearBeforeUse( VK_FORMAT_R16G16B16A16_SFLOAT, VK_SAMPLE_COUNT_1_BIT, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, &colorAttachments[ 0 ] );
+    AttachClearBeforeUse( VK_FORMAT_R16_SFLOAT, VK_SAMPLE_COUNT_1_BIT, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, &colorAttachments[ 1 ] );
+
+    VkAttachmentDescription depthAttachment;
+    AttachNoClearBeforeUse( VK_FORMAT_D32_SFLOAT, VK_SAMPLE_COUNT_1_BIT, VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL, VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL, &depthAttachment );
+
+    m_OITRenderPass = CreateRenderPassOptimal( m_pDevice->GetDevice(), _countof( colorAttachments ), colorAttachments, &depthAttachment, VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL );
+
+    //  0 - g_AccumulationTexture
+    //  1 - g_RevealageTexture
+    //  2 - RenderingConstantBuffer
+
+    std::vector<VkDescriptorSetLayoutBinding> layout_bindings( 3 );
+    for ( uint32_t i = 0; i < layout_bindings.size(); i++ )
+    {
+        layout_bindings[i].binding = i;
+        layout_bindings[i].descriptorCount = 1;
+        layout_bindings[i].descriptorType = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+        layout_bindings[i].stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+        layout_bindings[i].pImmutableSamplers = nullptr;
+    }
+
+    layout_bindings[2].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+
+    m_heaps->CreateDescriptorSetLayoutAndAllocDescriptorSet( &layout_bindings, &m_OITResolveDescriptorSetLayout, &m_OITResolveDescriptorSet );
+    constantBufferRing.SetDescriptorSet( 2, sizeof( RenderingConstantBuffer ), m_OITResolveDescriptorSet );
+
+    VkPipelineLayoutCreateInfo pipelineLayoutCreateInfo = {};
+    pipelineLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    pipelineLayoutCreateInfo.setLayoutCount = 1;
+    pipelineLayoutCreateInfo.pSetLayouts = &m_OITResolveDescriptorSetLayout;
+
+    VkResult res = vkCreatePipelineLayout( m_pDevice->GetDevice(), &pipelineLayoutCreateInfo, nullptr, &m_OITResolvePipelineLayout );
+    assert(res == VK_SUCCESS);
+}
+
+
 void GPUParticleSystem::CreateRasterizedRenderingAssets( DynamicBufferRing& constantBufferRing )
 {
     //  0 - g_ParticleBufferA
@@ -685,6 +830,13 @@ void GPUParticleSystem::CreateRasterizedRenderingAssets( DynamicBufferRing& cons
     att_state[0].dstAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
     att_state[1].colorWriteMask = 0x0;
     att_state[2].colorWriteMask = 0xf;
+    att_state[2].blendEnable = VK_TRUE;
+    att_state[2].alphaBlendOp = VK_BLEND_OP_MAX;
+    att_state[2].colorBlendOp = VK_BLEND_OP_MAX;
+    att_state[2].srcColorBlendFactor = VK_BLEND_FACTOR_ONE;
+    att_state[2].dstColorBlendFactor = VK_BLEND_FACTOR_ONE;
+    att_state[2].srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
+    att_state[2].dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
     att_state[3].colorWriteMask = 0x0;
     
     // Color blend state
@@ -786,6 +938,115 @@ void GPUParticleSystem::CreateRasterizedRenderingAssets( DynamicBufferRing& cons
             assert(res == VK_SUCCESS);
         }
     }
+
+    // OIT accumulation: additive weighted color and coverage, multiplicative revealage
+    VkPipelineColorBlendAttachmentState oit_att_state[2] = {};
+    oit_att_state[0].colorWriteMask = 0xf;
+    oit_att_state[0].blendEnable = VK_TRUE;
+    oit_att_state[0].alphaBlendOp = VK_BLEND_OP_ADD;
+    oit_att_state[0].colorBlendOp = VK_BLEND_OP_ADD;
+    oit_att_state[0].srcColorBlendFactor = VK_BLEND_FACTOR_ONE;
+    oit_att_state[0].dstColorBlendFactor = VK_BLEND_FACTOR_ONE;
+    oit_att_state[0].srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
+    oit_att_state[0].dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
+    oit_att_state[1].colorWriteMask = VK_COLOR_COMPONENT_R_BIT;
+    oit_att_state[1].blendEnable = VK_TRUE;
+    oit_att_state[1].alphaBlendOp = VK_BLEND_OP_ADD;
+    oit_att_state[1].colorBlendOp = VK_BLEND_OP_ADD;
+    oit_att_state[1].srcColorBlendFactor = VK_BLEND_FACTOR_ZERO;
+    oit_att_state[1].dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_COLOR;
+    oit_att_state[1].srcAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
+    oit_att_state[1].dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
+
+    cb.attachmentCount = _countof(oit_att_state);
+    cb.pAttachments = oit_att_state;
+
+    for ( int i = 0; i < NumStreakModes; i++ )
+    {
+        DefineList defines;
+        if ( i == StreaksOn )
+            defines[ "STREAKS" ] = "";
+        defines[ "OIT" ] = "";
+
+        VkPipelineShaderStageCreateInfo vertexShader = {};
+        res = VKCompileFromFile(m_pDevice->GetDevice(), VK_SHADER_STAGE_VERTEX_BIT, "ParticleRender.hlsl", "VS_StructuredBuffer", "-T vs_6_0", &defines, &vertexShader );
+        assert(res == VK_SUCCESS);
+
+        VkPipelineShaderStageCreateInfo fragmentShader;
+        res = VKCompileFromFile(m_pDevice->GetDevice(), VK_SHADER_STAGE_FRAGMENT_BIT, "ParticleRender.hlsl", "PS_Billboard", "-T ps_6_0", &defines, &fragmentShader );
+        assert(res == VK_SUCCESS);
+
+        VkPipelineShaderStageCreateInfo shaderStages[] = { vertexShader, fragmentShader };
+
+        VkGraphicsPipelineCreateInfo pipeline = {};
+        pipeline.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+        pipeline.layout = m_RasterizationPipelineLayout;
+        pipeline.pVertexInputState = &vi;
+        pipeline.pInputAssemblyState = &ia;
+        pipeline.pRasterizationState = &rs;
+        pipeline.pMultisampleState = &ms;
+        pipeline.pColorBlendState = &cb;
+        pipeline.pDynamicState = &dynamicState;
+        pipeline.pViewportState = &vp;
+        pipeline.pDepthStencilState = &ds;
+        pipeline.pStages = shaderStages;
+        pipeline.stageCount = _countof( shaderStages );
+        pipeline.renderPass = m_OITRenderPass;
+
+        res = vkCreateGraphicsPipelines( m_pDevice->GetDevice(), m_pDevice->GetPipelineCache(), 1, &pipeline, nullptr, &m_OITRasterizationPipelines[ i ] );
+        assert(res == VK_SUCCESS);
+    }
+
+    // OIT resolve: the average color is blended by ( 1 - revealage ) over the scene, scene alpha is kept
+    att_state[0].srcColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+    att_state[0].dstColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
+    att_state[0].srcAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
+    att_state[0].dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
+
+    cb.attachmentCount = _countof(att_state);
+    cb.pAttachments = att_state;
+
+    ds.depthTestEnable = VK_FALSE;
+
+    for ( int j = 0; j < NumReactiveModes; j++ )
+    {
+        att_state[2].colorWriteMask = 0x0;
+
+        DefineList defines;
+        if ( j == ReactiveOn )
+        {
+            defines["REACTIVE"] = "";
+            att_state[2].colorWriteMask = 0xf;
+        }
+
+        VkPipelineShaderStageCreateInfo vertexShader = {};
+        res = VKCompileFromFile(m_pDevice->GetDevice(), VK_SHADER_STAGE_VERTEX_BIT, "ParticleResolve.hlsl", "VS_FullscreenTriangle", "-T vs_6_0", &defines, &vertexShader );
+        assert(res == VK_SUCCESS);
+
+        VkPipelineShaderStageCreateInfo fragmentShader;
+        res = VKCompileFromFile(m_pDevice->GetDevice(), VK_SHADER_STAGE_FRAGMENT_BIT, "ParticleResolve.hlsl", "PS_ResolveOIT", "-T ps_6_0", &defines, &fragmentShader );
+        assert(res == VK_SUCCESS);
+
+        VkPipelineShaderStageCreateInfo shaderStages[] = { vertexShader, fragmentShader };
+
+        VkGraphicsPipelineCreateInfo pipeline = {};
+        pipeline.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+        pipeline.layout = m_OITResolvePipelineLayout;
+        pipeline.pVertexInputState = &vi;
+        pipeline.pInputAssemblyState = &ia;
+        pipeline.pRasterizationState = &rs;
+        pipeline.pMultisampleState = &ms;
+        pipeline.pColorBlendState = &cb;
+        pipeline.pDynamicState = &dynamicState;
+        pipeline.pViewportState = &vp;
+        pipeline.pDepthStencilState = &ds;
+        pipeline.pStages = shaderStages;
+        pipeline.stageCount = _countof( shaderStages );
+        pipeline.renderPass = m_renderPass;
+
+        res = vkCreateGraphicsPipelines( m_pDevice->GetDevice(), m_pDevice->GetPipelineCache(), 1, &pipeline, nullptr, &m_OITResolvePipelines[ j ] );
+        assert(res == VK_SUCCESS);
+    }
 }
 
 
@@ -802,6 +1063,19 @@ void GPUParticleSystem::OnResizedSwapChain( int width, int height, Texture& dept
 
     SetDescriptorSetForDepth( m_pDevice->GetDevice(), 9, m_DepthBufferSRV, nullptr, m_SimulationDescriptorSet );
     SetDescriptorSetForDepth( m_pDevice->GetDevice(), 5, m_DepthBufferSRV, nullptr, m_RasterizationDescriptorSet );
+
+    // OIT targets at render resolution, sharing the scene depth for the depth test
+    m_OITAccumulation.InitRenderTarget( m_pDevice, width, height, VK_FORMAT_R16G16B16A16_SFLOAT, VK_SAMPLE_COUNT_1_BIT, (VkImageUsageFlags)( VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT ), false, "OITAccumulation" );
+    m_OITAccumulation.CreateSRV( &m_OITAccumulationSRV );
+    m_OITRevealage.InitRenderTarget( m_pDevice, width, height, VK_FORMAT_R16_SFLOAT, VK_SAMPLE_COUNT_1_BIT, (VkImageUsageFlags)( VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT ), false, "OITRevealage" );
+    m_OITRevealage.CreateSRV( &m_OITRevealageSRV );
+    depthBuffer.CreateDSV( &m_DepthBufferDSV );
+
+    std::vector<VkImageView> attachments = { m_OITAccumulationSRV, m_OITRevealageSRV, m_DepthBufferDSV };
+    m_OITFrameBuffer = CreateFrameBuffer( m_pDevice->GetDevice(), m_OITRenderPass, &attachments, width, height );
+
+    SetDescriptorSet( m_pDevice->GetDevice(), 0, m_OITAccumulationSRV, nullptr, m_OITResolveDescriptorSet );
+    SetDescriptorSet( m_pDevice->GetDevice(), 1, m_OITRevealageSRV, nullptr, m_OITResolveDescriptorSet );
 }
 
 
@@ -812,6 +1086,22 @@ void GPUParticleSystem::OnReleasingSwapChain()
         vkDestroyImageView(m_pDevice->GetDevice(), m_DepthBufferSRV, nullptr);
         m_DepthBufferSRV = {};
     }
+
+    if (m_OITFrameBuffer != VK_NULL_HANDLE)
+    {
+        vkDestroyFramebuffer(m_pDevice->GetDevice(), m_OITFrameBuffer, nullptr);
+        m_OITFrameBuffer = VK_NULL_HANDLE;
+
+        vkDestroyImageView(m_pDevice->GetDevice(), m_DepthBufferDSV, nullptr);
+        vkDestroyImageView(m_pDevice->GetDevice(), m_OITAccumulationSRV, nullptr);
+        vkDestroyImageView(m_pDevice->GetDevice(), m_OITRevealageSRV, nullptr);
+        m_DepthBufferDSV = {};
+        m_OITAccumulationSRV = {};
+        m_OITRevealageSRV = {};
+
+        m_OITAccumulation.OnDestroy();
+        m_OITRevealage.OnDestroy();
+    }
 }
 
 
@@ -829,12 +1119,15 @@ void GPUParticleSystem::OnDestroyDevice()
     m_AliveCountBuffer.OnDestroy();
     vkDestroyImageView( m_pDevice->GetDevice(), m_RandomTextureSRV, nullptr );
     m_RandomTexture.OnDestroy();
+    vkDestroyImageView( m_pDevice->GetDevice(), m_CollisionVolumeTextureSRV, nullptr );
+    m_CollisionVolumeTexture.OnDestroy();
     vkDestroyImageView( m_pDevice->GetDevice(), m_AtlasSRV, nullptr );
     m_Atlas.OnDestroy();
     m_IndirectArgsBuffer.OnDestroy();
 
     vkDestroyDescriptorSetLayout( m_pDevice->GetDevice(), m_SimulationDescriptorSetLayout, nullptr );
     vkDestroyDescriptorSetLayout( m_pDevice->GetDevice(), m_RasterizationDescriptorSetLayout, nullptr );
+    vkDestroyDescriptorSetLayout( m_pDevice->GetDevice(), m_OITResolveDescriptorSetLayout, nullptr );
 
     vkDestroyPipeline( m_pDevice->GetDevice(), m_SimulationPipeline, nullptr );
     vkDestroyPipeline( m_pDevice->GetDevice(), m_ResetParticlesPipeline, nullptr );
@@ -846,10 +1139,19 @@ void GPUParticleSystem::OnDestroyDevice()
         {
             vkDestroyPipeline( m_pDevice->GetDevice(), m_RasterizationPipelines[ i ][ j ], nullptr );
         }
+
+        vkDestroyPipeline( m_pDevice->GetDevice(), m_OITRasterizationPipelines[ i ], nullptr );
+    }
+
+    for ( int j = 0; j < NumReactiveModes; j++ )
+    {
+        vkDestroyPipeline( m_pDevice->GetDevice(), m_OITResolvePipelines[ j ], nullptr );
     }
 
     vkDestroyPipelineLayout( m_pDevice->GetDevice(), m_SimulationPipelineLayout, nullptr );
     vkDestroyPipelineLayout( m_pDevice->GetDevice(), m_RasterizationPipelineLayout, nullptr );
+    vkDestroyPipelineLayout( m_pDevice->GetDevice(), m_OITResolvePipelineLayout, nullptr );
+    vkDestroyRenderPass( m_pDevice->GetDevice(), m_OITRenderPass, nullptr );
 
     m_SortLib.OnDestroy();
 
@@ -868,34 +1170,22 @@ void GPUParticleSystem::Emit( VkCommandBuffer commandBuffer, DynamicBufferRing&
 {
     vkCmdBindPipeline( commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_EmitPipeline );
 
-    // Run CS for each emitter
-    for ( int i = 0; i < numEmitters; i++ )
+    // Run CS once for all the emitters, each thread finds its emitter from the prefix sum of the emit counts
+    int nextEmitter = 0;
+    while ( nextEmitter < numEmitters )
     {
-        const EmitterParams& emitter = emitters[ i ];
+        EmitterConstantBuffer* constants = nullptr;
+        VkDescriptorBufferInfo constantBuffer = {};
+        constantBufferRing.AllocConstantBuffer( sizeof(*constants), (void**)&constants, &constantBuffer );
+        nextEmitter = FillEmitterConstants( *constants, nextEmitter, numEmitters, emitters );
 
-        if ( emitter.m_NumToEmit > 0 )
+        if ( constants->m_MaxParticlesThisFrame > 0 )
         {
-            EmitterConstantBuffer* constants = nullptr;
-            VkDescriptorBufferInfo constantBuffer = {};
-            constantBufferRing.AllocConstantBuffer( sizeof(*constants), (void**)&constants, &constantBuffer );
-            constants->m_EmitterPosition = emitter.m_Position;
-            constants->m_EmitterVelocity = emitter.m_Velocity;
-            constants->m_MaxParticlesThisFrame = emitter.m_NumToEmit;
-            constants->m_ParticleLifeSpan = emitter.m_ParticleLifeSpan;
-            constants->m_StartSize = emitter.m_StartSize;
-            constants->m_EndSize = emitter.m_EndSize;
-            constants->m_PositionVariance = emitter.m_PositionVariance;
-            constants->m_VelocityVariance = emitter.m_VelocityVariance;
-            constants->m_Mass = emitter.m_Mass;
-            constants->m_Index = i;
-            constants->m_Streaks = emitter.m_Streaks ? 1 : 0;
-            constants->m_TextureIndex = emitter.m_TextureIndex;
-
             uint32_t uniformOffsets[] = { perFrameConstantOffset, (uint32_t)constantBuffer.offset };
             vkCmdBindDescriptorSets( commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_SimulationPipelineLayout, 0, 1, &m_SimulationDescriptorSet, _countof( uniformOffsets ), uniformOffsets );
 
             // Dispatch enough thread groups to spawn the requested particles
-            int numThreadGroups = align( emitter.m_NumToEmit, 1024 ) / 1024;
+            int numThreadGroups = align( constants->m_MaxParticlesThisFrame, 1024 ) / 1024;
             vkCmdDispatch( commandBuffer, numThreadGroups, 1, 1 );
         }
     }
@@ -942,3 +1232,23 @@ void GPUParticleSystem::FillRandomTexture( UploadHeap& uploadHeap )
 
     delete[] values;
 }
+
+
+// Upload the collision volume with its Z slices stacked vertically. Without a volume a single texel keeps the descriptor valid
+void GPUParticleSystem::FillCollisionVolumeTexture( UploadHeap& uploadHeap )
+{
+    const float emptyVolume = FLT_MAX;
+    bool hasVolume = !m_CollisionVolume.m_Distances.empty();
+
+    IMG_INFO header = {};
+    header.width = hasVolume ? m_CollisionVolume.m_Resolution[ 0 ] : 1;
+    header.height = hasVolume ? m_CollisionVolume.m_Resolution[ 1 ] * m_CollisionVolume.m_Resolution[ 2 ] : 1;
+    header.depth = 1;
+    header.arraySize = 1;
+    header.mipMapCount = 1;
+    header.format = DXGI_FORMAT_R32_FLOAT;
+    header.bitCount = 32;
+
+    m_CollisionVolumeTexture.InitFromData( m_pDevice, uploadHeap, header, hasVolume ? m_CollisionVolume.m_Distances.data() : &emptyVolume, "CollisionVolume" );
+    m_CollisionVolumeTexture.CreateSRV( &m_CollisionVolumeTextureSRV );
+}
@@ -106,7 +106,7 @@ void FFXParallelSort::CompileRadixPipeline(const char* shaderFile, const DefineL
 	assert(vkResult == VK_SUCCESS);
 }
 
-void FFXParallelSort::OnCreate(Device* pDevice, ResourceViewHeaps* pResourceViewHeaps, DynamicBufferRing* pConstantBufferRing, UploadHeap* pUploadHeap, Buffer* elementCount, Buffer* listA, Buffer* listB, Buffer* listA2, Buffer* listB2)
+void FFXParallelSort::OnCreate(Device* pDevice, ResourceViewHeaps* pResourceViewHeaps, DynamicBufferRing* pConstantBufferRing, UploadHeap* pUploadHeap, Buffer* elementCount, Buffer* listA, Buffer* listB, Buffer* listA2, Buffer* listB2, Buffer* segmentHeads, uint32_t segmentBits)
 {
 	m_pDevice = pDevice;
 	m_pUploadHeap = pUploadHeap;
@@ -116,6 +116,8 @@ void FFXParallelSort::OnCreate(Device* pDevice, ResourceViewHeaps* pResourceView
     m_SrcPayloadBuffer = listB;
     m_DstKeyBuffer = listA2;
     m_DstPayloadBuffer = listB2;
+    m_SegmentHeadsBuffer = segmentHeads;
+    m_SegmentBits = segmentHeads ? segmentBits : 0;
 
 	m_MaxNumThreadgroups = 800;	
 
@@ -188,6 +190,7 @@ void FFXParallelSort::OnCreate(Device* pDevice, ResourceViewHeaps* pResourceView
 			{ 1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr },	// DstBuffer (sort)
 			{ 2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr },	// ScrPayload (sort only)
 			{ 3, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr },	// DstPayload (sort only)
+			{ 4, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr },	// SegmentHeads (segmented sort only)
 		};
 
 		VkDescriptorSetLayoutBinding layout_bindings_set_Scan[] = {
@@ -231,7 +234,7 @@ void FFXParallelSort::OnCreate(Device* pDevice, ResourceViewHeaps* pResourceView
 		assert(bDescriptorAlloc == true);
 
 		descriptor_set_layout_create_info.pBindings = layout_bindings_set_InputOutputs;
-		descriptor_set_layout_create_info.bindingCount = 4;
+		descriptor_set_layout_create_info.bindingCount = 5;
 		vkResult = vkCreateDescriptorSetLayout(m_pDevice->GetDevice(), &descriptor_set_layout_create_info, nullptr, &m_SortDescriptorSetLayoutInputOutputs);
 		assert(vkResult == VK_SUCCESS);
 		bDescriptorAlloc = m_pResourceViewHeaps->AllocDescriptor(m_SortDescriptorSetLayoutInputOutputs, &m_SortDescriptorSetInputOutput[0]);
@@ -321,6 +324,10 @@ void FFXParallelSort::OnCreate(Device* pDevice, ResourceViewHeaps* pResourceView
 		// Radix scatter with payload (key and payload redistribution)
 		defines["kRS_ValueCopy"] = std::to_string(1);
 		CompileRadixPipeline("ParallelSortCS.hlsl", &defines, "FPS_Scatter", m_FPSScatterPayloadPipeline);
+
+		// Segment heads (segmented sort only)
+		if (m_SegmentHeadsBuffer)
+			CompileRadixPipeline("ParallelSortCS.hlsl", &defines, "FPS_SegmentHeads", m_FPSSegmentHeadsPipeline);
 	}
 
 	// Do binding setups
@@ -340,6 +347,10 @@ void FFXParallelSort::OnCreate(Device* pDevice, ResourceViewHeaps* pResourceView
 		BufferMaps[3] = m_SrcPayloadBuffer->Resource();
 		BindUAVBuffer(BufferMaps, m_SortDescriptorSetInputOutput[1], 0, 4);
 
+		// The sorted keys end up back in the source buffer after the 8 passes, so only the first set needs the segment heads
+		if (m_SegmentHeadsBuffer)
+			m_SegmentHeadsBuffer->SetDescriptorSet(4, m_SortDescriptorSetInputOutput[0], true);
+
 		// Map scan sets (reduced, scratch)
 		BufferMaps[0] = BufferMaps[1] = m_FPSReducedScratchBuffer;
 		BindUAVBuffer(BufferMaps, m_SortDescriptorSetScanSets[0], 0, 2);
@@ -403,6 +414,8 @@ void FFXParallelSort::OnDestroy()
 	vkDestroyPipeline(m_pDevice->GetDevice(), m_FPSScanAddPipeline, nullptr);
 	vkDestroyPipeline(m_pDevice->GetDevice(), m_FPSScatterPipeline, nullptr);
 	vkDestroyPipeline(m_pDevice->GetDevice(), m_FPSScatterPayloadPipeline, nullptr);
+	if (m_FPSSegmentHeadsPipeline != VK_NULL_HANDLE)
+		vkDestroyPipeline(m_pDevice->GetDevice(), m_FPSSegmentHeadsPipeline, nullptr);
 }
 
 
@@ -545,6 +558,20 @@ void FFXParallelSort::Draw(VkCommandBuffer commandList)
 		inputSet = !inputSet;
 	}
 
+	// Find where each segment starts in the sorted list
+	if (m_SegmentHeadsBuffer)
+	{
+		vkCmdPushConstants(commandList, m_SortPipelineLayout, VK_SHADER_STAGE_ALL, 0, 4, &m_SegmentBits);
+		vkCmdBindDescriptorSets(commandList, VK_PIPELINE_BIND_POINT_COMPUTE, m_SortPipelineLayout, 2, 1, &m_SortDescriptorSetInputOutput[inputSet], 0, nullptr);
+		vkCmdBindPipeline(commandList, VK_PIPELINE_BIND_POINT_COMPUTE, m_FPSSegmentHeadsPipeline);
+
+		// One thread per key plus one for the end of the list, the shader early outs past the indirect key count
+		vkCmdDispatch(commandList, (NumKeys + FFX_PARALLELSORT_THREADGROUP_SIZE) / FFX_PARALLELSORT_THREADGROUP_SIZE, 1, 1);
+
+		Barriers[0] = BufferTransition(m_SegmentHeadsBuffer->Resource(), VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_INDIRECT_COMMAND_READ_BIT, sizeof(uint32_t) * ((1u << m_SegmentBits) + 1));
+		vkCmdPipelineBarrier(commandList, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 0, nullptr, 1, Barriers, 0, nullptr);
+	}
+
 	// When we are all done, transition indirect buffers back to UAV for the next frame (if doing indirect dispatch)
 	{
 		VkBufferMemoryBarrier barriers[3];
@@ -34,7 +34,7 @@ struct ParallelSortRenderCB	// If you change this, also change struct ParallelSo
 class FFXParallelSort
 {
 public:
-	void OnCreate(Device* pDevice, ResourceViewHeaps* pResourceViewHeaps, DynamicBufferRing* pConstantBufferRing, UploadHeap* pUploadHeap, Buffer* elementCount, Buffer* listA, Buffer* listB, Buffer* listA2, Buffer* listB2);
+	void OnCreate(Device* pDevice, ResourceViewHeaps* pResourceViewHeaps, DynamicBufferRing* pConstantBufferRing, UploadHeap* pUploadHeap, Buffer* elementCount, Buffer* listA, Buffer* listB, Buffer* listA2, Buffer* listB2, Buffer* segmentHeads = nullptr, uint32_t segmentBits = 0);
 	void OnDestroy();
 
 	void Draw(VkCommandBuffer commandList);
@@ -60,6 +60,9 @@ private:
     Buffer*         m_DstKeyBuffer = nullptr;
     Buffer*         m_DstPayloadBuffer = nullptr;
 
+    Buffer*         m_SegmentHeadsBuffer = nullptr;	// Optional first sorted index of each segment, keys then carry the segment in their top m_SegmentBits bits
+    uint32_t        m_SegmentBits = 0;
+
     VkBuffer		m_FPSScratchBuffer;				// Sort scratch buffer
 	VmaAllocation   m_FPSScratchBufferAllocation;
 
@@ -88,6 +91,7 @@ private:
 	VkPipeline m_FPSScanAddPipeline;
 	VkPipeline m_FPSScatterPipeline;
 	VkPipeline m_FPSScatterPayloadPipeline;
+	VkPipeline m_FPSSegmentHeadsPipeline = VK_NULL_HANDLE;
 
 	// Resources for indirect execution of algorithm
 	VkBuffer		m_IndirectConstantBuffer;		// Buffer to hold radix sort constant buffer data for indirect dispatch
@@ -0,0 +1,78 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdint.h>
+#include <vector>
+#include "ffx_fsr2_reference.h"
+#include "Tests.h"
+
+namespace {
+
+FfxFsr2AlphaUpscaleReferenceDescription upscaleDisc(float velocity, bool zeroMotionVectors, bool disableAlphaRectification)
+{
+    FfxFsr2AlphaUpscaleReferenceDescription description = {};
+    description.renderSize = { 64, 64 };
+    description.displaySize = { 128, 128 };
+    description.frameCount = 32;
+    description.discCenter = { 40.0f, 64.0f };
+    description.discRadius = 20.0f;
+    description.discVelocity = { velocity, 0.0f };
+    description.zeroMotionVectors = zeroMotionVectors;
+    description.disableAlphaRectification = disableAlphaRectification;
+    TEST_CHECK(ffxFsr2UpscaleAlphaReference(&description) == FFX_OK);
+    return description;
+}
+
+} // namespace
+
+// An opaque disc over a transparent background, upscaled 2x: the clamped alpha history leaves no halo
+// away from the edge even when the disc is missing from the motion vectors, which without the clamp
+// leaves a trail behind it.
+void TestAlphaUpscale()
+{
+    struct Case {
+        const char* name;
+        float       velocity;
+        bool        zeroMotionVectors;
+        bool        disableAlphaRectification;
+    };
+    const Case cases[] = {
+        { "static",                              0.0f, false, false },
+        { "moving",                              1.5f, false, false },
+        { "moving, no motion vectors",           1.5f, true,  false },
+        { "moving, no motion vectors, no clamp", 1.5f, true,  true  },
+    };
+
+    printf("    %-38s %10s %10s %10s\n", "disc", "halo", "overshoot", "edge error");
+    FfxFsr2AlphaUpscaleReferenceDescription results[4];
+    for (size_t index = 0; index < 4; ++index) {
+        results[index] = upscaleDisc(cases[index].velocity, cases[index].zeroMotionVectors, cases[index].disableAlphaRectification);
+        printf("    %-38s %10.4f %10.4f %10.4f\n", cases[index].name, results[index].maxHalo, results[index].maxOvershoot + 0.0f, results[index].meanEdgeError);
+        TEST_CHECK(results[index].maxOvershoot <= 0.0f);
+    }
+
+    for (size_t index = 0; index < 3; ++index) {
+        TEST_CHECK(results[index].maxHalo == 0.0f);
+    }
+    TEST_CHECK(results[0].meanEdgeError < 0.1f);
+    TEST_CHECK(results[1].meanEdgeError < 0.1f);
+    TEST_CHECK(results[3].maxHalo > 0.5f);
+}
@@ -0,0 +1,247 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <math.h>
+#include <stdint.h>
+#include <vector>
+#include "ffx_fsr2_reference.h"
+#include "TestHelpers.h"
+#include "Tests.h"
+
+namespace {
+
+// Every signal of the accumulate pass, filled with random values over one surface.
+struct DebugViewSignals {
+
+    std::vector<float> color;
+    std::vector<float> motionVectors;
+    std::vector<float> depthClip;
+    std::vector<float> newSample;
+    std::vector<float> lockLifetime;
+    std::vector<float> lockContribution;
+    std::vector<float> reactive;
+    std::vector<float> transparencyAndComposition;
+    std::vector<float> temporalReactiveFactor;
+    std::vector<float> accumulation;
+    std::vector<float> upsampledWeight;
+    std::vector<float> lumaInstability;
+
+    DebugViewSignals(uint32_t width, uint32_t height)
+    {
+        const size_t pixelCount = size_t(width) * height;
+        TestRandom random(width * 131u + height);
+        auto fill = [&](std::vector<float>& surface, size_t count, float minimum, float maximum) {
+            surface.resize(count);
+            for (float& value : surface) {
+                value = random.NextFloat(minimum, maximum);
+            }
+        };
+
+        // color stays away from 0, so a cleared pixel can't be mistaken for an encoded one.
+        fill(color, pixelCount * 3, 0.1f, 1.0f);
+        fill(motionVectors, pixelCount * 2, -0.01f, 0.01f);
+        fill(depthClip, pixelCount, 0.0f, 1.0f);
+        fill(newSample, pixelCount, 0.0f, 1.0f);
+        fill(lockLifetime, pixelCount, 0.0f, 2.0f);
+        fill(lockContribution, pixelCount, 0.0f, 1.0f);
+        fill(reactive, pixelCount, 0.0f, 1.0f);
+        fill(transparencyAndComposition, pixelCount, 0.0f, 1.0f);
+        fill(temporalReactiveFactor, pixelCount, -1.0f, 1.0f);
+        fill(accumulation, pixelCount, 0.0f, 1.0f);
+        fill(upsampledWeight, pixelCount, 0.0f, 1.0f / 12.0f);
+        fill(lumaInstability, pixelCount, 0.0f, 1.0f);
+    }
+
+    std::vector<float> encode(FfxFsr2DebugView view, uint32_t width, uint32_t height) const
+    {
+        std::vector<float> output(size_t(width) * height * 3, -1.0f);
+
+        FfxFsr2DebugViewReferenceDescription description = {};
+        description.color = color.data();
+        description.motionVectors = motionVectors.data();
+        description.depthClip = depthClip.data();
+        description.newSample = newSample.data();
+        description.lockLifetime = lockLifetime.data();
+        description.lockContribution = lockContribution.data();
+        description.reactive = reactive.data();
+        description.transparencyAndComposition = transparencyAndComposition.data();
+        description.temporalReactiveFactor = temporalReactiveFactor.data();
+        description.accumulation = accumulation.data();
+        description.upsampledWeight = upsampledWeight.data();
+        description.lumaInstability = lumaInstability.data();
+        description.output = output.data();
+        description.displaySize = { width, height };
+        description.view = view;
+        TEST_CHECK(ffxFsr2EncodeDebugViewReference(&description) == FFX_OK);
+        return output;
+    }
+};
+
+bool near(const float* color, float red, float green, float blue)
+{
+    return fabsf(color[0] - red) < 1e-6f && fabsf(color[1] - green) < 1e-6f && fabsf(color[2] - blue) < 1e-6f;
+}
+
+// Each view encodes its signals as documented in FfxFsr2DebugView, and missing surfaces read as 0.
+void testEncoding()
+{
+    const uint32_t width = 64;
+    const uint32_t height = 32;
+    const DebugViewSignals signals(width, height);
+
+    bool matches[FFX_FSR2_DEBUG_VIEW_TILED] = {};
+    for (uint32_t view = 0; view < FFX_FSR2_DEBUG_VIEW_TILED; ++view) {
+
+        const std::vector<float> output = signals.encode(FfxFsr2DebugView(view), width, height);
+        matches[view] = true;
+        for (size_t pixel = 0; pixel < size_t(width) * height; ++pixel) {
+
+            const float* color = &output[pixel * 3];
+            const bool newSample = signals.newSample[pixel] > 0.5f;
+            const float temporalReactiveFactor = signals.temporalReactiveFactor[pixel];
+            const float accumulation = signals.accumulation[pixel];
+            const float upsampledWeight = signals.upsampledWeight[pixel];
+
+            bool pixelMatches = false;
+            switch (view) {
+
+            case FFX_FSR2_DEBUG_VIEW_NONE:
+                pixelMatches = near(color, signals.color[pixel * 3 + 0], signals.color[pixel * 3 + 1], signals.color[pixel * 3 + 2]);
+                break;
+            case FFX_FSR2_DEBUG_VIEW_DILATED_MOTION_VECTORS:
+                pixelMatches = near(color, 0.5f + signals.motionVectors[pixel * 2 + 0] * width / 64.0f, 0.5f + signals.motionVectors[pixel * 2 + 1] * height / 64.0f, 0.0f);
+                break;
+            case FFX_FSR2_DEBUG_VIEW_DEPTH_CLIP:
+                pixelMatches = near(color, signals.depthClip[pixel], signals.depthClip[pixel], newSample ? 1.0f : signals.depthClip[pixel]);
+                break;
+            case FFX_FSR2_DEBUG_VIEW_LOCK_STATUS:
+                pixelMatches = near(color, signals.lockLifetime[pixel] * 0.5f, signals.lockContribution[pixel], 0.0f);
+                break;
+            case FFX_FSR2_DEBUG_VIEW_REACTIVE_MASKS:
+                pixelMatches = near(color, signals.reactive[pixel], signals.transparencyAndComposition[pixel], 0.0f);
+                break;
+            case FFX_FSR2_DEBUG_VIEW_TEMPORAL_REACTIVE_FACTOR:
+                pixelMatches = near(color, fabsf(temporalReactiveFactor), fabsf(temporalReactiveFactor), (temporalReactiveFactor < 0.0f) ? 1.0f : fabsf(temporalReactiveFactor));
+                break;
+            case FFX_FSR2_DEBUG_VIEW_ACCUMULATION_WEIGHT:
+                pixelMatches = near(color, accumulation, fminf(upsampledWeight * 12.0f, 1.0f), newSample ? 1.0f : upsampledWeight / fmaxf(1e-03f, accumulation + upsampledWeight));
+                break;
+            case FFX_FSR2_DEBUG_VIEW_LUMA_INSTABILITY:
+                pixelMatches = near(color, signals.lumaInstability[pixel], signals.lumaInstability[pixel], signals.lumaInstability[pixel]);
+                break;
+            }
+            matches[view] = matches[view] && pixelMatches;
+        }
+    }
+    for (uint32_t view = 0; view < FFX_FSR2_DEBUG_VIEW_TILED; ++view) {
+        TEST_CHECK(matches[view]);
+    }
+
+    // out of range signals are saturated.
+    const float motionVector[2] = { 64.0f, -64.0f };
+    const float lockLifetime = 4.0f;
+    float output[3] = {};
+    FfxFsr2DebugViewReferenceDescription description = {};
+    description.motionVectors = motionVector;
+    description.lockLifetime = &lockLifetime;
+    description.output = output;
+    description.displaySize = { 1, 1 };
+    description.view = FFX_FSR2_DEBUG_VIEW_DILATED_MOTION_VECTORS;
+    TEST_CHECK(ffxFsr2EncodeDebugViewReference(&description) == FFX_OK);
+    TEST_CHECK(near(output, 1.0f, 0.0f, 0.0f));
+    description.view = FFX_FSR2_DEBUG_VIEW_LOCK_STATUS;
+    TEST_CHECK(ffxFsr2EncodeDebugViewReference(&description) == FFX_OK);
+    TEST_CHECK(near(output, 1.0f, 0.0f, 0.0f));
+
+    // missing surfaces read as 0, so with no history the accumulation weight view shows only the blend factor of a new sample.
+    description.view = FFX_FSR2_DEBUG_VIEW_ACCUMULATION_WEIGHT;
+    TEST_CHECK(ffxFsr2EncodeDebugViewReference(&description) == FFX_OK);
+    TEST_CHECK(near(output, 0.0f, 0.0f, 0.0f));
+    description.view = FFX_FSR2_DEBUG_VIEW_DEPTH_CLIP;
+    TEST_CHECK(ffxFsr2EncodeDebugViewReference(&description) == FFX_OK);
+    TEST_CHECK(near(output, 0.0f, 0.0f, 0.0f));
+
+    description.view = FFX_FSR2_DEBUG_VIEW_COUNT;
+    TEST_CHECK(ffxFsr2EncodeDebugViewReference(&description) == FFX_ERROR_INVALID_ENUM);
+    description.view = FFX_FSR2_DEBUG_VIEW_NONE;
+    description.output = nullptr;
+    TEST_CHECK(ffxFsr2EncodeDebugViewReference(&description) == FFX_ERROR_INVALID_POINTER);
+    TEST_CHECK(ffxFsr2EncodeDebugViewReference(nullptr) == FFX_ERROR_INVALID_POINTER);
+}
+
+// The tiled view puts the view of every third pixel in a 3x3 grid of tiles, in the order of FfxFsr2DebugView, with
+// the bottom right tile black. When the size doesn't divide by 3, the rows and columns past the grid are black too.
+void testTiledLayout()
+{
+    printf("    %-10s %12s %14s %14s\n", "size", "tile size", "tiles match", "black pixels");
+    const uint32_t sizes[][2] = { { 48, 27 }, { 50, 29 }, { 64, 31 }, { 2, 5 } };
+    for (const uint32_t* size : sizes) {
+
+        const uint32_t width = size[0];
+        const uint32_t height = size[1];
+        const uint32_t tileWidth = width / 3;
+        const uint32_t tileHeight = height / 3;
+        const DebugViewSignals signals(width, height);
+        const std::vector<float> tiled = signals.encode(FFX_FSR2_DEBUG_VIEW_TILED, width, height);
+
+        bool tilesMatch = true;
+        for (uint32_t tile = 0; tile < 8; ++tile) {
+
+            const std::vector<float> view = signals.encode(FfxFsr2DebugView(tile), width, height);
+            for (uint32_t y = 0; y < tileHeight; ++y) {
+                for (uint32_t x = 0; x < tileWidth; ++x) {
+
+                    const size_t source = (size_t(y) * 3 * width + x * 3) * 3;
+                    const size_t destination = ((size_t(tile / 3) * tileHeight + y) * width + (tile % 3) * tileWidth + x) * 3;
+                    tilesMatch = tilesMatch && near(&tiled[destination], view[source + 0], view[source + 1], view[source + 2]);
+                }
+            }
+        }
+
+        // the last tile and everything past the grid.
+        uint32_t blackPixelCount = 0;
+        bool blackOutsideTiles = true;
+        for (uint32_t y = 0; y < height; ++y) {
+            for (uint32_t x = 0; x < width; ++x) {
+
+                const bool lastTile = x >= 2 * tileWidth && x < 3 * tileWidth && y >= 2 * tileHeight && y < 3 * tileHeight;
+                const bool pastGrid = x >= 3 * tileWidth || y >= 3 * tileHeight;
+                if (lastTile || pastGrid) {
+                    blackOutsideTiles = blackOutsideTiles && near(&tiled[(size_t(y) * width + x) * 3], 0.0f, 0.0f, 0.0f);
+                    ++blackPixelCount;
+                }
+            }
+        }
+
+        printf("    %3ux%-6u %5ux%-6u %14s %14u\n", width, height, tileWidth, tileHeight, tilesMatch ? "yes" : "no", blackPixelCount);
+        TEST_CHECK(tilesMatch);
+        TEST_CHECK(blackOutsideTiles);
+        TEST_CHECK(blackPixelCount == width * height - 8 * tileWidth * tileHeight);
+    }
+}
+
+} // namespace
+
+void TestDebugView()
+{
+    testEncoding();
+    testTiledLayout();
+}
@@ -0,0 +1,136 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <math.h>
+#include <stdint.h>
+#include "ffx_fsr2_reference.h"
+#include "Tests.h"
+
+namespace {
+
+const uint32_t kBinCount = FFX_FSR2_EXPOSURE_HISTOGRAM_REFERENCE_BIN_COUNT;
+
+// the natural log luminance at the center of a bin, bins are half a stop wide starting at -16 stops
+float binLogLuma(uint32_t bin)
+{
+    return (-16.0f + (float(bin) + 0.5f) * 0.5f) * 0.693147f;
+}
+
+float resolve(const uint32_t* histogram, float lowPercentile, float highPercentile, float previousAverageLogLuma = 1e8f, float deltaTime = 0.0f)
+{
+    float averageLogLuma = -1.0f;
+
+    FfxFsr2ExposureHistogramReferenceDescription description = {};
+    description.histogram = histogram;
+    description.autoExposure.mode = FFX_FSR2_AUTO_EXPOSURE_MODE_HISTOGRAM;
+    description.autoExposure.histogramLowPercentile = lowPercentile;
+    description.autoExposure.histogramHighPercentile = highPercentile;
+    description.autoExposure.adaptationRateUp = 2.0f;
+    description.autoExposure.adaptationRateDown = 0.5f;
+    description.previousAverageLogLuma = previousAverageLogLuma;
+    description.deltaTime = deltaTime;
+    description.averageLogLuma = &averageLogLuma;
+    TEST_CHECK(ffxFsr2ComputeHistogramExposureReference(&description) == FFX_OK);
+    return averageLogLuma;
+}
+
+void testSingleBin()
+{
+    uint32_t histogram[kBinCount] = {};
+    histogram[32] = 1000;
+    TEST_CHECK(fabsf(resolve(histogram, 0.0f, 0.0f) - binLogLuma(32)) < 1e-6f);
+
+    // an empty histogram resolves to a log luminance of 0
+    histogram[32] = 0;
+    TEST_CHECK(resolve(histogram, 0.0f, 0.0f) == 0.0f);
+}
+
+// Small bright light sources are outside of the default window, and do not pull the exposure like they pull the
+// average of the whole frame.
+void testPercentileWindowIgnoresOutliers()
+{
+    uint32_t histogram[kBinCount] = {};
+    histogram[24] = 920;
+    histogram[63] = 80;
+
+    float frameAverage = 0.0f;
+    for (uint32_t bin = 0; bin < kBinCount; ++bin) {
+        frameAverage += binLogLuma(bin) * float(histogram[bin]) / 1000.0f;
+    }
+
+    const float windowAverage = resolve(histogram, 0.0f, 0.0f);
+    printf("    log luminance of the interior %.3f, histogram %.3f, frame average %.3f\n", binLogLuma(24), windowAverage, frameAverage);
+    TEST_CHECK(fabsf(windowAverage - binLogLuma(24)) < 1e-5f);
+    TEST_CHECK(fabsf(frameAverage - binLogLuma(24)) > 0.5f);
+}
+
+// Bins straddling the window edges contribute the part of their pixels inside the window.
+void testPartialBins()
+{
+    uint32_t histogram[kBinCount] = {};
+    histogram[10] = 100;
+    histogram[20] = 100;
+    histogram[30] = 200;
+
+    // [0.125, 0.625] of 400 pixels is 50 from bin 10, 100 from bin 20 and 50 from bin 30
+    const float expected = (50.0f * binLogLuma(10) + 100.0f * binLogLuma(20) + 50.0f * binLogLuma(30)) / 200.0f;
+    TEST_CHECK(fabsf(resolve(histogram, 0.125f, 0.625f) - expected) < 1e-5f);
+}
+
+void testAdaptationRates()
+{
+    uint32_t histogram[kBinCount] = {};
+    histogram[40] = 100;
+    const float target = binLogLuma(40);
+    const float deltaTime = 0.1f;
+
+    // brighter than the previous frame adapts at the up rate, darker at the down rate
+    const float up = resolve(histogram, 0.0f, 0.0f, target - 1.0f, deltaTime);
+    const float down = resolve(histogram, 0.0f, 0.0f, target + 1.0f, deltaTime);
+    TEST_CHECK(fabsf(up - (target - 1.0f + (1.0f - expf(-deltaTime * 2.0f)))) < 1e-5f);
+    TEST_CHECK(fabsf(down - (target + 1.0f - (1.0f - expf(-deltaTime * 0.5f)))) < 1e-5f);
+    TEST_CHECK(target - up < down - target);
+}
+
+void testInvalidSettings()
+{
+    uint32_t histogram[kBinCount] = {};
+
+    FfxFsr2ExposureHistogramReferenceDescription description = {};
+    description.histogram = histogram;
+    description.autoExposure.histogramLowPercentile = 0.8f;
+    description.autoExposure.histogramHighPercentile = 0.2f;
+    TEST_CHECK(ffxFsr2ComputeHistogramExposureReference(&description) == FFX_ERROR_INVALID_ARGUMENT);
+
+    description.histogram = nullptr;
+    TEST_CHECK(ffxFsr2ComputeHistogramExposureReference(&description) == FFX_ERROR_INVALID_POINTER);
+}
+
+} // namespace
+
+void TestHistogramExposure()
+{
+    testSingleBin();
+    testPercentileWindowIgnoresOutliers();
+    testPartialBins();
+    testAdaptationRates();
+    testInvalidSettings();
+}
@@ -0,0 +1,156 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <math.h>
+#include <stdint.h>
+#include <vector>
+#include "ffx_fsr2_reference.h"
+#include "TestHelpers.h"
+#include "Tests.h"
+
+namespace {
+
+const uint32_t kWidth = 128;
+const uint32_t kHeight = 4;
+
+typedef std::vector<float> Image;
+
+Image makeImage(float (*pattern)(uint32_t x))
+{
+    Image image(kWidth * kHeight * 4);
+    for (uint32_t y = 0; y < kHeight; ++y) {
+        for (uint32_t x = 0; x < kWidth; ++x) {
+            for (uint32_t channel = 0; channel < 4; ++channel) {
+                image[(y * kWidth + x) * 4 + channel] = pattern(x);
+            }
+        }
+    }
+    return image;
+}
+
+Image reproject(const Image& history, FfxFsr2HistoryReprojectionFilterReference filter, float pixelsPerFrame)
+{
+    Image reprojected(history.size());
+
+    FfxFsr2ReprojectHistoryReferenceDescription description = {};
+    description.history = history.data();
+    description.reprojectedHistory = reprojected.data();
+    description.displaySize = { kWidth, kHeight };
+    description.motionVector[0] = pixelsPerFrame / float(kWidth);
+    description.filter = filter;
+    TEST_CHECK(ffxFsr2ReprojectHistoryReference(&description) == FFX_OK);
+    return reprojected;
+}
+
+// the range of the red channel of the middle row, away from the image borders
+void measureRange(const Image& image, float* minimum, float* maximum)
+{
+    *minimum = 1e30f;
+    *maximum = -1e30f;
+    for (uint32_t x = 16; x < kWidth - 16; ++x) {
+        const float value = image[((kHeight / 2) * kWidth + x) * 4];
+        *minimum = fminf(*minimum, value);
+        *maximum = fmaxf(*maximum, value);
+    }
+}
+
+float sine8(uint32_t x)
+{
+    return 0.5f + 0.5f * sinf(float(x) * 2.0f * 3.14159265f / 8.0f);
+}
+
+float sine4(uint32_t x)
+{
+    return 0.5f + 0.5f * sinf(float(x) * 2.0f * 3.14159265f / 4.0f);
+}
+
+float edge(uint32_t x)
+{
+    return (x < kWidth / 2) ? 0.0f : 1.0f;
+}
+
+// The fraction of the contrast of a sine that is left after 16 reprojections of content moving 0.37 pixels per frame.
+float contrastRetention(float (*pattern)(uint32_t x), FfxFsr2HistoryReprojectionFilterReference filter)
+{
+    Image history = makeImage(pattern);
+
+    float originalMinimum, originalMaximum;
+    measureRange(history, &originalMinimum, &originalMaximum);
+    for (uint32_t frame = 0; frame < 16; ++frame) {
+        history = reproject(history, filter, 0.37f);
+    }
+
+    float minimum, maximum;
+    measureRange(history, &minimum, &maximum);
+    return (maximum - minimum) / (originalMaximum - originalMinimum);
+}
+
+// How far a single reprojection of a hard edge from 0 to 1 rings outside of [0, 1].
+float edgeOvershoot(FfxFsr2HistoryReprojectionFilterReference filter)
+{
+    float minimum, maximum;
+    measureRange(reproject(makeImage(edge), filter, 0.37f), &minimum, &maximum);
+    return fmaxf(0.0f, fmaxf(-minimum, maximum - 1.0f));
+}
+
+void testSharpnessAndRinging()
+{
+    const FfxFsr2HistoryReprojectionFilterReference lanczos = FFX_FSR2_HISTORY_REPROJECTION_FILTER_LANCZOS;
+    const FfxFsr2HistoryReprojectionFilterReference catmullRom = FFX_FSR2_HISTORY_REPROJECTION_FILTER_CATMULL_ROM;
+
+    const float sine8Lanczos = contrastRetention(sine8, lanczos);
+    const float sine8CatmullRom = contrastRetention(sine8, catmullRom);
+    const float sine4Lanczos = contrastRetention(sine4, lanczos);
+    const float sine4CatmullRom = contrastRetention(sine4, catmullRom);
+    const float overshootLanczos = edgeOvershoot(lanczos);
+    const float overshootCatmullRom = edgeOvershoot(catmullRom);
+
+    printf("    contrast kept after 16 frames, Catmull-Rom against Lanczos2: %.0f%% and %.0f%% of an 8 px sine, %.0f%% and %.0f%% of a 4 px sine\n",
+        sine8CatmullRom * 100.0f, sine8Lanczos * 100.0f, sine4CatmullRom * 100.0f, sine4Lanczos * 100.0f);
+
+    // Catmull-Rom blurs the history less at every frequency, for the sharper image the permutation is selected for
+    TEST_CHECK(sine8CatmullRom > sine8Lanczos + 0.1f);
+    TEST_CHECK(sine4CatmullRom > sine4Lanczos);
+    TEST_CHECK(sine8CatmullRom < 1.0f && sine4CatmullRom < sine8CatmullRom);
+
+    // its negative lobes ring on a hard edge, which RectifyHistory has to clamp, while the 5 taps keep it small
+    TEST_CHECK(overshootCatmullRom > 0.0f && overshootCatmullRom < 0.1f);
+    TEST_CHECK(overshootLanczos == 0.0f);
+}
+
+// Without motion both filters sample the texel centers and return the history unchanged.
+void testStaticHistory()
+{
+    const Image history = makeImage(sine8);
+    const Image lanczos = reproject(history, FFX_FSR2_HISTORY_REPROJECTION_FILTER_LANCZOS, 0.0f);
+    const Image catmullRom = reproject(history, FFX_FSR2_HISTORY_REPROJECTION_FILTER_CATMULL_ROM, 0.0f);
+
+    TEST_CHECK(MaxAbsDifference(lanczos, history) < 1e-5f);
+    TEST_CHECK(MaxAbsDifference(catmullRom, history) < 1e-5f);
+}
+
+} // namespace
+
+void TestHistoryReprojection()
+{
+    testSharpnessAndRinging();
+    testStaticHistory();
+}
@@ -0,0 +1,203 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <math.h>
+#include <stdint.h>
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include "ffx_fsr2_reference.h"
+#include "Tests.h"
+
+namespace {
+
+std::vector<std::pair<float, float>> phaseOffsets(FfxFsr2JitterSequence sequence, int32_t phaseCount)
+{
+    FfxFsr2JitterSequenceDescription description = {};
+    description.sequence = sequence;
+
+    std::vector<std::pair<float, float>> offsets(phaseCount);
+    for (int32_t index = 0; index < phaseCount; ++index) {
+        TEST_CHECK(ffxFsr2GetJitterOffsetEx(&offsets[index].first, &offsets[index].second, index, phaseCount, &description) == FFX_OK);
+    }
+    return offsets;
+}
+
+// the smallest distance between two of the first count offsets, on the unit torus like the ordering itself
+float minimumSpacing(const std::vector<std::pair<float, float>>& offsets, size_t count)
+{
+    float minimumDistance = 1.0f;
+    for (size_t a = 0; a < count; ++a) {
+        for (size_t b = a + 1; b < count; ++b) {
+
+            const float dx = fminf(fabsf(offsets[a].first - offsets[b].first), 1.0f - fabsf(offsets[a].first - offsets[b].first));
+            const float dy = fminf(fabsf(offsets[a].second - offsets[b].second), 1.0f - fabsf(offsets[a].second - offsets[b].second));
+            minimumDistance = fminf(minimumDistance, sqrtf(dx * dx + dy * dy));
+        }
+    }
+    return minimumDistance;
+}
+
+// The blue noise order only reorders the Halton(2,3) offsets of a phase, and spreads out its first offsets.
+void testBlueNoiseOrder()
+{
+    printf("    %-12s %22s %22s\n", "phase count", "Halton spacing of 8", "blue noise spacing of 8");
+    for (int32_t phaseCount : { 8, 18, 32, 72, 128, 256, 300 }) {
+
+        std::vector<std::pair<float, float>> halton = phaseOffsets(FFX_FSR2_JITTER_SEQUENCE_HALTON, phaseCount);
+        std::vector<std::pair<float, float>> blueNoise = phaseOffsets(FFX_FSR2_JITTER_SEQUENCE_HALTON_BLUE_NOISE_ORDER, phaseCount);
+
+        const float haltonSpacing = minimumSpacing(halton, 8);
+        const float blueNoiseSpacing = minimumSpacing(blueNoise, 8);
+        printf("    %-12d %22.3f %22.3f\n", phaseCount, haltonSpacing, blueNoiseSpacing);
+        TEST_CHECK(blueNoiseSpacing >= haltonSpacing);
+
+        // offsets past the ordered ones keep their Halton position
+        bool unorderedTailMatches = true;
+        for (int32_t index = 256; index < phaseCount; ++index) {
+            unorderedTailMatches = unorderedTailMatches && (blueNoise[index] == halton[index]);
+        }
+        TEST_CHECK(unorderedTailMatches);
+
+        std::sort(halton.begin(), halton.end());
+        std::sort(blueNoise.begin(), blueNoise.end());
+        TEST_CHECK(blueNoise == halton);
+    }
+}
+
+FfxFsr2JitterCoverageReferenceDescription measureCoverage(FfxFsr2JitterSequence sequence, int32_t displayWidth, int32_t frameCount)
+{
+    FfxFsr2JitterCoverageReferenceDescription description = {};
+    description.sequence.sequence = sequence;
+    description.renderWidth = 1280;
+    description.displayWidth = displayWidth;
+    description.frameCount = frameCount;
+    description.subPixelGridSize = 4;
+    TEST_CHECK(ffxFsr2MeasureJitterCoverageReference(&description) == FFX_OK);
+    return description;
+}
+
+// At 3x the phase has 72 offsets. The blue noise order leaves smaller gaps in a short window, but covers fewer cells
+// and reaches every display pixel 4 frames later than Halton(2,3). Over the phase both cover the same cells.
+void testCoverage()
+{
+    printf("    %-28s %10s %10s %10s\n", "3x upscale", "coverage", "max gap", "all pixels");
+    for (int32_t frameCount : { 9, 18, 0 }) {
+
+        const FfxFsr2JitterCoverageReferenceDescription halton = measureCoverage(FFX_FSR2_JITTER_SEQUENCE_HALTON, 3840, frameCount);
+        const FfxFsr2JitterCoverageReferenceDescription blueNoise = measureCoverage(FFX_FSR2_JITTER_SEQUENCE_HALTON_BLUE_NOISE_ORDER, 3840, frameCount);
+        for (const FfxFsr2JitterCoverageReferenceDescription* description : { &halton, &blueNoise }) {
+            printf("    %-10s %2d frames%-8s %9.1f%% %10.3f %10d\n", (description == &halton) ? "Halton" : "blue noise", frameCount ? frameCount : description->phaseCount, "",
+                description->meanCellCoverage * 100.0f, description->maxGapDistance, description->framesToCoverAllPixels);
+        }
+
+        TEST_CHECK(blueNoise.phaseCount == 72);
+        if (frameCount == 0) {
+            TEST_CHECK(blueNoise.meanCellCoverage == halton.meanCellCoverage);
+            TEST_CHECK(blueNoise.maxGapDistance == halton.maxGapDistance);
+        } else {
+            TEST_CHECK(blueNoise.maxGapDistance <= halton.maxGapDistance);
+            TEST_CHECK(blueNoise.meanCellCoverage < halton.meanCellCoverage);
+        }
+
+        // 9 frames are too few for either sequence to reach every display pixel.
+        if (frameCount == 9) {
+            TEST_CHECK(halton.framesToCoverAllPixels == -1);
+            TEST_CHECK(blueNoise.framesToCoverAllPixels == -1);
+        } else {
+            TEST_CHECK(halton.framesToCoverAllPixels == 12);
+            TEST_CHECK(blueNoise.framesToCoverAllPixels == 16);
+        }
+    }
+}
+
+// R2 leaves smaller gaps than Halton(2,3) over a full phase, from 1.5x to 3.5x.
+void testR2()
+{
+    printf("    %-12s %14s %14s\n", "display width", "Halton max gap", "R2 max gap");
+    for (int32_t displayWidth : { 1920, 2560, 2880, 3840, 4480 }) {
+
+        const FfxFsr2JitterCoverageReferenceDescription halton = measureCoverage(FFX_FSR2_JITTER_SEQUENCE_HALTON, displayWidth, 0);
+        const FfxFsr2JitterCoverageReferenceDescription r2 = measureCoverage(FFX_FSR2_JITTER_SEQUENCE_R2, displayWidth, 0);
+        printf("    %-12d %14.3f %14.3f\n", displayWidth, halton.maxGapDistance, r2.maxGapDistance);
+
+        TEST_CHECK(r2.phaseCount == halton.phaseCount);
+        TEST_CHECK(r2.maxGapDistance < halton.maxGapDistance);
+
+        // offsets stay inside the pixel and are all distinct.
+        std::vector<std::pair<float, float>> offsets = phaseOffsets(FFX_FSR2_JITTER_SEQUENCE_R2, r2.phaseCount);
+        bool inside = true;
+        for (const std::pair<float, float>& offset : offsets) {
+            inside = inside && offset.first >= -0.5f && offset.first < 0.5f && offset.second >= -0.5f && offset.second < 0.5f;
+        }
+        TEST_CHECK(inside);
+        std::sort(offsets.begin(), offsets.end());
+        TEST_CHECK(std::adjacent_find(offsets.begin(), offsets.end()) == offsets.end());
+    }
+}
+
+// A user table sets the phase count and is returned as is, wrapping around at its end.
+void testUserTable()
+{
+    const FfxFloatCoords2D table[] = { { 0.25f, -0.25f }, { -0.25f, 0.25f }, { -0.125f, -0.375f } };
+
+    FfxFsr2JitterSequenceDescription description = {};
+    description.sequence = FFX_FSR2_JITTER_SEQUENCE_USER_TABLE;
+    description.userTable = table;
+    description.userTableCount = 3;
+    TEST_CHECK(ffxFsr2GetJitterPhaseCountEx(1280, 3840, &description) == 3);
+    TEST_CHECK(ffxFsr2GetJitterPhaseCountEx(1920, 1920, &description) == 3);
+
+    bool matches = true;
+    for (int32_t index = 0; index < 7; ++index) {
+
+        float x = 0.0f;
+        float y = 0.0f;
+        TEST_CHECK(ffxFsr2GetJitterOffsetEx(&x, &y, index, 3, &description) == FFX_OK);
+        matches = matches && x == table[index % 3].x && y == table[index % 3].y;
+    }
+    TEST_CHECK(matches);
+
+    float x = 0.0f;
+    float y = 0.0f;
+    description.userTableCount = 0;
+    TEST_CHECK(ffxFsr2GetJitterOffsetEx(&x, &y, 0, 3, &description) == FFX_ERROR_INVALID_ARGUMENT);
+    description.userTableCount = 3;
+    description.userTable = nullptr;
+    TEST_CHECK(ffxFsr2GetJitterOffsetEx(&x, &y, 0, 3, &description) == FFX_ERROR_INVALID_POINTER);
+
+    // without a description the default sequence is Halton(2,3), as ffxFsr2GetJitterOffset.
+    float haltonX = 0.0f;
+    float haltonY = 0.0f;
+    TEST_CHECK(ffxFsr2GetJitterOffsetEx(&x, &y, 5, 72, nullptr) == FFX_OK);
+    TEST_CHECK(ffxFsr2GetJitterOffset(&haltonX, &haltonY, 5, 72) == FFX_OK);
+    TEST_CHECK(x == haltonX && y == haltonY);
+}
+
+} // namespace
+
+void TestJitterSequence()
+{
+    testBlueNoiseOrder();
+    testCoverage();
+    testR2();
+    testUserTable();
+}
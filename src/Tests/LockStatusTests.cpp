@@ -0,0 +1,139 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <math.h>
+#include <stdint.h>
+#include <vector>
+#include "ffx_fsr2_reference.h"
+#include "TestHelpers.h"
+#include "Tests.h"
+
+// Runs the lock status update over a sequence of frames with the default and the packed storage, to bound the drift
+// the 8-bit lifetime and temporal luma of the packed history add.
+namespace {
+
+const uint32_t kPixelCount = 4096;
+const uint32_t kFrameCount = 256;
+
+struct LockInputs {
+    std::vector<float> shadingChangeLuma;
+    std::vector<float> newLocks;
+    std::vector<float> upsampledWeight;
+    std::vector<float> reactiveFactor;
+};
+
+// Each pixel has its own luma, noise and lock rate between 2% and 22% of the frames, and a quarter of the pixels
+// step to a different luma now and then.
+LockInputs makeInputs()
+{
+    const size_t count = size_t(kPixelCount) * kFrameCount;
+    LockInputs inputs = { std::vector<float>(count), std::vector<float>(count), std::vector<float>(count), std::vector<float>(count, 0.0f) };
+
+    TestRandom random(83);
+    for (uint32_t pixel = 0; pixel < kPixelCount; ++pixel) {
+
+        float luma = random.NextFloat(0.2f, 1.2f);
+        const float noise = random.NextFloat(0.0f, 0.08f);
+        const float lockRate = random.NextFloat(0.02f, 0.22f);
+        const bool stepped = (pixel % 4) == 0;
+        for (uint32_t frame = 0; frame < kFrameCount; ++frame) {
+
+            if (stepped && random.NextFloat() < 0.02f) {
+                luma = random.NextFloat(0.2f, 1.2f);
+            }
+
+            const size_t index = size_t(frame) * kPixelCount + pixel;
+            inputs.shadingChangeLuma[index] = powf(luma * (1.0f + random.NextFloat(-noise, noise)), 1.0f / 6.0f);
+            inputs.newLocks[index] = (random.NextFloat() < lockRate) ? 1.0f : 0.0f;
+            inputs.upsampledWeight[index] = random.NextFloat(0.2f, 1.0f);
+        }
+    }
+    return inputs;
+}
+
+std::vector<float> simulate(const LockInputs& inputs, bool packedLockStatus, std::vector<float>* lockLifetime)
+{
+    std::vector<float> lockContribution(inputs.shadingChangeLuma.size());
+    lockLifetime->resize(inputs.shadingChangeLuma.size());
+
+    FfxFsr2LockStatusReferenceDescription description = {};
+    description.shadingChangeLuma = inputs.shadingChangeLuma.data();
+    description.newLocks = inputs.newLocks.data();
+    description.upsampledWeight = inputs.upsampledWeight.data();
+    description.reactiveFactor = inputs.reactiveFactor.data();
+    description.lockContribution = lockContribution.data();
+    description.lockLifetime = lockLifetime->data();
+    description.pixelCount = kPixelCount;
+    description.frameCount = kFrameCount;
+    description.jitterSequenceLength = 32;
+    description.packedLockStatus = packedLockStatus;
+    TEST_CHECK(ffxFsr2SimulateLockStatusReference(&description) == FFX_OK);
+    return lockContribution;
+}
+
+void testPackedDrift()
+{
+    const LockInputs inputs = makeInputs();
+
+    std::vector<float> lifetime, packedLifetime;
+    const std::vector<float> contribution = simulate(inputs, false, &lifetime);
+    const std::vector<float> packedContribution = simulate(inputs, true, &packedLifetime);
+
+    uint32_t lockedFrames = 0;
+    uint32_t lockedDifferences = 0;
+    for (size_t index = 0; index < contribution.size(); ++index) {
+        lockedFrames += (contribution[index] > 0.0f) ? 1 : 0;
+        lockedDifferences += ((contribution[index] > 0.0f) != (packedContribution[index] > 0.0f)) ? 1 : 0;
+    }
+
+    const float meanDifference = MeanAbsDifference(contribution, packedContribution);
+    const float lockedDifference = float(lockedDifferences) / float(contribution.size());
+    printf("    %u pixels over %u frames, locked in %.1f%%: contribution differs by %.4f on average, locked state in %.2f%%\n",
+        kPixelCount, kFrameCount, 100.0f * float(lockedFrames) / float(contribution.size()), meanDifference, 100.0f * lockedDifference);
+
+    // the packed history must keep locks alive, not just agree on pixels without any
+    TEST_CHECK(lockedFrames > contribution.size() / 10);
+    TEST_CHECK(meanDifference < 0.007f);
+    TEST_CHECK(lockedDifference < 0.004f);
+    TEST_CHECK(MeanAbsDifference(lifetime, packedLifetime) < 0.01f);
+}
+
+// Without new locks nothing is ever locked, with either storage.
+void testNoLocks()
+{
+    LockInputs inputs = makeInputs();
+    std::fill(inputs.newLocks.begin(), inputs.newLocks.end(), 0.0f);
+
+    std::vector<float> lifetime;
+    for (bool packedLockStatus : { false, true }) {
+
+        const std::vector<float> contribution = simulate(inputs, packedLockStatus, &lifetime);
+        TEST_CHECK(MaxAbsDifference(contribution, std::vector<float>(contribution.size(), 0.0f)) == 0.0f);
+    }
+}
+
+} // namespace
+
+void TestLockStatus()
+{
+    testPackedDrift();
+    testNoLocks();
+}
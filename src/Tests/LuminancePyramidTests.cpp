@@ -0,0 +1,123 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <algorithm>
+#include <math.h>
+#include <stdint.h>
+#include <vector>
+#include "ffx_fsr2_reference.h"
+#include "TestHelpers.h"
+#include "Tests.h"
+
+namespace {
+
+// Average the log luminance of the 2^(mipLevel + 1) square footprint of a mip texel directly from the source,
+// with pixels outside of validWidth x validHeight contributing zero like the out of screen loads of the GPU.
+double averageFootprint(const std::vector<float>& logLuma, FfxDimensions2D size, uint32_t validWidth, uint32_t validHeight, uint32_t mipLevel, uint32_t x, uint32_t y)
+{
+    const uint32_t footprint = 2u << mipLevel;
+
+    double sum = 0.0;
+    for (uint32_t sourceY = y * footprint; sourceY < (y + 1) * footprint && sourceY < validHeight; ++sourceY) {
+        for (uint32_t sourceX = x * footprint; sourceX < (x + 1) * footprint && sourceX < validWidth; ++sourceX) {
+            sum += logLuma[sourceY * size.width + sourceX];
+        }
+    }
+    return sum / (double(footprint) * double(footprint));
+}
+
+void testAgainstBruteForce(FfxDimensions2D size)
+{
+    TestRandom random(size.width);
+    std::vector<float> logLuma(size.width * size.height);
+    for (float& value : logLuma) {
+        value = random.NextFloat(-4.0f, 4.0f);
+    }
+
+    const uint32_t mipCount = std::min(uint32_t(floorf(log2f(float(std::max(size.width, size.height))))), 12u);
+
+    float maxError = 0.0f;
+    float averageLogLuma = 0.0f;
+    for (uint32_t mipLevel = 0; mipLevel < mipCount; ++mipLevel) {
+
+        const uint32_t mipWidth = std::max(1u, (size.width / 2) >> mipLevel);
+        const uint32_t mipHeight = std::max(1u, (size.height / 2) >> mipLevel);
+        std::vector<float> mip(mipWidth * mipHeight);
+
+        FfxFsr2LuminancePyramidReferenceDescription description = {};
+        description.logLuma = logLuma.data();
+        description.renderSize = size;
+        description.mipLevel = mipLevel;
+        description.mip = mip.data();
+        description.averageLogLuma = &averageLogLuma;
+        TEST_CHECK(ffxFsr2ComputeLuminancePyramidReference(&description) == FFX_OK);
+
+        // levels past 5 only see the texels of the level 5 texture, each of which covers 64x64 source pixels
+        uint32_t validWidth = size.width;
+        uint32_t validHeight = size.height;
+        if (mipLevel > 5) {
+            validWidth = std::min(validWidth, ((size.width / 2) >> 5) * 64);
+            validHeight = std::min(validHeight, ((size.height / 2) >> 5) * 64);
+        }
+
+        for (uint32_t y = 0; y < mipHeight; ++y) {
+            for (uint32_t x = 0; x < mipWidth; ++x) {
+                const double expected = averageFootprint(logLuma, size, validWidth, validHeight, mipLevel, x, y);
+                maxError = fmaxf(maxError, float(fabs(mip[y * mipWidth + x] - expected)));
+            }
+        }
+
+        // the exposure reads the first texel of the last level
+        if (mipLevel == mipCount - 1) {
+            TEST_CHECK(averageLogLuma == mip[0]);
+        }
+    }
+
+    printf("    %4ux%-4u %2u levels, max error against the brute force average %.2e\n", size.width, size.height, mipCount, maxError);
+    TEST_CHECK(maxError < 1e-5f);
+}
+
+void testInvalidArguments()
+{
+    const std::vector<float> logLuma(64 * 64, 0.0f);
+
+    FfxFsr2LuminancePyramidReferenceDescription description = {};
+    description.logLuma = logLuma.data();
+    description.renderSize = { 64, 64 };
+    description.mipLevel = 6;
+    TEST_CHECK(ffxFsr2ComputeLuminancePyramidReference(&description) == FFX_ERROR_INVALID_ARGUMENT);
+
+    description.mipLevel = 5;
+    TEST_CHECK(ffxFsr2ComputeLuminancePyramidReference(&description) == FFX_OK);
+
+    description.logLuma = nullptr;
+    TEST_CHECK(ffxFsr2ComputeLuminancePyramidReference(&description) == FFX_ERROR_INVALID_POINTER);
+}
+
+} // namespace
+
+void TestLuminancePyramid()
+{
+    testAgainstBruteForce({ 1920, 1080 });
+    testAgainstBruteForce({ 333, 200 });
+    testAgainstBruteForce({ 4096, 100 });
+    testInvalidArguments();
+}
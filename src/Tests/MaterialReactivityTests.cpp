@@ -0,0 +1,81 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <math.h>
+#include <stdint.h>
+#include <vector>
+#include "ffx_fsr2_reference.h"
+#include "Tests.h"
+
+// Each material ID picks its entry of the table, quantized to 8 bits like the table fsr2Create uploads. IDs past the
+// table read 0, and the authored masks win where they are larger.
+void TestMaterialReactivity()
+{
+    const FfxFsr2MaterialReactivity table[] = {
+        { 0.0f, 0.0f },     // opaque
+        { 0.9f, 0.0f },     // particles
+        { 0.5f, 0.3f },     // glass
+        { 1.5f, -1.0f },    // out of range values are saturated
+    };
+    const uint32_t materialIds[] = { 0, 1, 2, 3, 4, 255, 256, 0xFFFFFFFFu };
+    const uint32_t pixelCount = uint32_t(sizeof(materialIds) / sizeof(materialIds[0]));
+    const std::vector<float> reactive = { 0.2f, 0.2f, 0.7f, 0.0f, 0.4f, 0.0f, 0.0f, 0.1f };
+    const std::vector<float> transparencyAndComposition = { 0.0f, 0.6f, 0.0f, 0.0f, 0.0f, 0.3f, 0.0f, 0.0f };
+
+    std::vector<float> outputReactive(pixelCount);
+    std::vector<float> outputTransparencyAndComposition(pixelCount);
+
+    FfxFsr2MaterialReactivityReferenceDescription description = {};
+    description.materialId = materialIds;
+    description.outputReactive = outputReactive.data();
+    description.outputTransparencyAndComposition = outputTransparencyAndComposition.data();
+    description.renderSize = { pixelCount, 1 };
+    description.materialReactivity.table = table;
+    description.materialReactivity.count = uint32_t(sizeof(table) / sizeof(table[0]));
+
+    // without authored masks the table alone decides
+    TEST_CHECK(ffxFsr2MaterialReactivityReference(&description) == FFX_OK);
+    const float expectedReactive[] = { 0.0f, 230.0f / 255.0f, 128.0f / 255.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+    const float expectedTransparencyAndComposition[] = { 0.0f, 0.0f, 77.0f / 255.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+    for (uint32_t pixelIndex = 0; pixelIndex < pixelCount; ++pixelIndex) {
+        TEST_CHECK(outputReactive[pixelIndex] == expectedReactive[pixelIndex]);
+        TEST_CHECK(outputTransparencyAndComposition[pixelIndex] == expectedTransparencyAndComposition[pixelIndex]);
+    }
+
+    // with authored masks each output is the larger of the two
+    description.reactive = reactive.data();
+    description.transparencyAndComposition = transparencyAndComposition.data();
+    TEST_CHECK(ffxFsr2MaterialReactivityReference(&description) == FFX_OK);
+    for (uint32_t pixelIndex = 0; pixelIndex < pixelCount; ++pixelIndex) {
+        TEST_CHECK(outputReactive[pixelIndex] == fmaxf(reactive[pixelIndex], expectedReactive[pixelIndex]));
+        TEST_CHECK(outputTransparencyAndComposition[pixelIndex] == fmaxf(transparencyAndComposition[pixelIndex], expectedTransparencyAndComposition[pixelIndex]));
+    }
+    printf("    %u IDs match the quantized table, IDs past it read 0\n", pixelCount);
+
+    FfxFsr2MaterialReactivityReferenceDescription invalid = description;
+    invalid.materialReactivity.count = 0;
+    TEST_CHECK(ffxFsr2MaterialReactivityReference(&invalid) == FFX_ERROR_INVALID_ARGUMENT);
+    invalid.materialReactivity.count = FFX_FSR2_MAX_MATERIAL_IDS + 1;
+    TEST_CHECK(ffxFsr2MaterialReactivityReference(&invalid) == FFX_ERROR_INVALID_ARGUMENT);
+    invalid = description;
+    invalid.materialReactivity.table = nullptr;
+    TEST_CHECK(ffxFsr2MaterialReactivityReference(&invalid) == FFX_ERROR_INVALID_POINTER);
+}
@@ -0,0 +1,188 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdint.h>
+#include <vector>
+#include "ffx_fsr2_reference.h"
+#include "Tests.h"
+
+namespace {
+
+struct DilationScene {
+    FfxDimensions2D    size;
+    std::vector<float> depth;
+    std::vector<float> motionVectors;
+
+    DilationScene(uint32_t width, uint32_t height)
+        : size({ width, height })
+        , depth(width * height, 0.9f)
+        , motionVectors(width * height * 2, 0.0f)
+    {
+    }
+
+    void set(uint32_t x, uint32_t y, float pixelDepth, float motionX, float motionY)
+    {
+        const uint32_t index = y * size.width + x;
+        depth[index] = pixelDepth;
+        motionVectors[index * 2 + 0] = motionX;
+        motionVectors[index * 2 + 1] = motionY;
+    }
+
+    std::vector<float> dilate(FfxFsr2MotionVectorDilationMode mode, float* fetchesPerPixel = nullptr) const
+    {
+        std::vector<float> dilatedMotionVectors(motionVectors.size());
+
+        FfxFsr2DilateMotionVectorsReferenceDescription description = {};
+        description.depth = depth.data();
+        description.motionVectors = motionVectors.data();
+        description.dilatedMotionVectors = dilatedMotionVectors.data();
+        description.renderSize = size;
+        description.mode = mode;
+        description.fetchesPerPixel = fetchesPerPixel;
+        TEST_CHECK(ffxFsr2DilateMotionVectorsReference(&description) == FFX_OK);
+        return dilatedMotionVectors;
+    }
+};
+
+float lengthSquared(const float* motionVector)
+{
+    return motionVector[0] * motionVector[0] + motionVector[1] * motionVector[1];
+}
+
+uint32_t countMotionVector(const std::vector<float>& motionVectors, float motionX, float motionY)
+{
+    uint32_t count = 0;
+    for (size_t index = 0; index < motionVectors.size(); index += 2) {
+        count += (motionVectors[index + 0] == motionX && motionVectors[index + 1] == motionY) ? 1 : 0;
+    }
+    return count;
+}
+
+// The separable max filter must find the same maximum as a brute force search of the 5x5 neighborhood.
+void testMaxVelocityMatchesBruteForce()
+{
+    DilationScene scene(37, 23);
+    uint32_t seed = 1;
+    for (uint32_t y = 0; y < scene.size.height; ++y) {
+        for (uint32_t x = 0; x < scene.size.width; ++x) {
+
+            seed = seed * 1664525u + 1013904223u;
+            const float motionX = float(seed >> 8) / float(1 << 24) - 0.5f;
+            seed = seed * 1664525u + 1013904223u;
+            const float motionY = float(seed >> 8) / float(1 << 24) - 0.5f;
+            scene.set(x, y, 0.5f, motionX, motionY);
+        }
+    }
+
+    const std::vector<float> dilated = scene.dilate(FFX_FSR2_MOTION_VECTOR_DILATION_MODE_MAX_VELOCITY);
+    for (int32_t y = 0; y < int32_t(scene.size.height); ++y) {
+        for (int32_t x = 0; x < int32_t(scene.size.width); ++x) {
+
+            float maxVelocitySq = 0.0f;
+            for (int32_t sampleY = y - 2; sampleY <= y + 2; ++sampleY) {
+                for (int32_t sampleX = x - 2; sampleX <= x + 2; ++sampleX) {
+
+                    if (sampleX >= 0 && sampleY >= 0 && sampleX < int32_t(scene.size.width) && sampleY < int32_t(scene.size.height)) {
+                        const float velocitySq = lengthSquared(&scene.motionVectors[(sampleY * scene.size.width + sampleX) * 2]);
+                        maxVelocitySq = velocitySq > maxVelocitySq ? velocitySq : maxVelocitySq;
+                    }
+                }
+            }
+
+            TEST_CHECK(lengthSquared(&dilated[(y * scene.size.width + x) * 2]) == maxVelocitySq);
+        }
+    }
+}
+
+// On a tie the pixel keeps its own motion vector, like in FindMaxVelocity.
+void testMaxVelocityKeepsCenterOnTie()
+{
+    DilationScene scene(16, 16);
+    for (uint32_t y = 0; y < scene.size.height; ++y) {
+        for (uint32_t x = 0; x < scene.size.width; ++x) {
+            scene.set(x, y, 0.5f, ((x + y) & 1) ? 0.25f : 0.0f, ((x + y) & 1) ? 0.0f : -0.25f);
+        }
+    }
+
+    TEST_CHECK(scene.dilate(FFX_FSR2_MOTION_VECTOR_DILATION_MODE_MAX_VELOCITY) == scene.motionVectors);
+}
+
+// A one pixel wide wire in front of the background, compares how far each mode spreads the motion vector of the
+// wire, and how many motion vectors or depths the reference counts each pixel fetching from memory.
+void testModesOnThinWire()
+{
+    const uint32_t size = 64;
+    const uint32_t wireX = 32;
+    const float wireMotion = 0.01f;
+    const float backgroundMotion = 0.05f;
+
+    struct Mode {
+        const char*                     name;
+        FfxFsr2MotionVectorDilationMode mode;
+        uint32_t                        slowWireColumns;
+        uint32_t                        fastWireColumns;
+    } modes[] = {
+        { "None",               FFX_FSR2_MOTION_VECTOR_DILATION_MODE_NONE,              1, 1 },
+        { "3x3 nearest depth",  FFX_FSR2_MOTION_VECTOR_DILATION_MODE_NEAREST_DEPTH_3X3, 3, 3 },
+        { "5x5 nearest depth",  FFX_FSR2_MOTION_VECTOR_DILATION_MODE_NEAREST_DEPTH_5X5, 5, 5 },
+        { "Max velocity",       FFX_FSR2_MOTION_VECTOR_DILATION_MODE_MAX_VELOCITY,      0, 5 },
+    };
+    float fetchesPerPixel[FFX_FSR2_MOTION_VECTOR_DILATION_MODE_COUNT] = {};
+
+    printf("    %-20s %16s %16s %20s\n", "mode", "fetches/pixel", "slow wire width", "fast wire width");
+    for (const Mode& mode : modes) {
+
+        // a wire slower than the background is only spread by the nearest depth modes
+        DilationScene slowWire(size, size);
+        DilationScene fastWire(size, size);
+        for (uint32_t y = 0; y < size; ++y) {
+            for (uint32_t x = 0; x < size; ++x) {
+                slowWire.set(x, y, (x == wireX) ? 0.1f : 0.9f, (x == wireX) ? wireMotion : backgroundMotion, 0.0f);
+                fastWire.set(x, y, (x == wireX) ? 0.1f : 0.9f, (x == wireX) ? backgroundMotion : 0.0f, 0.0f);
+            }
+        }
+
+        const uint32_t slowWireColumns = countMotionVector(slowWire.dilate(mode.mode, &fetchesPerPixel[mode.mode]), wireMotion, 0.0f) / size;
+        const uint32_t fastWireColumns = countMotionVector(fastWire.dilate(mode.mode), backgroundMotion, 0.0f) / size;
+        printf("    %-20s %16.2f %16u %20u\n", mode.name, fetchesPerPixel[mode.mode], slowWireColumns, fastWireColumns);
+
+        TEST_CHECK(slowWireColumns == mode.slowWireColumns);
+        TEST_CHECK(fastWireColumns == mode.fastWireColumns);
+    }
+
+    // one depth and one motion vector without dilation, the 3x3 search loads its 9 depths even off screen, the 5x5
+    // search skips off screen depths, and the max velocity tile is shared by the 64 pixels of a group
+    TEST_CHECK(fetchesPerPixel[FFX_FSR2_MOTION_VECTOR_DILATION_MODE_NONE] == 2.0f);
+    TEST_CHECK(fetchesPerPixel[FFX_FSR2_MOTION_VECTOR_DILATION_MODE_NEAREST_DEPTH_3X3] == 10.0f);
+    TEST_CHECK(fetchesPerPixel[FFX_FSR2_MOTION_VECTOR_DILATION_MODE_NEAREST_DEPTH_5X5] > 25.0f);
+    TEST_CHECK(fetchesPerPixel[FFX_FSR2_MOTION_VECTOR_DILATION_MODE_NEAREST_DEPTH_5X5] < 26.0f);
+    TEST_CHECK(fetchesPerPixel[FFX_FSR2_MOTION_VECTOR_DILATION_MODE_MAX_VELOCITY] > 4.0f);
+    TEST_CHECK(fetchesPerPixel[FFX_FSR2_MOTION_VECTOR_DILATION_MODE_MAX_VELOCITY] < 144.0f / 64 + 2);
+}
+
+} // namespace
+
+void TestMotionVectorDilation()
+{
+    testMaxVelocityMatchesBruteForce();
+    testMaxVelocityKeepsCenterOnTie();
+    testModesOnThinWire();
+}
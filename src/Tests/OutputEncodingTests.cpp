@@ -0,0 +1,107 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <math.h>
+#include <stdint.h>
+#include <vector>
+#include "ffx_fsr2_reference.h"
+#include "TestHelpers.h"
+#include "Tests.h"
+
+namespace {
+
+std::vector<float> convert(FfxFsr2OutputEncoding encoding, float paperWhiteNits, const std::vector<float>& input, bool decode)
+{
+    std::vector<float> output(input.size());
+
+    FfxFsr2OutputEncodingReferenceDescription description = {};
+    description.outputEncoding.encoding = encoding;
+    description.outputEncoding.paperWhiteNits = paperWhiteNits;
+    description.input = input.data();
+    description.output = output.data();
+    description.pixelCount = uint32_t(input.size() / 3);
+    TEST_CHECK((decode ? ffxFsr2DecodeOutputReference(&description) : ffxFsr2EncodeOutputReference(&description)) == FFX_OK);
+    return output;
+}
+
+// Known points of the curves: PQ maps 10000 nits to 1 and 100 nits to 0.508, scRGB maps 80 nits to 1.
+void testKnownValues()
+{
+    const std::vector<float> white = { 1.0f, 1.0f, 1.0f };
+
+    const std::vector<float> pqPeak = convert(FFX_FSR2_OUTPUT_ENCODING_PQ_BT2020, 10000.0f, white, false);
+    const std::vector<float> pq100 = convert(FFX_FSR2_OUTPUT_ENCODING_PQ_BT2020, 100.0f, white, false);
+    const std::vector<float> scRgb = convert(FFX_FSR2_OUTPUT_ENCODING_SCRGB, 200.0f, white, false);
+    const std::vector<float> linear = convert(FFX_FSR2_OUTPUT_ENCODING_LINEAR, 200.0f, { 0.25f, 2.0f, 7.0f }, false);
+    const std::vector<float> defaultPaperWhite = convert(FFX_FSR2_OUTPUT_ENCODING_SCRGB, 0.0f, white, false);
+
+    for (uint32_t channel = 0; channel < 3; ++channel) {
+        TEST_CHECK(fabsf(pqPeak[channel] - 1.0f) < 1e-5f);
+        TEST_CHECK(fabsf(pq100[channel] - 0.5081f) < 1e-3f);
+        TEST_CHECK(fabsf(scRgb[channel] - 2.5f) < 1e-6f);
+        TEST_CHECK(fabsf(defaultPaperWhite[channel] - 2.5f) < 1e-6f);
+    }
+    TEST_CHECK(linear == std::vector<float>({ 0.25f, 2.0f, 7.0f }));
+}
+
+// Encoding then decoding random colors up to the PQ peak returns them to within 2e-4 of their largest component.
+void testRoundTrip()
+{
+    const float paperWhiteNits = 200.0f;
+    const uint32_t pixelCount = 100000;
+
+    TestRandom random(1);
+    std::vector<float> colors(pixelCount * 3);
+    for (uint32_t pixel = 0; pixel < pixelCount; ++pixel) {
+
+        // spread over the range logarithmically, from 0.01 nits to the 10000 nits PQ peak
+        const float peak = powf(10.0f, random.NextFloat(-2.0f, 4.0f)) / paperWhiteNits;
+        for (uint32_t channel = 0; channel < 3; ++channel) {
+            colors[pixel * 3 + channel] = peak * random.NextFloat();
+        }
+    }
+
+    printf("    %-12s %24s\n", "encoding", "max relative round trip");
+    for (FfxFsr2OutputEncoding encoding : { FFX_FSR2_OUTPUT_ENCODING_PQ_BT2020, FFX_FSR2_OUTPUT_ENCODING_SCRGB }) {
+
+        const std::vector<float> decoded = convert(encoding, paperWhiteNits, convert(encoding, paperWhiteNits, colors, false), true);
+
+        float maxError = 0.0f;
+        for (uint32_t pixel = 0; pixel < pixelCount; ++pixel) {
+
+            const float* color = &colors[pixel * 3];
+            const float maximum = fmaxf(color[0], fmaxf(color[1], color[2]));
+            for (uint32_t channel = 0; channel < 3; ++channel) {
+                maxError = fmaxf(maxError, fabsf(decoded[pixel * 3 + channel] - color[channel]) / fmaxf(maximum, 1e-6f));
+            }
+        }
+        printf("    %-12s %24.7f\n", (encoding == FFX_FSR2_OUTPUT_ENCODING_PQ_BT2020) ? "PQ/BT.2020" : "scRGB", maxError);
+        TEST_CHECK(maxError < 2e-4f);
+    }
+}
+
+} // namespace
+
+void TestOutputEncoding()
+{
+    testKnownValues();
+    testRoundTrip();
+}
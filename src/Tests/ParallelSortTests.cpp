@@ -0,0 +1,126 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdint.h>
+#include <algorithm>
+#include <numeric>
+#include <vector>
+#include "TestHelpers.h"
+#include "Tests.h"
+
+#define FFX_CPP
+#include "FFX_ParallelSort.h"
+
+// Runs the CPU reference of the segmented parallel sort and compares it with std::stable_sort on (segment, key).
+namespace {
+
+struct SortedSegments {
+    std::vector<uint32_t> keys;
+    std::vector<uint32_t> payload;
+    std::vector<uint32_t> heads;
+};
+
+SortedSegments sortReference(const std::vector<uint32_t>& segments, const std::vector<uint32_t>& keys, uint32_t segmentBits)
+{
+    const uint32_t keyCount = uint32_t(keys.size());
+    std::vector<uint32_t> segmentedKeys(keyCount);
+    std::vector<uint32_t> payload(keyCount);
+    for (uint32_t index = 0; index < keyCount; ++index) {
+
+        segmentedKeys[index] = FFX_ParallelSort_MakeSegmentedKey(segments[index], keys[index], segmentBits);
+        payload[index] = index;
+    }
+
+    SortedSegments sorted = { std::vector<uint32_t>(keyCount), std::vector<uint32_t>(keyCount), std::vector<uint32_t>((size_t(1) << segmentBits) + 1) };
+    FFX_ParallelSort_SegmentedSortReference(keyCount, segmentBits, segmentedKeys.data(), payload.data(), sorted.keys.data(), sorted.payload.data(), sorted.heads.data());
+    return sorted;
+}
+
+// Sorts by segment and then by the bits of the key that fit below the segment ID, keeping equal keys in input order.
+void checkAgainstStableSort(const std::vector<uint32_t>& segments, const std::vector<uint32_t>& keys, uint32_t segmentBits)
+{
+    const SortedSegments sorted = sortReference(segments, keys, segmentBits);
+
+    std::vector<uint32_t> expected(keys.size());
+    std::iota(expected.begin(), expected.end(), 0u);
+    std::stable_sort(expected.begin(), expected.end(), [&](uint32_t a, uint32_t b) {
+        const uint32_t keyA = keys[a] >> segmentBits;
+        const uint32_t keyB = keys[b] >> segmentBits;
+        return (segments[a] != segments[b]) ? (segments[a] < segments[b]) : (keyA < keyB);
+    });
+    TEST_CHECK(sorted.payload == expected);
+
+    // segment s occupies [heads[s], heads[s + 1]), empty segments get an empty range
+    const uint32_t segmentCount = 1u << segmentBits;
+    bool headsMatch = sorted.heads[segmentCount] == keys.size();
+    for (uint32_t segment = 0; segment < segmentCount; ++segment) {
+
+        const uint32_t expectedHead = uint32_t(std::count_if(segments.begin(), segments.end(), [&](uint32_t s) { return s < segment; }));
+        headsMatch = headsMatch && (sorted.heads[segment] == expectedHead);
+    }
+    TEST_CHECK(headsMatch);
+}
+
+std::vector<uint32_t> randomValues(uint32_t count, uint32_t seed, uint32_t range)
+{
+    TestRandom random(seed);
+    std::vector<uint32_t> values(count);
+    for (uint32_t& value : values) {
+
+        const uint32_t next = random.NextUint();
+        value = range ? (next >> 8) % range : next;
+    }
+    return values;
+}
+
+// 100K random keys in 200 of 256 segments, so some segments stay empty, and duplicate keys check stability.
+void testSegmentedSort()
+{
+    const uint32_t keyCount = 100000;
+    const std::vector<uint32_t> segments = randomValues(keyCount, 11, 200);
+    std::vector<uint32_t> keys = randomValues(keyCount, 23, 0);
+    for (uint32_t index = 0; index < keyCount; index += 7) {
+        keys[index] = keys[index / 2];
+    }
+
+    checkAgainstStableSort(segments, keys, 8);
+}
+
+// 0 segment bits is an unsegmented sort of the full 32 bit keys, with one segment spanning every key.
+void testUnsegmentedSort()
+{
+    TEST_CHECK(FFX_ParallelSort_MakeSegmentedKey(0, 0xDEADBEEFu, 0) == 0xDEADBEEFu);
+    TEST_CHECK(FFX_ParallelSort_MakeSegmentedKey(3, 0xDEADBEEFu, 2) == 0xF7AB6FBBu);
+
+    const uint32_t keyCount = 10000;
+    checkAgainstStableSort(std::vector<uint32_t>(keyCount, 0u), randomValues(keyCount, 5, 0), 0);
+
+    const SortedSegments empty = sortReference({}, {}, 0);
+    TEST_CHECK(empty.heads[0] == 0 && empty.heads[1] == 0);
+}
+
+} // namespace
+
+void TestParallelSort()
+{
+    testSegmentedSort();
+    testUnsegmentedSort();
+}
@@ -0,0 +1,151 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <math.h>
+#include <stdint.h>
+#include <algorithm>
+#include <vector>
+#include "ParticleCollision.h"
+#include "Tests.h"
+
+namespace {
+
+// The two by two by two box around the origin
+bool bakeBox( float voxelSize, ParticleCollisionVolume& volume )
+{
+    float positions[ 8 * 3 ];
+    for ( int corner = 0; corner < 8; corner++ )
+    {
+        positions[ corner * 3 + 0 ] = ( corner & 1 ) ? 1.0f : -1.0f;
+        positions[ corner * 3 + 1 ] = ( corner & 2 ) ? 1.0f : -1.0f;
+        positions[ corner * 3 + 2 ] = ( corner & 4 ) ? 1.0f : -1.0f;
+    }
+
+    const unsigned int indices[] = {
+        0, 2, 6,  0, 6, 4,     1, 5, 7,  1, 7, 3,
+        0, 4, 5,  0, 5, 1,     2, 3, 7,  2, 7, 6,
+        0, 1, 3,  0, 3, 2,     4, 6, 7,  4, 7, 5,
+    };
+    return BakeParticleCollisionVolume( positions, 8, indices, int( sizeof( indices ) / sizeof( indices[ 0 ] ) ), voxelSize, 0.25f, volume );
+}
+
+float boxDistance( const float position[ 3 ] )
+{
+    float outside = 0.0f;
+    float inside = -1e9f;
+    for ( int axis = 0; axis < 3; axis++ )
+    {
+        float d = fabsf( position[ axis ] ) - 1.0f;
+        outside += std::max( d, 0.0f ) * std::max( d, 0.0f );
+        inside = std::max( inside, d );
+    }
+    return sqrtf( outside ) + std::min( inside, 0.0f );
+}
+
+// The baked distances match the analytic box at the voxel centres, and trilinear samples between them stay within a voxel
+void testBakeMatchesBox()
+{
+    for ( float voxelSize : { 0.05f, 0.1f, 0.3f } )
+    {
+        ParticleCollisionVolume volume;
+        TEST_CHECK( bakeBox( voxelSize, volume ) );
+
+        float maxCentreError = 0.0f;
+        for ( int z = 0; z < volume.m_Resolution[ 2 ]; z++ )
+        {
+            for ( int y = 0; y < volume.m_Resolution[ 1 ]; y++ )
+            {
+                for ( int x = 0; x < volume.m_Resolution[ 0 ]; x++ )
+                {
+                    const int coords[ 3 ] = { x, y, z };
+                    float centre[ 3 ];
+                    for ( int axis = 0; axis < 3; axis++ )
+                        centre[ axis ] = volume.m_BoundsMin[ axis ] + ( coords[ axis ] + 0.5f ) * voxelSize;
+
+                    float baked = volume.m_Distances[ x + volume.m_Resolution[ 0 ] * ( y + volume.m_Resolution[ 1 ] * z ) ];
+                    maxCentreError = std::max( maxCentreError, fabsf( baked - boxDistance( centre ) ) );
+                }
+            }
+        }
+
+        float maxSampleError = 0.0f;
+        uint32_t seed = 1;
+        for ( int sample = 0; sample < 4096; sample++ )
+        {
+            float position[ 3 ];
+            for ( int axis = 0; axis < 3; axis++ )
+            {
+                seed = seed * 1664525u + 1013904223u;
+                position[ axis ] = -1.2f + 2.4f * float( seed >> 8 ) / float( 1 << 24 );
+            }
+
+            float gradientAndDistance[ 4 ];
+            TEST_CHECK( SampleParticleCollisionVolume( volume, position, gradientAndDistance ) );
+            maxSampleError = std::max( maxSampleError, fabsf( gradientAndDistance[ 3 ] - boxDistance( position ) ) );
+        }
+
+        printf( "    voxel size %.2f: largest error %.5f at the voxel centres, %.4f between them\n", voxelSize, maxCentreError, maxSampleError );
+        TEST_CHECK( maxCentreError < 1e-4f );
+        TEST_CHECK( maxSampleError < voxelSize );
+    }
+
+    // Positions outside the volume don't collide
+    ParticleCollisionVolume volume;
+    TEST_CHECK( bakeBox( 0.1f, volume ) );
+    const float outside[ 3 ] = { 0.0f, 2.0f, 0.0f };
+    float gradientAndDistance[ 4 ];
+    TEST_CHECK( !SampleParticleCollisionVolume( volume, outside, gradientAndDistance ) );
+
+    // A volume too thin to filter is never sampled
+    ParticleCollisionVolume thin = volume;
+    thin.m_Resolution[ 1 ] = 1;
+    const float centre[ 3 ] = {};
+    TEST_CHECK( !SampleParticleCollisionVolume( thin, centre, gradientAndDistance ) );
+}
+
+// A particle dropped on the box comes to rest on top of it, one radius above the surface
+void testParticleRestsOnBox()
+{
+    ParticleCollisionVolume volume;
+    TEST_CHECK( bakeBox( 0.1f, volume ) );
+
+    ParticleCollisionReferenceState particle;
+    particle.m_Position[ 1 ] = 1.2f;
+    particle.m_Mass = 1.0f;
+    particle.m_Radius = 0.05f;
+
+    const float frameTime = 1.0f / 60.0f;
+    for ( int frame = 0; frame < 600; frame++ )
+        SimulateParticleCollisionReference( volume, 0.5f, 0.1f, frameTime, &particle, 1 );
+
+    printf( "    particle at %.4f %.4f %.4f after %d collisions\n", particle.m_Position[ 0 ], particle.m_Position[ 1 ], particle.m_Position[ 2 ], particle.m_CollisionCount );
+    TEST_CHECK( fabsf( particle.m_Position[ 1 ] - 1.05f ) < 0.01f );
+    TEST_CHECK( fabsf( particle.m_Position[ 0 ] ) < 1.0f );
+    TEST_CHECK( particle.m_CollisionCount > 100 );
+}
+
+} // namespace
+
+void TestParticleCollision()
+{
+    testBakeMatchesBox();
+    testParticleRestsOnBox();
+}
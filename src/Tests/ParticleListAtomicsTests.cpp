@@ -0,0 +1,145 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdint.h>
+#include <algorithm>
+#include <vector>
+#include "TestHelpers.h"
+#include "Tests.h"
+
+// Emulates the dead list and alive list updates of CS_Emit and CS_Simulate on the CPU, once with an atomic per
+// lane as before and once with an atomic per wave, to check that both hand out the same slots.
+namespace {
+
+struct ListUpdate {
+    std::vector<int32_t> slots;         // the counter value each active lane works with, in lane order
+    int32_t              counter;       // the counter after the dispatch
+    uint32_t             atomics;       // the number of atomics on the counter
+};
+
+// Every lane with active[lane] set adds delta to the counter and works with the value the atomic returned.
+ListUpdate updatePerLane(const std::vector<bool>& active, int32_t counter, int32_t delta)
+{
+    ListUpdate update = { {}, counter, 0 };
+    for (size_t lane = 0; lane < active.size(); ++lane) {
+        if (active[lane]) {
+            update.slots.push_back(update.counter);
+            update.counter += delta;
+            ++update.atomics;
+        }
+    }
+    return update;
+}
+
+// The first active lane of each wave adds WaveActiveCountBits * delta, every lane offsets the value broadcast by
+// WaveReadLaneFirst by WavePrefixCountBits * delta.
+ListUpdate updatePerWave(const std::vector<bool>& active, int32_t counter, int32_t delta, uint32_t waveSize)
+{
+    ListUpdate update = { {}, counter, 0 };
+    for (size_t waveStart = 0; waveStart < active.size(); waveStart += waveSize) {
+
+        const size_t waveEnd = std::min(active.size(), waveStart + waveSize);
+        const int32_t activeLanes = int32_t(std::count(active.begin() + waveStart, active.begin() + waveEnd, true));
+        if (activeLanes == 0) {
+            continue;
+        }
+
+        const int32_t base = update.counter;
+        update.counter += activeLanes * delta;
+        ++update.atomics;
+
+        int32_t laneOffset = 0;
+        for (size_t lane = waveStart; lane < waveEnd; ++lane) {
+            if (active[lane]) {
+                update.slots.push_back(base + laneOffset * delta);
+                ++laneOffset;
+            }
+        }
+    }
+    return update;
+}
+
+// Both orders pop the same entries off the dead list, or append to the same entries of the alive list.
+bool sameSlots(ListUpdate perLane, ListUpdate perWave)
+{
+    std::sort(perLane.slots.begin(), perLane.slots.end());
+    std::sort(perWave.slots.begin(), perWave.slots.end());
+    return perLane.slots == perWave.slots && perLane.counter == perWave.counter;
+}
+
+// A burst of 400K particles emitted by 1024 lane groups, with a partial last group like in CS_Emit.
+void testEmitBurst()
+{
+    const uint32_t burst = 400000;
+    const int32_t deadParticles = 500000;
+
+    std::vector<bool> emitting(((burst + 1023) / 1024) * 1024, false);
+    std::fill(emitting.begin(), emitting.begin() + burst, true);
+
+    const ListUpdate perLane = updatePerLane(emitting, deadParticles, -1);
+    TEST_CHECK(perLane.atomics == burst);
+    TEST_CHECK(perLane.counter == deadParticles - int32_t(burst));
+
+    uint32_t atomics[2] = {};
+    for (uint32_t waveSize : { 32u, 64u }) {
+
+        const ListUpdate perWave = updatePerWave(emitting, deadParticles, -1, waveSize);
+        TEST_CHECK(sameSlots(perLane, perWave));
+
+        // one atomic per wave with an emitting lane, the idle lanes of the last group don't add one
+        TEST_CHECK(perWave.atomics == (burst + waveSize - 1) / waveSize);
+        atomics[waveSize / 64] = perWave.atomics;
+    }
+    printf("    400K emitted particles take %u atomics per lane, %u per wave of 32 and %u per wave of 64\n", perLane.atomics, atomics[0], atomics[1]);
+}
+
+// Particles dying at random spread the dead and alive lanes over every wave of CS_Simulate.
+void testSimulateAppends()
+{
+    const uint32_t particleCount = 100000;
+    std::vector<bool> dying(particleCount);
+    std::vector<bool> alive(particleCount);
+    TestRandom random(7);
+    for (uint32_t index = 0; index < particleCount; ++index) {
+
+        const uint32_t value = random.NextUint();
+        dying[index] = (value >> 28) == 0;
+        alive[index] = !dying[index] && ((value >> 27) & 1);
+    }
+
+    for (uint32_t waveSize : { 32u, 64u }) {
+
+        // the dead list grows from its counter, the alive list from 0 and the draw arguments by 6 indices per particle
+        const uint32_t aliveCount = uint32_t(std::count(alive.begin(), alive.end(), true));
+        TEST_CHECK(sameSlots(updatePerLane(dying, 1000, 1), updatePerWave(dying, 1000, 1, waveSize)));
+        TEST_CHECK(sameSlots(updatePerLane(alive, 0, 1), updatePerWave(alive, 0, 1, waveSize)));
+        TEST_CHECK(updatePerWave(alive, 0, 6, waveSize).counter == int32_t(aliveCount * 6));
+        TEST_CHECK(updatePerWave(alive, 0, 1, waveSize).atomics <= (particleCount + waveSize - 1) / waveSize);
+    }
+}
+
+} // namespace
+
+void TestParticleListAtomics()
+{
+    testEmitBurst();
+    testSimulateAppends();
+}
@@ -0,0 +1,164 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <math.h>
+#include <stdint.h>
+#include <algorithm>
+#include <vector>
+#include "TestHelpers.h"
+#include "Tests.h"
+#include "ParticleOIT.h"
+
+// Compares the weighted blended OIT reference with back to front blending of the same particle fragments.
+namespace {
+
+ParticleOITFragment fragment(float r, float g, float b, float a, float viewDepth)
+{
+    ParticleOITFragment result;
+    result.m_Color[0] = r;
+    result.m_Color[1] = g;
+    result.m_Color[2] = b;
+    result.m_Color[3] = a;
+    result.m_ViewDepth = viewDepth;
+    return result;
+}
+
+float maxDifference(const float a[3], const float b[3])
+{
+    return MaxAbsDifference(a, b, 3);
+}
+
+// Alpha blending in draw order, what skipping the sort without OIT would give
+void blendUnsorted(const std::vector<ParticleOITFragment>& fragments, const float sceneColor[3], float result[3])
+{
+    std::copy(sceneColor, sceneColor + 3, result);
+    for (const ParticleOITFragment& fragment : fragments) {
+        for (int c = 0; c < 3; ++c) {
+            result[c] = fragment.m_Color[c] * fragment.m_Color[3] + result[c] * (1.0f - fragment.m_Color[3]);
+        }
+    }
+}
+
+float differenceToSorted(const std::vector<ParticleOITFragment>& fragments, const float sceneColor[3])
+{
+    float oit[3], sorted[3];
+    ResolveParticleOITReference(fragments.data(), int(fragments.size()), sceneColor, oit);
+    BlendParticlesSortedReference(fragments.data(), int(fragments.size()), sceneColor, sorted);
+    return maxDifference(oit, sorted);
+}
+
+// Without overlap, or when every overlapping particle has the same color, the average color is exact.
+void testExactCases()
+{
+    const float sceneColor[3] = { 0.2f, 0.3f, 0.4f };
+
+    float result[3];
+    ResolveParticleOITReference(nullptr, 0, sceneColor, result);
+    TEST_CHECK(maxDifference(result, sceneColor) == 0.0f);
+
+    TEST_CHECK(differenceToSorted({ fragment(1.0f, 0.5f, 0.25f, 0.6f, 12.0f) }, sceneColor) < 1e-5f);
+    TEST_CHECK(differenceToSorted({ fragment(0.7f, 0.7f, 0.6f, 0.3f, 4.0f), fragment(0.7f, 0.7f, 0.6f, 0.5f, 30.0f),
+                                    fragment(0.7f, 0.7f, 0.6f, 0.2f, 90.0f) }, sceneColor) < 1e-5f);
+}
+
+// Overlapping fire and smoke particles in random draw order, as the unsorted particle list is drawn.
+void testOrderIndependence()
+{
+    const float sceneColor[3] = { 0.1f, 0.1f, 0.1f };
+
+    TestRandom random(3);
+
+    const int pixelCount = 1000;
+    float maxOrderDifference = 0.0f;
+    float sortedDifference = 0.0f;
+    float maxSortedDifference = 0.0f;
+    float unsortedDifference = 0.0f;
+    float maxUnsortedDifference = 0.0f;
+    float maxUnsortedOrderDifference = 0.0f;
+    for (int pixel = 0; pixel < pixelCount; ++pixel) {
+
+        std::vector<ParticleOITFragment> fragments;
+        const int layers = 1 + int(random.NextFloat() * 16.0f);
+        for (int layer = 0; layer < layers; ++layer) {
+
+            const float alpha = 0.05f + 0.25f * random.NextFloat();
+            const float viewDepth = 2.0f + 60.0f * random.NextFloat();
+            if (random.NextFloat() < 0.5f) {
+                const float gray = 0.1f + 0.2f * random.NextFloat();
+                fragments.push_back(fragment(gray, gray, gray, alpha, viewDepth));
+            } else {
+                fragments.push_back(fragment(1.0f, 0.4f + 0.3f * random.NextFloat(), 0.1f, alpha, viewDepth));
+            }
+        }
+
+        float first[3], reversed[3];
+        ResolveParticleOITReference(fragments.data(), int(fragments.size()), sceneColor, first);
+        std::reverse(fragments.begin(), fragments.end());
+        ResolveParticleOITReference(fragments.data(), int(fragments.size()), sceneColor, reversed);
+        maxOrderDifference = std::max(maxOrderDifference, maxDifference(first, reversed));
+
+        float sorted[3], unsorted[3], unsortedReversed[3];
+        BlendParticlesSortedReference(fragments.data(), int(fragments.size()), sceneColor, sorted);
+        blendUnsorted(fragments, sceneColor, unsortedReversed);
+        std::reverse(fragments.begin(), fragments.end());
+        blendUnsorted(fragments, sceneColor, unsorted);
+        unsortedDifference += maxDifference(unsorted, sorted);
+        maxUnsortedDifference = std::max(maxUnsortedDifference, maxDifference(unsorted, sorted));
+        maxUnsortedOrderDifference = std::max(maxUnsortedOrderDifference, maxDifference(unsorted, unsortedReversed));
+
+        const float difference = differenceToSorted(fragments, sceneColor);
+        sortedDifference += difference;
+        maxSortedDifference = std::max(maxSortedDifference, difference);
+    }
+
+    printf("    against sorted blending, OIT differs by %.4f on average and %.4f at most, unsorted blending by %.4f and %.4f\n",
+        sortedDifference / pixelCount, maxSortedDifference, unsortedDifference / pixelCount, maxUnsortedDifference);
+
+    // The draw order of the particle list changes from frame to frame, OIT doesn't flicker with it, and is closer to the
+    // sorted result than blending in whatever order the particles are drawn
+    TEST_CHECK(maxOrderDifference < 1e-5f);
+    TEST_CHECK(maxUnsortedOrderDifference > 0.1f);
+    TEST_CHECK(sortedDifference < 0.75f * unsortedDifference);
+    TEST_CHECK(maxSortedDifference < maxUnsortedDifference);
+}
+
+// The depth weight keeps a near particle in front of a far one of a different color.
+void testDepthWeight()
+{
+    const float sceneColor[3] = { 0.0f, 0.0f, 0.0f };
+    const std::vector<ParticleOITFragment> fragments = { fragment(0.0f, 0.0f, 1.0f, 0.5f, 80.0f), fragment(1.0f, 0.0f, 0.0f, 0.5f, 3.0f) };
+
+    float result[3];
+    ResolveParticleOITReference(fragments.data(), int(fragments.size()), sceneColor, result);
+    TEST_CHECK(result[0] > 10.0f * result[2]);
+    TEST_CHECK(ParticleOITWeight(1.0f, 0.0f) == 1.0f);
+    TEST_CHECK(ParticleOITWeight(0.5f, -25.0f) == 0.5f * expf(-1.0f));
+    TEST_CHECK(ParticleOITWeight(1.0f, 1000.0f) == 1e-2f);
+}
+
+} // namespace
+
+void TestParticleOIT()
+{
+    testExactCases();
+    testOrderIndependence();
+    testDepthWeight();
+}
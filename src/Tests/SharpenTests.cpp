@@ -0,0 +1,160 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <math.h>
+#include <stdint.h>
+#include <vector>
+#include "ffx_fsr2_reference.h"
+#include "TestHelpers.h"
+#include "Tests.h"
+
+namespace {
+
+const uint32_t kWidth = 96;
+const uint32_t kHeight = 64;
+
+// an image with edges, gradients and noise in every channel
+std::vector<float> makeImage(uint32_t width = kWidth, uint32_t height = kHeight)
+{
+    std::vector<float> image(width * height * 3);
+    TestRandom random(1);
+    for (uint32_t y = 0; y < height; ++y) {
+        for (uint32_t x = 0; x < width; ++x) {
+            for (uint32_t channel = 0; channel < 3; ++channel) {
+
+                const float noise = random.NextFloat();
+                const float edge = (((x / 7) + (y / 5) + channel) & 1) ? 0.8f : 0.2f;
+                image[(y * width + x) * 3 + channel] = edge * (0.5f + 0.5f * sinf(float(x + y) * 0.1f)) + 0.1f * noise;
+            }
+        }
+    }
+    return image;
+}
+
+std::vector<float> sharpen(const std::vector<float>& image, float sharpness, const std::vector<float>* sharpnessMap, FfxDimensions2D sharpnessMapSize)
+{
+    std::vector<float> output(image.size());
+
+    FfxFsr2SharpenReferenceDescription description = {};
+    description.input = image.data();
+    description.output = output.data();
+    description.displaySize = { kWidth, kHeight };
+    description.sharpness = sharpness;
+    description.sharpnessMap = sharpnessMap ? sharpnessMap->data() : nullptr;
+    description.sharpnessMapSize = sharpnessMapSize;
+    TEST_CHECK(ffxFsr2SharpenReference(&description) == FFX_OK);
+    return output;
+}
+
+} // namespace
+
+// A sharpness map holding 1 everywhere, at any resolution, leaves the output of RCAS bit-identical to the
+// output without a map, while a map holding 0 turns sharpening off, up to the approximate reciprocal of the resolve.
+void TestSharpen()
+{
+    const std::vector<float> image = makeImage();
+    const FfxDimensions2D mapSizes[] = { { 1, 1 }, { 37, 23 }, { kWidth, kHeight } };
+
+    for (float sharpness : { 0.0f, 0.3f, 0.8f, 1.0f }) {
+
+        const std::vector<float> scalar = sharpen(image, sharpness, nullptr, { 0, 0 });
+        for (const FfxDimensions2D& mapSize : mapSizes) {
+
+            const std::vector<float> ones(mapSize.width * mapSize.height, 1.0f);
+            TEST_CHECK(sharpen(image, sharpness, &ones, mapSize) == scalar);
+        }
+
+        const float maxScalarChange = MaxAbsDifference(scalar, image);
+        const std::vector<float> zeros(kWidth * kHeight, 0.0f);
+        const std::vector<float> unsharpened = sharpen(image, sharpness, &zeros, { kWidth, kHeight });
+        const float maxZeroChange = MaxAbsDifference(unsharpened, image);
+        printf("    sharpness %.1f: maps of 1 match the scalar path, largest change %.4f, %.4f with a map of 0\n", sharpness, maxScalarChange, maxZeroChange);
+        TEST_CHECK(maxScalarChange > 0.01f);
+        TEST_CHECK(maxZeroChange < 5e-3f);
+    }
+}
+
+// The depth edge limiter removes the halo RCAS leaves around a silhouette in front of the sky, while the
+// texture inside the silhouette is sharpened about the same; the few interior pixels whose depth footprint
+// still reaches the sky lose a little of their sharpening.
+void TestSharpenHalo()
+{
+    for (bool disableDenoise : { false, true }) {
+
+        FfxFsr2SharpenHaloReferenceDescription unlimited = {};
+        unlimited.renderSize = { 64, 43 };
+        unlimited.displaySize = { kWidth, kHeight };
+        unlimited.sharpness = 1.0f;
+        unlimited.disableDenoise = disableDenoise;
+        TEST_CHECK(ffxFsr2MeasureSharpenHaloReference(&unlimited) == FFX_OK);
+
+        FfxFsr2SharpenHaloReferenceDescription limited = unlimited;
+        limited.depthEdgeThreshold = 0.2f;
+        TEST_CHECK(ffxFsr2MeasureSharpenHaloReference(&limited) == FFX_OK);
+
+        printf("    denoise %s: largest halo %.4f, %.4f with a threshold of 0.2, interior sharpening %.4f and %.4f\n",
+            disableDenoise ? "off" : "on", unlimited.maxHalo, limited.maxHalo, unlimited.meanInteriorSharpening, limited.meanInteriorSharpening);
+        TEST_CHECK(unlimited.maxHalo > 0.05f);
+        TEST_CHECK(limited.maxHalo < 1e-3f);
+        TEST_CHECK(unlimited.meanInteriorSharpening > 0.0f);
+        TEST_CHECK(fabsf(limited.meanInteriorSharpening - unlimited.meanInteriorSharpening) < 0.05f * unlimited.meanInteriorSharpening);
+    }
+
+    FfxFsr2SharpenHaloReferenceDescription invalid = {};
+    invalid.renderSize = { 64, 43 };
+    invalid.displaySize = { 8, 8 };
+    TEST_CHECK(ffxFsr2MeasureSharpenHaloReference(&invalid) == FFX_ERROR_INVALID_ARGUMENT);
+}
+
+// Reading the taps from the groupshared tiles leaves the output of RCAS bit-identical, also for partial tiles along the
+// right and bottom edges. The GPU cost is compared with build/CompareBenchmarks.ps1 on the "FSR 2.0 RCAS" timestamp of
+// the samples, see the fsr2RcasTimestamp option.
+void TestSharpenGroupshared()
+{
+    const FfxDimensions2D sizes[] = { { kWidth, kHeight }, { 100, 70 }, { 1280, 720 } };
+
+    for (const FfxDimensions2D& size : sizes) {
+
+        const std::vector<float> image = makeImage(size.width, size.height);
+        const std::vector<float> viewDepth(size.width * size.height, 1.0f);
+
+        FfxFsr2SharpenReferenceDescription description = {};
+        description.input = image.data();
+        description.displaySize = size;
+        description.sharpness = 0.8f;
+        description.viewDepth = viewDepth.data();
+        description.renderSize = size;
+        description.depthEdgeThreshold = 0.1f;
+
+        std::vector<float> outputs[2];
+        for (int groupshared = 0; groupshared < 2; ++groupshared) {
+
+            outputs[groupshared].resize(image.size());
+            description.output = outputs[groupshared].data();
+            description.groupsharedTiles = groupshared != 0;
+            TEST_CHECK(ffxFsr2SharpenReference(&description) == FFX_OK);
+        }
+
+        printf("    %ux%u: groupshared tiles match the direct loads\n", size.width, size.height);
+        TEST_CHECK(outputs[1] == outputs[0]);
+        TEST_CHECK(outputs[0] != image);
+    }
+}
@@ -0,0 +1,155 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <math.h>
+#include <stdint.h>
+#include <vector>
+#include "ffx_fsr2_reference.h"
+#include "TestHelpers.h"
+#include "Tests.h"
+
+// Compares the transparency and composition mask generated with the compact luma history against the default
+// R11G11B10_FLOAT history, over frames of alpha blended smoke.
+namespace {
+
+const uint32_t kSize = 128;
+
+enum Background {
+    BACKGROUND_GRADIENT,
+    BACKGROUND_CHECKER,
+    BACKGROUND_NOISE,
+};
+
+struct Frame {
+    std::vector<float> opaqueOnly;
+    std::vector<float> color;
+};
+
+// The background scaled by lighting, with a disc of smoke of the given color and alpha blended on top.
+Frame renderFrame(Background background, float lighting, float smokeCenterX, const float smokeColor[3], float smokeAlpha)
+{
+    Frame frame = { std::vector<float>(kSize * kSize * 3), std::vector<float>(kSize * kSize * 3) };
+
+    TestRandom random(17);
+    for (uint32_t y = 0; y < kSize; ++y) {
+        for (uint32_t x = 0; x < kSize; ++x) {
+
+            const float dx = float(x) - smokeCenterX;
+            const float dy = float(y) - float(kSize / 2);
+            const bool smoke = dx * dx + dy * dy < 30.0f * 30.0f;
+            for (uint32_t channel = 0; channel < 3; ++channel) {
+
+                float value = 0.0f;
+                switch (background) {
+                case BACKGROUND_GRADIENT: value = float(x + channel * 20) / float(kSize + 40); break;
+                case BACKGROUND_CHECKER:  value = (((x / 8) + (y / 8)) & 1) ? 0.9f : 0.1f; break;
+                case BACKGROUND_NOISE:    value = random.NextFloat(); break;
+                }
+                value *= lighting;
+
+                const size_t index = (y * kSize + x) * 3 + channel;
+                frame.opaqueOnly[index] = value;
+                frame.color[index] = smoke ? (smokeColor[channel] * smokeAlpha + value * (1.0f - smokeAlpha)) : value;
+            }
+        }
+    }
+    return frame;
+}
+
+std::vector<float> generateMask(const Frame& previous, const Frame& current, bool compactHistory)
+{
+    std::vector<float> mask(kSize * kSize);
+
+    FfxFsr2TransparencyAndCompositionReferenceDescription description = {};
+    description.opaqueOnly = current.opaqueOnly.data();
+    description.color = current.color.data();
+    description.previousOpaqueOnly = previous.opaqueOnly.data();
+    description.previousColor = previous.color.data();
+    description.transparencyAndComposition = mask.data();
+    description.renderSize = { kSize, kSize };
+    description.autoTcThreshold = 0.05f;
+    description.compactHistory = compactHistory;
+    TEST_CHECK(ffxFsr2ComputeTransparencyAndCompositionReference(&description) == FFX_OK);
+    return mask;
+}
+
+float maximum(const std::vector<float>& mask)
+{
+    float result = 0.0f;
+    for (float value : mask) {
+        result = fmaxf(result, value);
+    }
+    return result;
+}
+
+// Moving smoke, with and without a change of the lighting, is marked by both histories to within a mean of 0.1. The
+// compact history marks any large change of luma, which includes dimming grey content the default history ignores.
+void testMovingSmoke()
+{
+    const float gray[3] = { 0.6f, 0.6f, 0.6f };
+    const char* backgroundNames[] = { "gradient", "checker", "noise" };
+
+    for (Background background : { BACKGROUND_GRADIENT, BACKGROUND_CHECKER, BACKGROUND_NOISE }) {
+        for (float lighting : { 1.0f, 0.7f }) {
+
+            const Frame previous = renderFrame(background, 1.0f, 60.0f, gray, 0.4f);
+            const Frame current = renderFrame(background, lighting, 64.0f, gray, 0.4f);
+            const std::vector<float> mask = generateMask(previous, current, false);
+            const std::vector<float> compactMask = generateMask(previous, current, true);
+
+            const float meanDifference = MeanAbsDifference(mask, compactMask);
+            printf("    %-8s %s: mean difference %.4f, largest mask %.2f and %.2f with the compact history\n", backgroundNames[background],
+                (lighting == 1.0f) ? "lit     " : "dimmed  ", meanDifference, maximum(mask), maximum(compactMask));
+            TEST_CHECK(meanDifference < 0.1f);
+            TEST_CHECK(maximum(mask) > 0.5f);
+            TEST_CHECK(maximum(compactMask) > 0.5f);
+        }
+    }
+}
+
+// Without any change between the frames only the rounding of the history remains, below the 0.01 the pass cleans up.
+void testStaticScene()
+{
+    const float gray[3] = { 0.6f, 0.6f, 0.6f };
+    const Frame frame = renderFrame(BACKGROUND_NOISE, 1.0f, 64.0f, gray, 0.4f);
+    TEST_CHECK(maximum(generateMask(frame, frame, false)) < 0.01f);
+    TEST_CHECK(maximum(generateMask(frame, frame, true)) < 0.01f);
+}
+
+// Smoke changing hue at constant luma is only seen by the default history.
+void testChromaChange()
+{
+    const float red[3] = { 0.8f, 0.2f, 0.2f };
+    const float blue[3] = { 0.2f, 0.2f, 0.8f };
+    const Frame previous = renderFrame(BACKGROUND_GRADIENT, 1.0f, 64.0f, red, 0.5f);
+    const Frame current = renderFrame(BACKGROUND_GRADIENT, 1.0f, 64.0f, blue, 0.5f);
+    TEST_CHECK(maximum(generateMask(previous, current, false)) > 0.5f);
+    TEST_CHECK(maximum(generateMask(previous, current, true)) < 0.01f);
+}
+
+} // namespace
+
+void TestTcrHistory()
+{
+    testMovingSmoke();
+    testStaticScene();
+    testChromaChange();
+}
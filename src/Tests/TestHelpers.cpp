@@ -0,0 +1,41 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <math.h>
+#include "TestHelpers.h"
+
+float MaxAbsDifference(const float* a, const float* b, size_t count)
+{
+    float maximum = 0.0f;
+    for (size_t index = 0; index < count; ++index) {
+        maximum = fmaxf(maximum, fabsf(a[index] - b[index]));
+    }
+    return maximum;
+}
+
+float MeanAbsDifference(const float* a, const float* b, size_t count)
+{
+    double sum = 0.0;
+    for (size_t index = 0; index < count; ++index) {
+        sum += fabs(double(a[index]) - double(b[index]));
+    }
+    return count ? float(sum / double(count)) : 0.0f;
+}
@@ -0,0 +1,68 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+// A linear congruential generator, so the random inputs of a test are the same with every C runtime.
+class TestRandom
+{
+public:
+    explicit TestRandom(uint32_t seed) : m_Seed(seed) {}
+
+    uint32_t NextUint()
+    {
+        m_Seed = m_Seed * 1664525u + 1013904223u;
+        return m_Seed;
+    }
+
+    // uniform in [0, 1)
+    float NextFloat()
+    {
+        return float(NextUint() >> 8) / float(1 << 24);
+    }
+
+    // uniform in [minimum, maximum)
+    float NextFloat(float minimum, float maximum)
+    {
+        return minimum + (maximum - minimum) * NextFloat();
+    }
+
+private:
+    uint32_t m_Seed;
+};
+
+// The largest and the mean absolute difference of two arrays of count floats.
+float MaxAbsDifference(const float* a, const float* b, size_t count);
+float MeanAbsDifference(const float* a, const float* b, size_t count);
+
+inline float MaxAbsDifference(const std::vector<float>& a, const std::vector<float>& b)
+{
+    return MaxAbsDifference(a.data(), b.data(), a.size());
+}
+
+inline float MeanAbsDifference(const std::vector<float>& a, const std::vector<float>& b)
+{
+    return MeanAbsDifference(a.data(), b.data(), a.size());
+}
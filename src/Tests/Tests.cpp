@@ -0,0 +1,60 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "Tests.h"
+
+int g_failedChecks = 0;
+
+int main()
+{
+    struct {
+        const char* name;
+        void        (*run)();
+    } groups[] = {
+        { "Motion vector dilation", TestMotionVectorDilation },
+        { "Histogram exposure",     TestHistogramExposure },
+        { "Luminance pyramid",      TestLuminancePyramid },
+        { "Particle list atomics",  TestParticleListAtomics },
+        { "TCR history",            TestTcrHistory },
+        { "History reprojection",   TestHistoryReprojection },
+        { "Lock status",            TestLockStatus },
+        { "Parallel sort",          TestParallelSort },
+        { "Particle OIT",           TestParticleOIT },
+        { "Jitter sequence",        TestJitterSequence },
+        { "Debug views",            TestDebugView },
+        { "Alpha upscaling",        TestAlphaUpscale },
+        { "Output encoding",        TestOutputEncoding },
+        { "Sharpening",             TestSharpen },
+        { "Sharpening halos",       TestSharpenHalo },
+        { "Groupshared sharpening", TestSharpenGroupshared },
+        { "Material reactivity",    TestMaterialReactivity },
+        { "Particle collision",     TestParticleCollision },
+    };
+
+    for (const auto& group : groups) {
+
+        printf("%s\n", group.name);
+        group.run();
+    }
+
+    printf("%d failed checks\n", g_failedChecks);
+    return g_failedChecks ? 1 : 0;
+}
@@ -0,0 +1,55 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <stdio.h>
+
+// The number of failed checks, the test executable fails when it is not zero.
+extern int g_failedChecks;
+
+#define TEST_CHECK(condition)                                                                   \
+    do {                                                                                        \
+        if (!(condition)) {                                                                     \
+            printf("%s(%d): check failed: %s\n", __FILE__, __LINE__, #condition);               \
+            ++g_failedChecks;                                                                   \
+        }                                                                                       \
+    } while (0)
+
+// One function per group of tests, called in order by main.
+void TestMotionVectorDilation();
+void TestHistogramExposure();
+void TestLuminancePyramid();
+void TestParticleListAtomics();
+void TestTcrHistory();
+void TestHistoryReprojection();
+void TestLockStatus();
+void TestParallelSort();
+void TestParticleOIT();
+void TestJitterSequence();
+void TestDebugView();
+void TestAlphaUpscale();
+void TestOutputEncoding();
+void TestSharpen();
+void TestSharpenHalo();
+void TestSharpenGroupshared();
+void TestMaterialReactivity();
+void TestParticleCollision();
@@ -72,6 +72,7 @@ private:
         float                               frameTime = 0.0f;
         int                                 numEmitters = 0;
         IParticleSystem::EmitterParams      emitters[10] = {};
+        std::vector<IParticleSystem::EmitterParams> splitEmitters;
         int                                 flags = 0;
         IParticleSystem::ConstantData       constantData = {};
     };
@@ -84,6 +85,7 @@ private:
 
     void ResetScene();
     void PopulateEmitters(bool playAnimations, int activeScene, float frameTime);
+    void SplitEmitters(int emitterCount);
 
     Device *m_pDevice;
 
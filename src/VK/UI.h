@@ -92,6 +92,8 @@ struct UIState
 
     int   nLightModulationMode = 0;
     bool  bRenderParticleSystem = true;
+    bool  bParticleSDFCollision = true;
+    bool  bParticleOIT = false;
     bool  bRenderAnimatedTextures = true;
     bool  bUseMagnifier;
     bool  bLockMagnifierPosition;
@@ -126,6 +128,8 @@ struct UIState
 
     // FSR2 reactive mask
     ReactiveMaskMode            nReactiveMaskMode = REACTIVE_MASK_MODE_ON;
+    float                       fParticleReactiveScale = 1.f;
+    float                       fParticleReactiveMax = 1.f;
     float                       fFsr2AutoReactiveScale = 1.f;
     float                       fFsr2AutoReactiveThreshold = 0.2f;
     float                       fFsr2AutoReactiveBinaryValue = 0.9f;
@@ -137,6 +141,17 @@ struct UIState
     // FSR2 composition mask
     bool                        bCompositionMask = true;
 
+    // FSR2 context creation options, only read from the json globals
+    int                         nFsr2MotionVectorDilationMode = 0; // FFX_FSR2_MOTION_VECTOR_DILATION_MODE_NEAREST_DEPTH_3X3
+    bool                        bFsr2GroupsharedRcas = false;      // FFX_FSR2_ENABLE_GROUPSHARED_RCAS
+    bool                        bFsr2RcasTimestamp = false;        // split the GPU time of FSR2 into "FSR 2.0 API" and "FSR 2.0 RCAS"
+
+    // Number of emitters the particles of the scene are split over, only read from the json globals to benchmark the emit dispatch
+    int                         nParticleEmitterCount = 0;
+
+    // FSR2 debug view
+    int                         nFsr2DebugView = 0; // FFX_FSR2_DEBUG_VIEW_NONE
+
     // FSR2
     bool                        bUseDebugOut = false;
     int                         nDebugBlitSurface = 6; // FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_UPSCALED_COLOR
@@ -40,6 +40,10 @@ public:
         VkFormat         outFormat;
         UploadHeap* pUploadHeap;
         uint32_t            maxQueuedFrames;
+        int                 nFsr2MotionVectorDilationMode;
+        bool                bFsr2GroupsharedRcas;
+        bool                bFsr2RcasTimestamp;
+        GPUTimestamps*      pGPUTimer;
     }FfxUpscaleInitParams;
 
     typedef struct
@@ -99,6 +103,10 @@ protected:
     std::string                 m_Name;
 
     bool                        m_bInvertedDepth;
+    int                         m_nFsr2MotionVectorDilationMode;
+    bool                        m_bFsr2GroupsharedRcas;
+    bool                        m_bFsr2RcasTimestamp;
+    GPUTimestamps*              m_pGPUTimer;
 
     bool                        m_bUseTaa;
     uint32_t                    m_renderWidth, m_renderHeight;
@@ -94,6 +94,39 @@ static void onFSR2Msg(FfxFsr2MsgType type, const wchar_t* message)
     OutputDebugStringW(L"\n");
 }
 
+// With "fsr2RcasTimestamp" the jobs FSR2 scheduled before its RCAS job are executed as soon as the RCAS job is
+// scheduled, and the "FSR 2.0 API" timestamp is written after them, so the renderer's next timestamp covers RCAS alone.
+static FfxFsr2ScheduleGpuJobFunc s_fpScheduleGpuJob = nullptr;
+static GPUTimestamps* s_pRcasGPUTimer = nullptr;
+static VkCommandBuffer s_rcasCommandList = {};
+static bool s_bRcasTimestampWritten = false;
+
+static FfxErrorCode scheduleGpuJobBeforeRcasTimestamp(FfxFsr2Interface* backendInterface, const FfxGpuJobDescription* job)
+{
+    bool isRcasJob = false;
+    if (job->jobType == FFX_GPU_JOB_COMPUTE)
+    {
+        for (uint32_t srvIndex = 0; srvIndex < job->computeJobDescriptor.pipeline.srvCount; ++srvIndex)
+        {
+            isRcasJob = isRcasJob || wcscmp(job->computeJobDescriptor.srvNames[srvIndex], L"r_rcas_input") == 0;
+        }
+    }
+
+    if (isRcasJob && s_pRcasGPUTimer != nullptr)
+    {
+        const FfxErrorCode errorCode = backendInterface->fpExecuteGpuJobs(backendInterface, ffxGetCommandListVK(s_rcasCommandList));
+        if (errorCode != FFX_OK)
+        {
+            return errorCode;
+        }
+
+        s_pRcasGPUTimer->GetTimeStamp(s_rcasCommandList, "FSR 2.0 API");
+        s_bRcasTimestampWritten = true;
+    }
+
+    return s_fpScheduleGpuJob(backendInterface, job);
+}
+
 void UpscaleContext_FSR2_API::OnCreateWindowSizeDependentResources(
     VkImageView input, 
     VkImageView output, 
@@ -117,11 +150,16 @@ void UpscaleContext_FSR2_API::OnCreateWindowSizeDependentResources(
     initializationParameters.displaySize.width = displayWidth;
     initializationParameters.displaySize.height = displayHeight;
     initializationParameters.flags = FFX_FSR2_ENABLE_AUTO_EXPOSURE;
+    initializationParameters.motionVectorDilationMode = (FfxFsr2MotionVectorDilationMode)m_nFsr2MotionVectorDilationMode;
 
     if (m_bInvertedDepth) {
         initializationParameters.flags |= FFX_FSR2_ENABLE_DEPTH_INVERTED | FFX_FSR2_ENABLE_DEPTH_INFINITE;
     }
 
+    if (m_bFsr2GroupsharedRcas) {
+        initializationParameters.flags |= FFX_FSR2_ENABLE_GROUPSHARED_RCAS;
+    }
+
     if (m_enableDebugCheck)
     {
         initializationParameters.flags |= FFX_FSR2_ENABLE_DEBUG_CHECKING;
@@ -131,6 +169,12 @@ void UpscaleContext_FSR2_API::OnCreateWindowSizeDependentResources(
     // Input data is HDR
     initializationParameters.flags |= FFX_FSR2_ENABLE_HIGH_DYNAMIC_RANGE;
 
+    if (m_bFsr2RcasTimestamp)
+    {
+        s_fpScheduleGpuJob = initializationParameters.callbacks.fpScheduleGpuJob;
+        initializationParameters.callbacks.fpScheduleGpuJob = scheduleGpuJobBeforeRcasTimestamp;
+    }
+
     const uint64_t memoryUsageBefore = getMemoryUsageSnapshot(m_pDevice->GetPhysicalDevice());
     ffxFsr2ContextCreate(&context, &initializationParameters);
     const uint64_t memoryUsageAfter = getMemoryUsageSnapshot(m_pDevice->GetPhysicalDevice());
@@ -233,6 +277,7 @@ void UpscaleContext_FSR2_API::Draw(VkCommandBuffer commandBuffer, const FfxUpsca
     dispatchParameters.reset = pState->bReset;
     dispatchParameters.enableSharpening = pState->bUseRcas;
     dispatchParameters.sharpness = pState->sharpening;
+    dispatchParameters.debugView = (FfxFsr2DebugView)pState->nFsr2DebugView;
     dispatchParameters.frameTimeDelta = (float)pState->deltaTime;
     dispatchParameters.preExposure = 1.0f;
     dispatchParameters.renderSize.width = pState->renderWidth;
@@ -242,6 +287,23 @@ void UpscaleContext_FSR2_API::Draw(VkCommandBuffer commandBuffer, const FfxUpsca
     dispatchParameters.cameraFovAngleVertical = pState->camera.GetFovV();
     pState->bReset = false;
 
+    if (m_bFsr2RcasTimestamp)
+    {
+        s_pRcasGPUTimer = m_pGPUTimer;
+        s_rcasCommandList = commandBuffer;
+        s_bRcasTimestampWritten = false;
+    }
+
     FfxErrorCode errorCode = ffxFsr2ContextDispatch(&context, &dispatchParameters);
     FFX_ASSERT(errorCode == FFX_OK);
+
+    // without sharpening there is no RCAS job, the renderer's "FSR 2.0 RCAS" timestamp is then empty
+    if (m_bFsr2RcasTimestamp)
+    {
+        if (!s_bRcasTimestampWritten)
+        {
+            m_pGPUTimer->GetTimeStamp(commandBuffer, "FSR 2.0 API");
+        }
+        s_pRcasGPUTimer = nullptr;
+    }
 }
\ No newline at end of file
@@ -587,6 +587,7 @@ FfxErrorCode GetDeviceCapabilitiesDX12(FfxFsr2Interface* backendInterface, FfxDe
     }
 
     // check if we can force wave64 mode.
+    deviceCapabilities->waveLaneShuffleSupported = false;
     D3D12_FEATURE_DATA_D3D12_OPTIONS1 d3d12Options1 = {};
     if (SUCCEEDED(dx12Device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS1, &d3d12Options1, sizeof(d3d12Options1)))) {
 
@@ -594,6 +595,7 @@ FfxErrorCode GetDeviceCapabilitiesDX12(FfxFsr2Interface* backendInterface, FfxDe
         const uint32_t waveLaneCountMax = d3d12Options1.WaveLaneCountMax;
         deviceCapabilities->waveLaneCountMin = waveLaneCountMin;
         deviceCapabilities->waveLaneCountMax = waveLaneCountMax;
+        deviceCapabilities->waveLaneShuffleSupported = !!d3d12Options1.WaveOps;
     }
 
     // check if we have 16bit floating point.
@@ -997,8 +999,21 @@ FfxErrorCode CreatePipelineDX12(
     flags |= (pipelineDescription->contextFlags & FFX_FSR2_ENABLE_DISPLAY_RESOLUTION_MOTION_VECTORS) ? 0 : FSR2_SHADER_PERMUTATION_LOW_RES_MOTION_VECTORS;
     flags |= (pipelineDescription->contextFlags & FFX_FSR2_ENABLE_MOTION_VECTORS_JITTER_CANCELLATION) ? FSR2_SHADER_PERMUTATION_JITTER_MOTION_VECTORS : 0;
     flags |= (pipelineDescription->contextFlags & FFX_FSR2_ENABLE_DEPTH_INVERTED) ? FSR2_SHADER_PERMUTATION_DEPTH_INVERTED : 0;
+    flags |= ((pipelineDescription->motionVectorDilationMode & 1) && (pass == FFX_FSR2_PASS_RECONSTRUCT_PREVIOUS_DEPTH)) ? FSR2_SHADER_PERMUTATION_MOTION_VECTOR_DILATION_0 : 0;
+    flags |= ((pipelineDescription->motionVectorDilationMode & 2) && (pass == FFX_FSR2_PASS_RECONSTRUCT_PREVIOUS_DEPTH)) ? FSR2_SHADER_PERMUTATION_MOTION_VECTOR_DILATION_1 : 0;
     flags |= (pass == FFX_FSR2_PASS_ACCUMULATE_SHARPEN) ? FSR2_SHADER_PERMUTATION_ENABLE_SHARPENING : 0;
     flags |= (useLut) ? FSR2_SHADER_PERMUTATION_USE_LANCZOS_TYPE : 0;
+    flags |= ((pipelineDescription->contextFlags & FFX_FSR2_ENABLE_COMPACT_TCR_HISTORY) && (pass == FFX_FSR2_PASS_TCR_AUTOGENERATE)) ? FSR2_SHADER_PERMUTATION_COMPACT_TCR_HISTORY : 0;
+    flags |= ((pipelineDescription->contextFlags & FFX_FSR2_ENABLE_CATMULL_ROM_REPROJECTION) && (pass == FFX_FSR2_PASS_ACCUMULATE || pass == FFX_FSR2_PASS_ACCUMULATE_SHARPEN)) ? FSR2_SHADER_PERMUTATION_REPROJECT_CATMULL_ROM : 0;
+    flags |= ((pipelineDescription->contextFlags & FFX_FSR2_ENABLE_PACKED_LOCK_STATUS) && (pass == FFX_FSR2_PASS_ACCUMULATE || pass == FFX_FSR2_PASS_ACCUMULATE_SHARPEN || pass == FFX_FSR2_PASS_RCAS)) ? FSR2_SHADER_PERMUTATION_PACKED_LOCK_STATUS : 0;
+    flags |= ((pipelineDescription->contextFlags & FFX_FSR2_ENABLE_DISPLAY_RESOLUTION_DEPTH_OUTPUT) && (pass == FFX_FSR2_PASS_ACCUMULATE || pass == FFX_FSR2_PASS_ACCUMULATE_SHARPEN)) ? FSR2_SHADER_PERMUTATION_UPSCALED_DEPTH_OUTPUT : 0;
+    flags |= ((pipelineDescription->contextFlags & FFX_FSR2_ENABLE_DISPLAY_RESOLUTION_MOTION_VECTOR_OUTPUT) && (pass == FFX_FSR2_PASS_ACCUMULATE || pass == FFX_FSR2_PASS_ACCUMULATE_SHARPEN)) ? FSR2_SHADER_PERMUTATION_UPSCALED_MOTION_VECTOR_OUTPUT : 0;
+    flags |= ((pipelineDescription->contextFlags & FFX_FSR2_ENABLE_ALPHA_UPSCALING) && (pass == FFX_FSR2_PASS_ACCUMULATE || pass == FFX_FSR2_PASS_ACCUMULATE_SHARPEN || pass == FFX_FSR2_PASS_RCAS)) ? FSR2_SHADER_PERMUTATION_ALPHA_UPSCALING : 0;
+    flags |= ((pipelineDescription->outputEncoding & 1) && (pass == FFX_FSR2_PASS_ACCUMULATE || pass == FFX_FSR2_PASS_RCAS)) ? FSR2_SHADER_PERMUTATION_OUTPUT_ENCODING_0 : 0;
+    flags |= ((pipelineDescription->outputEncoding & 2) && (pass == FFX_FSR2_PASS_ACCUMULATE || pass == FFX_FSR2_PASS_RCAS)) ? FSR2_SHADER_PERMUTATION_OUTPUT_ENCODING_1 : 0;
+    flags |= ((pipelineDescription->contextFlags & FFX_FSR2_ENABLE_LENS_DISTORTION) && (pass == FFX_FSR2_PASS_RCAS)) ? FSR2_SHADER_PERMUTATION_LENS_DISTORTION : 0;
+    flags |= ((pipelineDescription->contextFlags & FFX_FSR2_ENABLE_MATERIAL_ID_REACTIVITY) && (pass == FFX_FSR2_PASS_DEPTH_CLIP)) ? FSR2_SHADER_PERMUTATION_MATERIAL_ID_REACTIVITY : 0;
+    flags |= ((pipelineDescription->contextFlags & FFX_FSR2_ENABLE_GROUPSHARED_RCAS) && (pass == FFX_FSR2_PASS_RCAS)) ? FSR2_SHADER_PERMUTATION_RCAS_GROUPSHARED : 0;
     flags |= (canForceWave64) ? FSR2_SHADER_PERMUTATION_FORCE_WAVE64 : 0;
     flags |= (supportedFP16 && (pass != FFX_FSR2_PASS_RCAS)) ? FSR2_SHADER_PERMUTATION_ALLOW_FP16 : 0;
 
@@ -1177,6 +1192,24 @@ FfxErrorCode CreatePipelineDX12(
     outPipeline->srvCount = shaderBlob.srvCount;
     outPipeline->uavCount = shaderBlob.uavCount;
     outPipeline->constCount = shaderBlob.cbvCount;
+
+    // the same switches, read at runtime by the uber shaders and, for the per-pass options, by every build
+    outPipeline->permutationOptions = 0;
+    outPipeline->permutationOptions |= (flags & FSR2_SHADER_PERMUTATION_USE_LANCZOS_TYPE) ? FFX_FSR2_PERMUTATION_OPTION_REPROJECT_USE_LANCZOS_LUT : 0;
+    outPipeline->permutationOptions |= (flags & FSR2_SHADER_PERMUTATION_HDR_COLOR_INPUT) ? FFX_FSR2_PERMUTATION_OPTION_HDR_COLOR_INPUT : 0;
+    outPipeline->permutationOptions |= (flags & FSR2_SHADER_PERMUTATION_LOW_RES_MOTION_VECTORS) ? FFX_FSR2_PERMUTATION_OPTION_LOW_RESOLUTION_MOTION_VECTORS : 0;
+    outPipeline->permutationOptions |= (flags & FSR2_SHADER_PERMUTATION_JITTER_MOTION_VECTORS) ? FFX_FSR2_PERMUTATION_OPTION_JITTERED_MOTION_VECTORS : 0;
+    outPipeline->permutationOptions |= (flags & FSR2_SHADER_PERMUTATION_DEPTH_INVERTED) ? FFX_FSR2_PERMUTATION_OPTION_INVERTED_DEPTH : 0;
+    outPipeline->permutationOptions |= (flags & FSR2_SHADER_PERMUTATION_ENABLE_SHARPENING) ? FFX_FSR2_PERMUTATION_OPTION_APPLY_SHARPENING : 0;
+    outPipeline->permutationOptions |= (flags & FSR2_SHADER_PERMUTATION_REPROJECT_CATMULL_ROM) ? FFX_FSR2_PERMUTATION_OPTION_REPROJECT_CATMULL_ROM : 0;
+    outPipeline->permutationOptions |= (flags & FSR2_SHADER_PERMUTATION_PACKED_LOCK_STATUS) ? FFX_FSR2_PERMUTATION_OPTION_PACKED_LOCK_STATUS : 0;
+    outPipeline->permutationOptions |= (flags & FSR2_SHADER_PERMUTATION_UPSCALED_DEPTH_OUTPUT) ? FFX_FSR2_PERMUTATION_OPTION_UPSCALED_DEPTH_OUTPUT : 0;
+    outPipeline->permutationOptions |= (flags & FSR2_SHADER_PERMUTATION_UPSCALED_MOTION_VECTOR_OUTPUT) ? FFX_FSR2_PERMUTATION_OPTION_UPSCALED_MOTION_VECTOR_OUTPUT : 0;
+    outPipeline->permutationOptions |= (flags & FSR2_SHADER_PERMUTATION_ALPHA_UPSCALING) ? FFX_FSR2_PERMUTATION_OPTION_ALPHA_UPSCALING : 0;
+    outPipeline->permutationOptions |= (flags & FSR2_SHADER_PERMUTATION_OUTPUT_ENCODING_0) ? (1 << FFX_FSR2_PERMUTATION_OPTION_OUTPUT_ENCODING_SHIFT) : 0;
+    outPipeline->permutationOptions |= (flags & FSR2_SHADER_PERMUTATION_OUTPUT_ENCODING_1) ? (2 << FFX_FSR2_PERMUTATION_OPTION_OUTPUT_ENCODING_SHIFT) : 0;
+    outPipeline->permutationOptions |= (flags & FSR2_SHADER_PERMUTATION_LENS_DISTORTION) ? FFX_FSR2_PERMUTATION_OPTION_LENS_DISTORTION : 0;
+    outPipeline->permutationOptions |= (flags & FSR2_SHADER_PERMUTATION_RCAS_GROUPSHARED) ? FFX_FSR2_PERMUTATION_OPTION_RCAS_GROUPSHARED : 0;
     std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
     for (uint32_t srvIndex = 0; srvIndex < outPipeline->srvCount; ++srvIndex)
     {
@@ -59,6 +59,11 @@
 #if defined(POPULATE_PERMUTATION_KEY)
 #undef POPULATE_PERMUTATION_KEY
 #endif // #if defined(POPULATE_PERMUTATION_KEY)
+#if defined(FFX_FSR2_UBER_SHADERS)
+// the remaining switches are read from cbFSR2 at runtime, see FfxPipelineState::permutationOptions
+#define POPULATE_PERMUTATION_KEY(options, key)                                                                \
+key.index = 0;
+#else
 #define POPULATE_PERMUTATION_KEY(options, key)                                                                \
 key.index = 0;                                                                                                \
 key.FFX_FSR2_OPTION_REPROJECT_USE_LANCZOS_TYPE = FFX_CONTAINS_FLAG(options, FSR2_SHADER_PERMUTATION_USE_LANCZOS_TYPE);                     \
@@ -67,6 +72,7 @@ key.FFX_FSR2_OPTION_LOW_RESOLUTION_MOTION_VECTORS = FFX_CONTAINS_FLAG(options, F
 key.FFX_FSR2_OPTION_JITTERED_MOTION_VECTORS = FFX_CONTAINS_FLAG(options, FSR2_SHADER_PERMUTATION_JITTER_MOTION_VECTORS);   \
 key.FFX_FSR2_OPTION_INVERTED_DEPTH = FFX_CONTAINS_FLAG(options, FSR2_SHADER_PERMUTATION_DEPTH_INVERTED);                   \
 key.FFX_FSR2_OPTION_APPLY_SHARPENING = FFX_CONTAINS_FLAG(options, FSR2_SHADER_PERMUTATION_ENABLE_SHARPENING);
+#endif // #if defined(FFX_FSR2_UBER_SHADERS)
 
 #if defined(POPULATE_SHADER_BLOB)
 #undef POPULATE_SHADER_BLOB
@@ -78,6 +84,7 @@ static Fsr2ShaderBlobDX12 fsr2GetDepthClipPassPermutationBlobByIndex(uint32_t pe
     ffx_fsr2_depth_clip_pass_PermutationKey key;
 
     POPULATE_PERMUTATION_KEY(permutationOptions, key);
+    key.FFX_FSR2_OPTION_MATERIAL_ID_REACTIVITY = FFX_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_MATERIAL_ID_REACTIVITY);
 
     if (isWave64) {
 
@@ -109,6 +116,7 @@ static Fsr2ShaderBlobDX12 fsr2GetReconstructPreviousDepthPassPermutationBlobByIn
     ffx_fsr2_reconstruct_previous_depth_pass_PermutationKey key;
 
     POPULATE_PERMUTATION_KEY(permutationOptions, key);
+    key.FFX_FSR2_OPTION_MOTION_VECTOR_DILATION = FFX_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_MOTION_VECTOR_DILATION_0) | (FFX_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_MOTION_VECTOR_DILATION_1) << 1);
 
     if (isWave64) {
 
@@ -171,6 +179,9 @@ static Fsr2ShaderBlobDX12 fsr2GetAccumulatePassPermutationBlobByIndex(uint32_t p
     ffx_fsr2_accumulate_pass_PermutationKey key;
 
     POPULATE_PERMUTATION_KEY(permutationOptions, key);
+#if !defined(FFX_FSR2_UBER_SHADERS)
+    key.FFX_FSR2_OPTION_PACKED_LOCK_STATUS = FFX_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_PACKED_LOCK_STATUS);
+#endif // #if !defined(FFX_FSR2_UBER_SHADERS)
 
     if (isWave64) {
 
@@ -202,6 +213,9 @@ static Fsr2ShaderBlobDX12 fsr2GetRCASPassPermutationBlobByIndex(uint32_t permuta
     ffx_fsr2_rcas_pass_PermutationKey key;
 
     POPULATE_PERMUTATION_KEY(permutationOptions, key);
+#if !defined(FFX_FSR2_UBER_SHADERS)
+    key.FFX_FSR2_OPTION_PACKED_LOCK_STATUS = FFX_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_PACKED_LOCK_STATUS);
+#endif // #if !defined(FFX_FSR2_UBER_SHADERS)
 
     if (isWave64) {
 
@@ -281,9 +295,10 @@ static Fsr2ShaderBlobDX12 fsr2GetAutogenReactivePassPermutationBlobByIndex(uint3
 
 static Fsr2ShaderBlobDX12 fsr2GetTcrAutogeneratePassPermutationBlobByIndex(uint32_t permutationOptions, bool isWave64, bool is16bit) {
 
-    ffx_fsr2_autogen_reactive_pass_PermutationKey key;
+    ffx_fsr2_tcr_autogen_pass_PermutationKey key;
 
     POPULATE_PERMUTATION_KEY(permutationOptions, key);
+    key.FFX_FSR2_OPTION_COMPACT_TCR_HISTORY = FFX_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_COMPACT_TCR_HISTORY);
 
     if (isWave64) {
 
@@ -23,6 +23,7 @@
 #include <cmath>        // for fabs, abs, sinf, sqrt, etc.
 #include <string.h>     // for memset
 #include <cfloat>       // for FLT_EPSILON
+#include <cstddef>      // for offsetof
 #include "ffx_fsr2.h"
 #define FFX_CPU
 #include "shaders/ffx_core.h"
@@ -39,6 +40,9 @@
 // max queued frames for descriptor management
 static const uint32_t FSR2_MAX_QUEUED_FRAMES = 16;
 
+// number of Halton(2,3) offsets reordered by the blue noise ordered jitter sequence
+static const int32_t FSR2_BLUE_NOISE_ORDERED_JITTER_PHASE_COUNT = 256;
+
 #include "ffx_fsr2_private.h"
 
 // lists to map shader resource bindpoint name to resource identifier
@@ -58,6 +62,7 @@ static const ResourceBinding srvResourceBindingTable[] =
     {FFX_FSR2_RESOURCE_IDENTIFIER_AUTO_EXPOSURE,                            L"r_auto_exposure"},
     {FFX_FSR2_RESOURCE_IDENTIFIER_INPUT_REACTIVE_MASK,                      L"r_reactive_mask"},
     {FFX_FSR2_RESOURCE_IDENTIFIER_INPUT_TRANSPARENCY_AND_COMPOSITION_MASK,  L"r_transparency_and_composition_mask"},
+    {FFX_FSR2_RESOURCE_IDENTIFIER_INPUT_HISTORY_INVALIDATION_MASK,          L"r_history_invalidation_mask"},
     {FFX_FSR2_RESOURCE_IDENTIFIER_RECONSTRUCTED_PREVIOUS_NEAREST_DEPTH,     L"r_reconstructed_previous_nearest_depth"},
     {FFX_FSR2_RESOURCE_IDENTIFIER_DILATED_MOTION_VECTORS,                   L"r_dilated_motion_vectors"},
     {FFX_FSR2_RESOURCE_IDENTIFIER_PREVIOUS_DILATED_MOTION_VECTORS,          L"r_previous_dilated_motion_vectors"},
@@ -67,6 +72,11 @@ static const ResourceBinding srvResourceBindingTable[] =
     {FFX_FSR2_RESOURCE_IDENTIFIER_PREPARED_INPUT_COLOR,                     L"r_prepared_input_color"},
     {FFX_FSR2_RESOURCE_IDENTIFIER_LUMA_HISTORY,                             L"r_luma_history" },
     {FFX_FSR2_RESOURCE_IDENTIFIER_RCAS_INPUT,                               L"r_rcas_input"},
+    {FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_UPSCALED_ALPHA,                  L"r_internal_upscaled_alpha"},
+    {FFX_FSR2_RESOURCE_IDENTIFIER_RCAS_INPUT_ALPHA,                         L"r_rcas_input_alpha"},
+    {FFX_FSR2_RESOURCE_IDENTIFIER_INPUT_SHARPNESS_MAP,                      L"r_sharpness_map"},
+    {FFX_FSR2_RESOURCE_IDENTIFIER_INPUT_MATERIAL_ID,                        L"r_material_id"},
+    {FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_MATERIAL_REACTIVITY_TABLE,       L"r_material_reactivity_table"},
     {FFX_FSR2_RESOURCE_IDENTIFIER_LANCZOS_LUT,                              L"r_lanczos_lut"},
     {FFX_FSR2_RESOURCE_IDENTIFIER_SCENE_LUMINANCE,                          L"r_imgMips"},
     {FFX_FSR2_RESOURCE_IDENTIFIER_SCENE_LUMINANCE_MIPMAP_SHADING_CHANGE,    L"r_img_mip_shading_change"},
@@ -85,15 +95,19 @@ static const ResourceBinding uavResourceBindingTable[] =
     {FFX_FSR2_RESOURCE_IDENTIFIER_DILATED_MOTION_VECTORS,                  L"rw_dilated_motion_vectors"},
     {FFX_FSR2_RESOURCE_IDENTIFIER_DILATED_DEPTH,                           L"rw_dilatedDepth"},
     {FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_UPSCALED_COLOR,                 L"rw_internal_upscaled_color"},
+    {FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_UPSCALED_ALPHA,                 L"rw_internal_upscaled_alpha"},
     {FFX_FSR2_RESOURCE_IDENTIFIER_LOCK_STATUS,                             L"rw_lock_status"},
     {FFX_FSR2_RESOURCE_IDENTIFIER_PREPARED_INPUT_COLOR,                    L"rw_prepared_input_color"},
     {FFX_FSR2_RESOURCE_IDENTIFIER_LUMA_HISTORY,                            L"rw_luma_history"},
     {FFX_FSR2_RESOURCE_IDENTIFIER_UPSCALED_OUTPUT,                         L"rw_upscaled_output"},
+    {FFX_FSR2_RESOURCE_IDENTIFIER_UPSCALED_DEPTH_OUTPUT,                   L"rw_upscaled_depth_output"},
+    {FFX_FSR2_RESOURCE_IDENTIFIER_UPSCALED_MOTION_VECTOR_OUTPUT,           L"rw_upscaled_motion_vector_output"},
     {FFX_FSR2_RESOURCE_IDENTIFIER_SCENE_LUMINANCE_MIPMAP_SHADING_CHANGE,   L"rw_img_mip_shading_change"},
     {FFX_FSR2_RESOURCE_IDENTIFIER_SCENE_LUMINANCE_MIPMAP_5,                L"rw_img_mip_5"},
     {FFX_FSR2_RESOURCE_IDENTIFIER_DILATED_REACTIVE_MASKS,                  L"rw_dilated_reactive_masks"},
     {FFX_FSR2_RESOURCE_IDENTIFIER_AUTO_EXPOSURE,                           L"rw_auto_exposure"},
     {FFX_FSR2_RESOURCE_IDENTIFIER_SPD_ATOMIC_COUNT,                        L"rw_spd_global_atomic"},
+    {FFX_FSR2_RESOURCE_IDENTIFIER_EXPOSURE_HISTOGRAM,                      L"rw_exposure_histogram"},
     {FFX_FSR2_RESOURCE_IDENTIFIER_NEW_LOCKS,                               L"rw_new_locks"},
     {FFX_FSR2_RESOURCE_IDENTIFIER_LOCK_INPUT_LUMA,                         L"rw_lock_input_luma"},
     {FFX_FSR2_RESOURCE_IDENTIFIER_AUTOREACTIVE,                            L"rw_output_autoreactive"},
@@ -131,6 +145,11 @@ typedef struct Fsr2SpdConstants {
     uint32_t                    numworkGroups;
     uint32_t                    workGroupOffset[2];
     uint32_t                    renderSize[2];
+    uint32_t                    autoExposureMode;
+    float                       histogramLowPercentile;
+    float                       histogramHighPercentile;
+    float                       adaptationRateUp;
+    float                       adaptationRateDown;
 } Fsr2SpdConstants;
 
 typedef struct Fsr2GenerateReactiveConstants
@@ -200,6 +219,97 @@ static float halton(int32_t index, int32_t base)
     return result;
 }
 
+// Squared distance between two points on the unit torus.
+static float toroidalDistanceSquared(float ax, float ay, float bx, float by)
+{
+    const float dx = FFX_MINIMUM(fabsf(ax - bx), 1.0f - fabsf(ax - bx));
+    const float dy = FFX_MINIMUM(fabsf(ay - by), 1.0f - fabsf(ay - by));
+    return dx * dx + dy * dy;
+}
+
+// Order the first orderedCount Halton(2,3) points by farthest point sampling, which makes every prefix of the
+// order well spread. blueNoiseOrder receives the Halton index of each step.
+static void computeBlueNoiseOrder(uint8_t* blueNoiseOrder, int32_t orderedCount)
+{
+    float pointX[FSR2_BLUE_NOISE_ORDERED_JITTER_PHASE_COUNT];
+    float pointY[FSR2_BLUE_NOISE_ORDERED_JITTER_PHASE_COUNT];
+    float minDistanceSquared[FSR2_BLUE_NOISE_ORDERED_JITTER_PHASE_COUNT];
+    for (int32_t candidate = 0; candidate < orderedCount; ++candidate) {
+
+        pointX[candidate] = halton(candidate + 1, 2);
+        pointY[candidate] = halton(candidate + 1, 3);
+    }
+
+    int32_t selected = 0;
+    for (int32_t step = 0; step < orderedCount; ++step) {
+
+        if (step > 0) {
+
+            // chosen points are marked with a negative distance, ties keep the lowest Halton index.
+            selected = 0;
+            for (int32_t candidate = 1; candidate < orderedCount; ++candidate) {
+                if (minDistanceSquared[candidate] > minDistanceSquared[selected]) {
+                    selected = candidate;
+                }
+            }
+        }
+        blueNoiseOrder[step] = uint8_t(selected);
+
+        for (int32_t candidate = 0; candidate < orderedCount; ++candidate) {
+
+            const float distanceSquared = toroidalDistanceSquared(pointX[candidate], pointY[candidate], pointX[selected], pointY[selected]);
+            minDistanceSquared[candidate] = (step == 0) ? distanceSquared : FFX_MINIMUM(minDistanceSquared[candidate], distanceSquared);
+        }
+        minDistanceSquared[selected] = -1.0f;
+    }
+}
+
+// Return the blue noise order of the first orderedCount Halton(2,3) points. The farthest point order depends on the
+// points of the phase, so the orders of every phase count up to FSR2_BLUE_NOISE_ORDERED_JITTER_PHASE_COUNT are built
+// together on first use, about 33 KB, and a change of phase count under dynamic resolution costs no rebuild.
+static const uint8_t* blueNoiseOrder(int32_t orderedCount)
+{
+    // the order of orderedCount points starts at orderedCount * (orderedCount - 1) / 2.
+    struct BlueNoiseOrders {
+
+        uint8_t haltonIndex[FSR2_BLUE_NOISE_ORDERED_JITTER_PHASE_COUNT * (FSR2_BLUE_NOISE_ORDERED_JITTER_PHASE_COUNT + 1) / 2];
+        BlueNoiseOrders()
+        {
+            for (int32_t count = 1; count <= FSR2_BLUE_NOISE_ORDERED_JITTER_PHASE_COUNT; ++count) {
+                computeBlueNoiseOrder(&haltonIndex[count * (count - 1) / 2], count);
+            }
+        }
+    };
+    static const BlueNoiseOrders blueNoiseOrders;
+
+    FFX_ASSERT(orderedCount > 0 && orderedCount <= FSR2_BLUE_NOISE_ORDERED_JITTER_PHASE_COUNT);
+    return &blueNoiseOrders.haltonIndex[orderedCount * (orderedCount - 1) / 2];
+}
+
+// Return the Halton(2,3) point at position phaseIndex of the blue noise order of a phase, offsets past the ordered
+// ones keep their Halton order.
+static void haltonBlueNoiseOrder(float* outX, float* outY, int32_t phaseIndex, int32_t phaseCount)
+{
+    const int32_t orderedCount = FFX_MINIMUM(phaseCount, FSR2_BLUE_NOISE_ORDERED_JITTER_PHASE_COUNT);
+    const int32_t haltonIndex = (phaseIndex < orderedCount) ? int32_t(blueNoiseOrder(orderedCount)[phaseIndex]) : phaseIndex;
+
+    *outX = halton(haltonIndex + 1, 2);
+    *outY = halton(haltonIndex + 1, 3);
+}
+
+// R2 additive recurrence, the two dimensional generalisation of the golden ratio sequence.
+static void r2(float* outX, float* outY, int32_t index)
+{
+    const double plasticNumber = 1.32471795724474602596;
+    const double alphaX = 1.0 / plasticNumber;
+    const double alphaY = 1.0 / (plasticNumber * plasticNumber);
+
+    const double x = 0.5 + alphaX * index;
+    const double y = 0.5 + alphaY * index;
+    *outX = float(x - floor(x));
+    *outY = float(y - floor(y));
+}
+
 static void fsr2DebugCheckDispatch(FfxFsr2Context_Private* context, const FfxFsr2DispatchDescription* params)
 {
     if ((params->commandList == nullptr) && !(context->contextDescription.flags & FFX_FSR2_ALLOW_NULL_DEVICE_AND_COMMAND_LIST))
@@ -267,6 +377,16 @@ static void fsr2DebugCheckDispatch(FfxFsr2Context_Private* context, const FfxFsr
         context->contextDescription.fpMessage(FFX_FSR2_MESSAGE_TYPE_WARNING, L"sharpness contains value outside of expected range [0.0, 1.0]");
     }
 
+    if (params->sharpeningDepthEdgeThreshold < 0.0f || params->sharpeningDepthEdgeThreshold > 1.0f)
+    {
+        context->contextDescription.fpMessage(FFX_FSR2_MESSAGE_TYPE_WARNING, L"sharpeningDepthEdgeThreshold contains value outside of expected range [0.0, 1.0]");
+    }
+
+    if (params->historyInvalidationRectCount > FFX_FSR2_MAX_HISTORY_INVALIDATION_RECTS)
+    {
+        context->contextDescription.fpMessage(FFX_FSR2_MESSAGE_TYPE_WARNING, L"historyInvalidationRectCount is greater than FFX_FSR2_MAX_HISTORY_INVALIDATION_RECTS, extra rects are ignored");
+    }
+
     if (params->frameTimeDelta < 1.0f)
     {
         context->contextDescription.fpMessage(FFX_FSR2_MESSAGE_TYPE_WARNING, L"frameTimeDelta is less than 1.0f - this value should be milliseconds (~16.6f for 60fps)");
@@ -397,6 +517,8 @@ static FfxErrorCode createPipelineStates(FfxFsr2Context_Private* context)
 
     FfxPipelineDescription pipelineDescription;
     pipelineDescription.contextFlags = context->contextDescription.flags;
+    pipelineDescription.motionVectorDilationMode = context->contextDescription.motionVectorDilationMode;
+    pipelineDescription.outputEncoding = context->contextDescription.outputEncoding.encoding;
     pipelineDescription.samplerCount = samplerCount;
     pipelineDescription.samplers = samplers;
     pipelineDescription.rootConstantBufferCount = rootConstantCount;
@@ -465,6 +587,11 @@ static FfxErrorCode fsr2Create(FfxFsr2Context_Private* context, const FfxFsr2Con
     context->firstExecution = true;
     context->resourceFrameIndex = 0;
 
+    // build the blue noise jitter orders now rather than in the first frame.
+    if (context->contextDescription.jitterSequence.sequence == FFX_FSR2_JITTER_SEQUENCE_HALTON_BLUE_NOISE_ORDER) {
+        blueNoiseOrder(1);
+    }
+
     context->constants.displaySize[0] = contextDescription->displaySize.width;
     context->constants.displaySize[1] = contextDescription->displaySize.height;
 
@@ -487,9 +614,38 @@ static FfxErrorCode fsr2Create(FfxFsr2Context_Private* context, const FfxFsr2Con
     }
 
     uint8_t defaultReactiveMaskData = 0U;
+    uint8_t defaultSharpnessData = 255U;
     uint32_t atomicInitData = 0U;
+    uint32_t exposureHistogramInitData[FFX_FSR2_EXPOSURE_HISTOGRAM_BIN_COUNT] = {};
     float defaultExposure[] = { 0.0f, 0.0f };
     const FfxResourceType texture1dResourceType = (context->contextDescription.flags & FFX_FSR2_ENABLE_TEXTURE1D_USAGE) ? FFX_RESOURCE_TYPE_TEXTURE1D : FFX_RESOURCE_TYPE_TEXTURE2D;
+    const FfxSurfaceFormat tcrHistoryFormat = (context->contextDescription.flags & FFX_FSR2_ENABLE_COMPACT_TCR_HISTORY) ? FFX_SURFACE_FORMAT_R16_FLOAT : FFX_SURFACE_FORMAT_R11G11B10_FLOAT;
+
+    // with a packed lock status the history carries the locks, the lock status surfaces only remain as 1x1 placeholders for the bindings.
+    const bool packedLockStatus = (context->contextDescription.flags & FFX_FSR2_ENABLE_PACKED_LOCK_STATUS) != 0;
+    const FfxSurfaceFormat upscaledColorFormat = packedLockStatus ? FFX_SURFACE_FORMAT_R16G16B16A16_UNORM : FFX_SURFACE_FORMAT_R16G16B16A16_FLOAT;
+    const uint32_t lockStatusWidth = packedLockStatus ? 1 : contextDescription->displaySize.width;
+    const uint32_t lockStatusHeight = packedLockStatus ? 1 : contextDescription->displaySize.height;
+
+    // the alpha history is only read when alpha upscaling is enabled, otherwise it remains as 1x1 placeholders for the bindings.
+    const bool alphaUpscaling = (context->contextDescription.flags & FFX_FSR2_ENABLE_ALPHA_UPSCALING) != 0;
+    const uint32_t upscaledAlphaWidth = alphaUpscaling ? contextDescription->displaySize.width : 1;
+    const uint32_t upscaledAlphaHeight = alphaUpscaling ? contextDescription->displaySize.height : 1;
+
+    // the material reactivity table is only read by the material ID permutations, otherwise it remains as a 1x1 placeholder for the bindings.
+    // upload path only supports 8 bit unorm pairs for it, IDs past the application's table map to 0.
+    const bool materialIdReactivity = (context->contextDescription.flags & FFX_FSR2_ENABLE_MATERIAL_ID_REACTIVITY) != 0;
+    const uint32_t materialReactivityTableWidth = materialIdReactivity ? FFX_FSR2_MAX_MATERIAL_IDS : 1;
+    uint8_t materialReactivityTable[FFX_FSR2_MAX_MATERIAL_IDS * 2] = {};
+    if (materialIdReactivity) {
+
+        for (uint32_t materialIndex = 0; materialIndex < contextDescription->materialReactivity.count; ++materialIndex) {
+
+            const FfxFsr2MaterialReactivity* material = &contextDescription->materialReactivity.table[materialIndex];
+            materialReactivityTable[materialIndex * 2 + 0] = uint8_t(roundf(ffxSaturate(material->reactive) * 255.0f));
+            materialReactivityTable[materialIndex * 2 + 1] = uint8_t(roundf(ffxSaturate(material->transparencyAndComposition) * 255.0f));
+        }
+    }
 
     // declare internal resources needed
     const Fsr2ResourceDescription internalSurfaceDesc[] = {
@@ -510,10 +666,10 @@ static FfxErrorCode fsr2Create(FfxFsr2Context_Private* context, const FfxFsr2Con
             FFX_SURFACE_FORMAT_R32_FLOAT, contextDescription->maxRenderSize.width, contextDescription->maxRenderSize.height, 1, FFX_RESOURCE_FLAGS_ALIASABLE },
             
         {   FFX_FSR2_RESOURCE_IDENTIFIER_LOCK_STATUS_1, L"FSR2_LockStatus1", (FfxResourceUsage)(FFX_RESOURCE_USAGE_RENDERTARGET | FFX_RESOURCE_USAGE_UAV),
-            FFX_SURFACE_FORMAT_R16G16_FLOAT, contextDescription->displaySize.width, contextDescription->displaySize.height, 1, FFX_RESOURCE_FLAGS_NONE },
+            FFX_SURFACE_FORMAT_R16G16_FLOAT, lockStatusWidth, lockStatusHeight, 1, FFX_RESOURCE_FLAGS_NONE },
 
         {   FFX_FSR2_RESOURCE_IDENTIFIER_LOCK_STATUS_2, L"FSR2_LockStatus2", (FfxResourceUsage)(FFX_RESOURCE_USAGE_RENDERTARGET | FFX_RESOURCE_USAGE_UAV),
-            FFX_SURFACE_FORMAT_R16G16_FLOAT, contextDescription->displaySize.width, contextDescription->displaySize.height, 1, FFX_RESOURCE_FLAGS_NONE },
+            FFX_SURFACE_FORMAT_R16G16_FLOAT, lockStatusWidth, lockStatusHeight, 1, FFX_RESOURCE_FLAGS_NONE },
 
         {   FFX_FSR2_RESOURCE_IDENTIFIER_LOCK_INPUT_LUMA, L"FSR2_LockInputLuma", (FfxResourceUsage)(FFX_RESOURCE_USAGE_UAV),
             FFX_SURFACE_FORMAT_R16_FLOAT, contextDescription->maxRenderSize.width, contextDescription->maxRenderSize.height, 1, FFX_RESOURCE_FLAGS_ALIASABLE },
@@ -522,10 +678,16 @@ static FfxErrorCode fsr2Create(FfxFsr2Context_Private* context, const FfxFsr2Con
             FFX_SURFACE_FORMAT_R8_UNORM, contextDescription->displaySize.width, contextDescription->displaySize.height, 1, FFX_RESOURCE_FLAGS_ALIASABLE },
 
         {   FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_UPSCALED_COLOR_1, L"FSR2_InternalUpscaled1", (FfxResourceUsage)(FFX_RESOURCE_USAGE_RENDERTARGET | FFX_RESOURCE_USAGE_UAV),
-            FFX_SURFACE_FORMAT_R16G16B16A16_FLOAT, contextDescription->displaySize.width, contextDescription->displaySize.height, 1, FFX_RESOURCE_FLAGS_NONE },
+            upscaledColorFormat, contextDescription->displaySize.width, contextDescription->displaySize.height, 1, FFX_RESOURCE_FLAGS_NONE },
 
         {   FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_UPSCALED_COLOR_2, L"FSR2_InternalUpscaled2", (FfxResourceUsage)(FFX_RESOURCE_USAGE_RENDERTARGET | FFX_RESOURCE_USAGE_UAV),
-            FFX_SURFACE_FORMAT_R16G16B16A16_FLOAT, contextDescription->displaySize.width, contextDescription->displaySize.height, 1, FFX_RESOURCE_FLAGS_NONE },
+            upscaledColorFormat, contextDescription->displaySize.width, contextDescription->displaySize.height, 1, FFX_RESOURCE_FLAGS_NONE },
+
+        {   FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_UPSCALED_ALPHA_1, L"FSR2_InternalUpscaledAlpha1", (FfxResourceUsage)(FFX_RESOURCE_USAGE_RENDERTARGET | FFX_RESOURCE_USAGE_UAV),
+            FFX_SURFACE_FORMAT_R16_FLOAT, upscaledAlphaWidth, upscaledAlphaHeight, 1, FFX_RESOURCE_FLAGS_NONE },
+
+        {   FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_UPSCALED_ALPHA_2, L"FSR2_InternalUpscaledAlpha2", (FfxResourceUsage)(FFX_RESOURCE_USAGE_RENDERTARGET | FFX_RESOURCE_USAGE_UAV),
+            FFX_SURFACE_FORMAT_R16_FLOAT, upscaledAlphaWidth, upscaledAlphaHeight, 1, FFX_RESOURCE_FLAGS_NONE },
 
         {   FFX_FSR2_RESOURCE_IDENTIFIER_SCENE_LUMINANCE, L"FSR2_ExposureMips", FFX_RESOURCE_USAGE_UAV,
             FFX_SURFACE_FORMAT_R16_FLOAT, contextDescription->maxRenderSize.width / 2, contextDescription->maxRenderSize.height / 2, 0, FFX_RESOURCE_FLAGS_ALIASABLE },
@@ -539,6 +701,9 @@ static FfxErrorCode fsr2Create(FfxFsr2Context_Private* context, const FfxFsr2Con
         {   FFX_FSR2_RESOURCE_IDENTIFIER_SPD_ATOMIC_COUNT, L"FSR2_SpdAtomicCounter", (FfxResourceUsage)(FFX_RESOURCE_USAGE_UAV),
             FFX_SURFACE_FORMAT_R32_UINT, 1, 1, 1, FFX_RESOURCE_FLAGS_ALIASABLE, sizeof(atomicInitData), &atomicInitData },
 
+        {   FFX_FSR2_RESOURCE_IDENTIFIER_EXPOSURE_HISTOGRAM, L"FSR2_ExposureHistogram", (FfxResourceUsage)(FFX_RESOURCE_USAGE_UAV),
+            FFX_SURFACE_FORMAT_R32_UINT, FFX_FSR2_EXPOSURE_HISTOGRAM_BIN_COUNT, 1, 1, FFX_RESOURCE_FLAGS_NONE, sizeof(exposureHistogramInitData), exposureHistogramInitData },
+
         {   FFX_FSR2_RESOURCE_IDENTIFIER_DILATED_REACTIVE_MASKS, L"FSR2_DilatedReactiveMasks", FFX_RESOURCE_USAGE_UAV,
             FFX_SURFACE_FORMAT_R8G8_UNORM, contextDescription->maxRenderSize.width, contextDescription->maxRenderSize.height, 1, FFX_RESOURCE_FLAGS_ALIASABLE },
 
@@ -548,6 +713,19 @@ static FfxErrorCode fsr2Create(FfxFsr2Context_Private* context, const FfxFsr2Con
         {   FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_DEFAULT_REACTIVITY, L"FSR2_DefaultReactiviyMask", FFX_RESOURCE_USAGE_READ_ONLY,
             FFX_SURFACE_FORMAT_R8_UNORM, 1, 1, 1, FFX_RESOURCE_FLAGS_NONE, sizeof(defaultReactiveMaskData), &defaultReactiveMaskData },
 
+        {   FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_DEFAULT_SHARPNESS, L"FSR2_DefaultSharpnessMap", FFX_RESOURCE_USAGE_READ_ONLY,
+            FFX_SURFACE_FORMAT_R8_UNORM, 1, 1, 1, FFX_RESOURCE_FLAGS_NONE, sizeof(defaultSharpnessData), &defaultSharpnessData },
+
+        {   FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_MATERIAL_REACTIVITY_TABLE, L"FSR2_MaterialReactivityTable", FFX_RESOURCE_USAGE_READ_ONLY,
+            FFX_SURFACE_FORMAT_R8G8_UNORM, materialReactivityTableWidth, 1, 1, FFX_RESOURCE_FLAGS_NONE, uint32_t(materialReactivityTableWidth * 2 * sizeof(uint8_t)), materialReactivityTable },
+
+        // the accumulate pass binds the display resolution outputs whether or not the application provides them
+        {   FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_DEFAULT_UPSCALED_DEPTH_OUTPUT, L"FSR2_DefaultUpscaledDepthOutput", FFX_RESOURCE_USAGE_UAV,
+            FFX_SURFACE_FORMAT_R32_FLOAT, 1, 1, 1, FFX_RESOURCE_FLAGS_NONE },
+
+        {   FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_DEFAULT_UPSCALED_MOTION_VECTOR_OUTPUT, L"FSR2_DefaultUpscaledMotionVectorOutput", FFX_RESOURCE_USAGE_UAV,
+            FFX_SURFACE_FORMAT_R16G16_FLOAT, 1, 1, 1, FFX_RESOURCE_FLAGS_NONE },
+
         {   FFX_FSR2_RESOURCE_IDENTITIER_UPSAMPLE_MAXIMUM_BIAS_LUT, L"FSR2_MaximumUpsampleBias", FFX_RESOURCE_USAGE_READ_ONLY,
             FFX_SURFACE_FORMAT_R16_SNORM, FFX_FSR2_MAXIMUM_BIAS_TEXTURE_WIDTH, FFX_FSR2_MAXIMUM_BIAS_TEXTURE_HEIGHT, 1, FFX_RESOURCE_FLAGS_NONE, sizeof(maximumBias), maximumBias },
 
@@ -564,13 +742,13 @@ static FfxErrorCode fsr2Create(FfxFsr2Context_Private* context, const FfxFsr2Con
         {   FFX_FSR2_RESOURCE_IDENTIFIER_AUTOCOMPOSITION, L"FSR2_AutoComposition", FFX_RESOURCE_USAGE_UAV,
             FFX_SURFACE_FORMAT_R8_UNORM, contextDescription->maxRenderSize.width, contextDescription->maxRenderSize.height, 1, FFX_RESOURCE_FLAGS_NONE },
         {   FFX_FSR2_RESOURCE_IDENTIFIER_PREV_PRE_ALPHA_COLOR_1, L"FSR2_PrevPreAlpha0", FFX_RESOURCE_USAGE_UAV,
-            FFX_SURFACE_FORMAT_R11G11B10_FLOAT, contextDescription->maxRenderSize.width, contextDescription->maxRenderSize.height, 1, FFX_RESOURCE_FLAGS_NONE },
+            tcrHistoryFormat, contextDescription->maxRenderSize.width, contextDescription->maxRenderSize.height, 1, FFX_RESOURCE_FLAGS_NONE },
         {   FFX_FSR2_RESOURCE_IDENTIFIER_PREV_POST_ALPHA_COLOR_1, L"FSR2_PrevPostAlpha0", FFX_RESOURCE_USAGE_UAV,
-            FFX_SURFACE_FORMAT_R11G11B10_FLOAT, contextDescription->maxRenderSize.width, contextDescription->maxRenderSize.height, 1, FFX_RESOURCE_FLAGS_NONE },
+            tcrHistoryFormat, contextDescription->maxRenderSize.width, contextDescription->maxRenderSize.height, 1, FFX_RESOURCE_FLAGS_NONE },
         {   FFX_FSR2_RESOURCE_IDENTIFIER_PREV_PRE_ALPHA_COLOR_2, L"FSR2_PrevPreAlpha1", FFX_RESOURCE_USAGE_UAV,
-            FFX_SURFACE_FORMAT_R11G11B10_FLOAT, contextDescription->maxRenderSize.width, contextDescription->maxRenderSize.height, 1, FFX_RESOURCE_FLAGS_NONE },
+            tcrHistoryFormat, contextDescription->maxRenderSize.width, contextDescription->maxRenderSize.height, 1, FFX_RESOURCE_FLAGS_NONE },
         {   FFX_FSR2_RESOURCE_IDENTIFIER_PREV_POST_ALPHA_COLOR_2, L"FSR2_PrevPostAlpha1", FFX_RESOURCE_USAGE_UAV,
-            FFX_SURFACE_FORMAT_R11G11B10_FLOAT, contextDescription->maxRenderSize.width, contextDescription->maxRenderSize.height, 1, FFX_RESOURCE_FLAGS_NONE },
+            tcrHistoryFormat, contextDescription->maxRenderSize.width, contextDescription->maxRenderSize.height, 1, FFX_RESOURCE_FLAGS_NONE },
 
     };
 
@@ -644,9 +822,14 @@ static FfxErrorCode fsr2Release(FfxFsr2Context_Private* context)
     context->srvResources[FFX_FSR2_RESOURCE_IDENTIFIER_INPUT_EXPOSURE] = { FFX_FSR2_RESOURCE_IDENTIFIER_NULL };
     context->srvResources[FFX_FSR2_RESOURCE_IDENTIFIER_INPUT_REACTIVE_MASK] = { FFX_FSR2_RESOURCE_IDENTIFIER_NULL };
     context->srvResources[FFX_FSR2_RESOURCE_IDENTIFIER_INPUT_TRANSPARENCY_AND_COMPOSITION_MASK] = { FFX_FSR2_RESOURCE_IDENTIFIER_NULL };
+    context->srvResources[FFX_FSR2_RESOURCE_IDENTIFIER_INPUT_HISTORY_INVALIDATION_MASK] = { FFX_FSR2_RESOURCE_IDENTIFIER_NULL };
     context->srvResources[FFX_FSR2_RESOURCE_IDENTIFIER_LOCK_STATUS] = { FFX_FSR2_RESOURCE_IDENTIFIER_NULL };
     context->srvResources[FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_UPSCALED_COLOR] = { FFX_FSR2_RESOURCE_IDENTIFIER_NULL };
     context->srvResources[FFX_FSR2_RESOURCE_IDENTIFIER_RCAS_INPUT] = { FFX_FSR2_RESOURCE_IDENTIFIER_NULL };
+    context->srvResources[FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_UPSCALED_ALPHA] = { FFX_FSR2_RESOURCE_IDENTIFIER_NULL };
+    context->srvResources[FFX_FSR2_RESOURCE_IDENTIFIER_RCAS_INPUT_ALPHA] = { FFX_FSR2_RESOURCE_IDENTIFIER_NULL };
+    context->srvResources[FFX_FSR2_RESOURCE_IDENTIFIER_INPUT_SHARPNESS_MAP] = { FFX_FSR2_RESOURCE_IDENTIFIER_NULL };
+    context->srvResources[FFX_FSR2_RESOURCE_IDENTIFIER_INPUT_MATERIAL_ID] = { FFX_FSR2_RESOURCE_IDENTIFIER_NULL };
     context->srvResources[FFX_FSR2_RESOURCE_IDENTIFIER_UPSCALED_OUTPUT] = { FFX_FSR2_RESOURCE_IDENTIFIER_NULL };
 
     // release internal resources
@@ -752,6 +935,11 @@ static void scheduleDispatch(FfxFsr2Context_Private* context, const FfxFsr2Dispa
         wcscpy_s( jobDescriptor.cbNames[currentRootConstantIndex], pipeline->cbResourceBindings[currentRootConstantIndex].name);
         jobDescriptor.cbs[currentRootConstantIndex] = globalFsr2ConstantBuffers[pipeline->cbResourceBindings[currentRootConstantIndex].resourceIdentifier];
         jobDescriptor.cbSlotIndex[currentRootConstantIndex] = pipeline->cbResourceBindings[currentRootConstantIndex].slotIndex;
+
+        // the per-pass options, and every switch in the uber shaders, are read from cbFSR2, so each job carries the switches of its own pipeline
+        if (pipeline->cbResourceBindings[currentRootConstantIndex].resourceIdentifier == FFX_FSR2_CONSTANTBUFFER_IDENTIFIER_FSR2) {
+            jobDescriptor.cbs[currentRootConstantIndex].data[offsetof(Fsr2Constants, permutationOptions) / sizeof(uint32_t)] = pipeline->permutationOptions;
+        }
     }
 
     FfxGpuJobDescription dispatchJob = { FFX_GPU_JOB_COMPUTE };
@@ -801,6 +989,8 @@ static FfxErrorCode fsr2Dispatch(FfxFsr2Context_Private* context, const FfxFsr2D
     const uint32_t lockStatusUavResourceIndex = isOddFrame ? FFX_FSR2_RESOURCE_IDENTIFIER_LOCK_STATUS_1 : FFX_FSR2_RESOURCE_IDENTIFIER_LOCK_STATUS_2;
     const uint32_t upscaledColorSrvResourceIndex = isOddFrame ? FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_UPSCALED_COLOR_2 : FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_UPSCALED_COLOR_1;
     const uint32_t upscaledColorUavResourceIndex = isOddFrame ? FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_UPSCALED_COLOR_1 : FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_UPSCALED_COLOR_2;
+    const uint32_t upscaledAlphaSrvResourceIndex = isOddFrame ? FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_UPSCALED_ALPHA_2 : FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_UPSCALED_ALPHA_1;
+    const uint32_t upscaledAlphaUavResourceIndex = isOddFrame ? FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_UPSCALED_ALPHA_1 : FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_UPSCALED_ALPHA_2;
     const uint32_t dilatedMotionVectorsResourceIndex = isOddFrame ? FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_DILATED_MOTION_VECTORS_2 : FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_DILATED_MOTION_VECTORS_1;
     const uint32_t previousDilatedMotionVectorsResourceIndex = isOddFrame ? FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_DILATED_MOTION_VECTORS_1 : FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_DILATED_MOTION_VECTORS_2;
     const uint32_t lumaHistorySrvResourceIndex = isOddFrame ? FFX_FSR2_RESOURCE_IDENTIFIER_LUMA_HISTORY_2 : FFX_FSR2_RESOURCE_IDENTIFIER_LUMA_HISTORY_1;
@@ -847,12 +1037,43 @@ static FfxErrorCode fsr2Dispatch(FfxFsr2Context_Private* context, const FfxFsr2D
         context->contextDescription.callbacks.fpRegisterResource(&context->contextDescription.callbacks, &params->transparencyAndComposition, &context->srvResources[FFX_FSR2_RESOURCE_IDENTIFIER_INPUT_TRANSPARENCY_AND_COMPOSITION_MASK]);
     }
 
+    if (ffxFsr2ResourceIsNull(params->historyInvalidationMask)) {
+        context->srvResources[FFX_FSR2_RESOURCE_IDENTIFIER_INPUT_HISTORY_INVALIDATION_MASK] = context->srvResources[FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_DEFAULT_REACTIVITY];
+    } else {
+        context->contextDescription.callbacks.fpRegisterResource(&context->contextDescription.callbacks, &params->historyInvalidationMask, &context->srvResources[FFX_FSR2_RESOURCE_IDENTIFIER_INPUT_HISTORY_INVALIDATION_MASK]);
+    }
+
+    if (ffxFsr2ResourceIsNull(params->sharpnessMap)) {
+        context->srvResources[FFX_FSR2_RESOURCE_IDENTIFIER_INPUT_SHARPNESS_MAP] = context->srvResources[FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_DEFAULT_SHARPNESS];
+    } else {
+        context->contextDescription.callbacks.fpRegisterResource(&context->contextDescription.callbacks, &params->sharpnessMap, &context->srvResources[FFX_FSR2_RESOURCE_IDENTIFIER_INPUT_SHARPNESS_MAP]);
+    }
+
+    if (context->contextDescription.flags & FFX_FSR2_ENABLE_MATERIAL_ID_REACTIVITY) {
+        context->contextDescription.callbacks.fpRegisterResource(&context->contextDescription.callbacks, &params->materialId, &context->srvResources[FFX_FSR2_RESOURCE_IDENTIFIER_INPUT_MATERIAL_ID]);
+    } else {
+        context->srvResources[FFX_FSR2_RESOURCE_IDENTIFIER_INPUT_MATERIAL_ID] = context->srvResources[FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_DEFAULT_REACTIVITY];
+    }
+
     context->contextDescription.callbacks.fpRegisterResource(&context->contextDescription.callbacks, &params->output, &context->uavResources[FFX_FSR2_RESOURCE_IDENTIFIER_UPSCALED_OUTPUT]);
+    if (context->contextDescription.flags & FFX_FSR2_ENABLE_DISPLAY_RESOLUTION_DEPTH_OUTPUT) {
+        context->contextDescription.callbacks.fpRegisterResource(&context->contextDescription.callbacks, &params->outputDepth, &context->uavResources[FFX_FSR2_RESOURCE_IDENTIFIER_UPSCALED_DEPTH_OUTPUT]);
+    } else {
+        context->uavResources[FFX_FSR2_RESOURCE_IDENTIFIER_UPSCALED_DEPTH_OUTPUT] = context->uavResources[FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_DEFAULT_UPSCALED_DEPTH_OUTPUT];
+    }
+    if (context->contextDescription.flags & FFX_FSR2_ENABLE_DISPLAY_RESOLUTION_MOTION_VECTOR_OUTPUT) {
+        context->contextDescription.callbacks.fpRegisterResource(&context->contextDescription.callbacks, &params->outputMotionVectors, &context->uavResources[FFX_FSR2_RESOURCE_IDENTIFIER_UPSCALED_MOTION_VECTOR_OUTPUT]);
+    } else {
+        context->uavResources[FFX_FSR2_RESOURCE_IDENTIFIER_UPSCALED_MOTION_VECTOR_OUTPUT] = context->uavResources[FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_DEFAULT_UPSCALED_MOTION_VECTOR_OUTPUT];
+    }
     context->srvResources[FFX_FSR2_RESOURCE_IDENTIFIER_LOCK_STATUS] = context->srvResources[lockStatusSrvResourceIndex];
     context->srvResources[FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_UPSCALED_COLOR] = context->srvResources[upscaledColorSrvResourceIndex];
     context->uavResources[FFX_FSR2_RESOURCE_IDENTIFIER_LOCK_STATUS] = context->uavResources[lockStatusUavResourceIndex];
     context->uavResources[FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_UPSCALED_COLOR] = context->uavResources[upscaledColorUavResourceIndex];
     context->srvResources[FFX_FSR2_RESOURCE_IDENTIFIER_RCAS_INPUT] = context->uavResources[upscaledColorUavResourceIndex];
+    context->srvResources[FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_UPSCALED_ALPHA] = context->srvResources[upscaledAlphaSrvResourceIndex];
+    context->uavResources[FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_UPSCALED_ALPHA] = context->uavResources[upscaledAlphaUavResourceIndex];
+    context->srvResources[FFX_FSR2_RESOURCE_IDENTIFIER_RCAS_INPUT_ALPHA] = context->uavResources[upscaledAlphaUavResourceIndex];
 
     context->srvResources[FFX_FSR2_RESOURCE_IDENTIFIER_DILATED_MOTION_VECTORS] = context->srvResources[dilatedMotionVectorsResourceIndex];
     context->uavResources[FFX_FSR2_RESOURCE_IDENTIFIER_DILATED_MOTION_VECTORS] = context->uavResources[dilatedMotionVectorsResourceIndex];
@@ -913,8 +1134,8 @@ static FfxErrorCode fsr2Dispatch(FfxFsr2Context_Private* context, const FfxFsr2D
         context->previousJitterOffset[1] = context->constants.jitterOffset[1];
     }
 
-    // lock data, assuming jitter sequence length computation for now
-    const int32_t jitterPhaseCount = ffxFsr2GetJitterPhaseCount(params->renderSize.width, context->contextDescription.displaySize.width);
+    // lock data, assuming the application jitters with the sequence given at context creation
+    const int32_t jitterPhaseCount = ffxFsr2GetJitterPhaseCountEx(params->renderSize.width, context->contextDescription.displaySize.width, &context->contextDescription.jitterSequence);
 
     // init on first frame
     if (resetAccumulation || context->constants.jitterPhaseCount == 0) {
@@ -928,6 +1149,24 @@ static FfxErrorCode fsr2Dispatch(FfxFsr2Context_Private* context, const FfxFsr2D
         }
     }
 
+    context->constants.debugView = uint32_t(params->debugView);
+
+    // scale linear 1.0 to paper white in the units of the output encoding: 10000 nits for PQ, 80 nits for scRGB.
+    const FfxFsr2OutputEncodingDescription* outputEncoding = &context->contextDescription.outputEncoding;
+    const float paperWhiteNits = (outputEncoding->paperWhiteNits > 0.0f) ? outputEncoding->paperWhiteNits : FFX_FSR2_DEFAULT_PAPER_WHITE_NITS;
+    if (outputEncoding->encoding == FFX_FSR2_OUTPUT_ENCODING_PQ_BT2020) {
+        context->constants.outputScale = paperWhiteNits / 10000.0f;
+    } else if (outputEncoding->encoding == FFX_FSR2_OUTPUT_ENCODING_SCRGB) {
+        context->constants.outputScale = paperWhiteNits / 80.0f;
+    } else {
+        context->constants.outputScale = 1.0f;
+    }
+
+    context->constants.lensDistortionCenter[0] = params->lensDistortion.center.x;
+    context->constants.lensDistortionCenter[1] = params->lensDistortion.center.y;
+    context->constants.lensDistortionCoefficients[0] = params->lensDistortion.k1;
+    context->constants.lensDistortionCoefficients[1] = params->lensDistortion.k2;
+
     // convert delta time to seconds and clamp to [0, 1].
     context->constants.deltaTime = FFX_MAXIMUM(0.0f, FFX_MINIMUM(1.0f, params->frameTimeDelta / 1000.0f));
 
@@ -937,6 +1176,27 @@ static FfxErrorCode fsr2Dispatch(FfxFsr2Context_Private* context, const FfxFsr2D
         context->constants.frameIndex++;
     }
 
+    // history invalidation rects, clipped to the display and packed as 16bit min/max corners.
+    context->constants.historyInvalidationRectCount = 0;
+    memset(context->constants.historyInvalidationRects, 0, sizeof(context->constants.historyInvalidationRects));
+    const uint32_t historyInvalidationRectCount = FFX_MINIMUM(params->historyInvalidationRectCount, uint32_t(FFX_FSR2_MAX_HISTORY_INVALIDATION_RECTS));
+    for (uint32_t rectIndex = 0; rectIndex < historyInvalidationRectCount; ++rectIndex) {
+
+        const FfxRect2D& rect = params->historyInvalidationRects[rectIndex];
+        const int32_t minX = FFX_MAXIMUM(rect.left, 0);
+        const int32_t minY = FFX_MAXIMUM(rect.top, 0);
+        const int32_t maxX = FFX_MINIMUM(rect.left + rect.width, context->constants.displaySize[0]);
+        const int32_t maxY = FFX_MINIMUM(rect.top + rect.height, context->constants.displaySize[1]);
+        if (minX >= maxX || minY >= maxY) {
+            continue;
+        }
+
+        uint32_t* packedRect = &context->constants.historyInvalidationRects[context->constants.historyInvalidationRectCount * 2];
+        packedRect[0] = uint32_t(minX) | (uint32_t(minY) << 16);
+        packedRect[1] = uint32_t(maxX) | (uint32_t(maxY) << 16);
+        context->constants.historyInvalidationRectCount++;
+    }
+
     // shading change usage of the SPD mip levels.
     context->constants.lumaMipLevelToUse = uint32_t(FFX_FSR2_SHADING_CHANGE_MIP_LEVEL);
 
@@ -1000,10 +1260,32 @@ static FfxErrorCode fsr2Dispatch(FfxFsr2Context_Private* context, const FfxFsr2D
     luminancePyramidConstants.renderSize[0] = params->renderSize.width;
     luminancePyramidConstants.renderSize[1] = params->renderSize.height;
 
+    const FfxFsr2AutoExposureDescription* autoExposure = &context->contextDescription.autoExposure;
+    const bool useDefaultPercentiles = (autoExposure->histogramLowPercentile == 0.0f) && (autoExposure->histogramHighPercentile == 0.0f);
+    luminancePyramidConstants.autoExposureMode = uint32_t(autoExposure->mode);
+    luminancePyramidConstants.histogramLowPercentile = useDefaultPercentiles ? FFX_FSR2_DEFAULT_HISTOGRAM_LOW_PERCENTILE : autoExposure->histogramLowPercentile;
+    luminancePyramidConstants.histogramHighPercentile = useDefaultPercentiles ? FFX_FSR2_DEFAULT_HISTOGRAM_HIGH_PERCENTILE : autoExposure->histogramHighPercentile;
+    luminancePyramidConstants.adaptationRateUp = (autoExposure->adaptationRateUp > 0.0f) ? autoExposure->adaptationRateUp : FFX_FSR2_DEFAULT_EXPOSURE_ADAPTATION_RATE;
+    luminancePyramidConstants.adaptationRateDown = (autoExposure->adaptationRateDown > 0.0f) ? autoExposure->adaptationRateDown : FFX_FSR2_DEFAULT_EXPOSURE_ADAPTATION_RATE;
+
+    // debug views are written by the accumulate pass and must not be sharpened.
+    const bool sharpenEnabled = params->enableSharpening && (params->debugView == FFX_FSR2_DEBUG_VIEW_NONE);
+
+    // the lens distortion is resampled by RCAS, so it runs without sharpening too.
+    const bool lensDistortionEnabled = (context->contextDescription.flags & FFX_FSR2_ENABLE_LENS_DISTORTION) && (params->debugView == FFX_FSR2_DEBUG_VIEW_NONE);
+    const bool rcasEnabled = sharpenEnabled || lensDistortionEnabled;
+
     // compute the constants.
     Fsr2RcasConstants rcasConsts = {};
     const float sharpenessRemapped = (-2.0f * params->sharpness) + 2.0f;
     FsrRcasCon(rcasConsts.rcasConfig, sharpenessRemapped);
+    if (!sharpenEnabled) {
+
+        // a zero scale removes the sharpening lobe, leaving only the resample.
+        rcasConsts.rcasConfig[0] = 0;
+    }
+    rcasConsts.rcasConfig[2] = params->disableSharpeningDenoise ? 0 : FFX_FSR2_RCAS_CONFIG_DENOISE;
+    rcasConsts.rcasConfig[3] = ffxAsUInt32(ffxSaturate(params->sharpeningDepthEdgeThreshold));
 
     Fsr2GenerateReactiveConstants2 genReactiveConsts = {};
     genReactiveConsts.autoTcThreshold = params->autoTcThreshold;
@@ -1028,13 +1310,11 @@ static FfxErrorCode fsr2Dispatch(FfxFsr2Context_Private* context, const FfxFsr2D
     scheduleDispatch(context, params, &context->pipelineReconstructPreviousDepth, dispatchSrcX, dispatchSrcY);
     scheduleDispatch(context, params, &context->pipelineDepthClip, dispatchSrcX, dispatchSrcY);
 
-    const bool sharpenEnabled = params->enableSharpening;
-
     scheduleDispatch(context, params, &context->pipelineLock, dispatchSrcX, dispatchSrcY);
-    scheduleDispatch(context, params, sharpenEnabled ? &context->pipelineAccumulateSharpen : &context->pipelineAccumulate, dispatchDstX, dispatchDstY);
+    scheduleDispatch(context, params, rcasEnabled ? &context->pipelineAccumulateSharpen : &context->pipelineAccumulate, dispatchDstX, dispatchDstY);
 
     // RCAS
-    if (sharpenEnabled) {
+    if (rcasEnabled) {
 
         // dispatch RCAS
         const int32_t threadGroupWorkRegionDimRCAS = 16;
@@ -1069,6 +1349,51 @@ FfxErrorCode ffxFsr2ContextCreate(FfxFsr2Context* context, const FfxFsr2ContextD
         contextDescription,
         FFX_ERROR_INVALID_POINTER);
 
+    FFX_RETURN_ON_ERROR(
+        uint32_t(contextDescription->motionVectorDilationMode) < FFX_FSR2_MOTION_VECTOR_DILATION_MODE_COUNT,
+        FFX_ERROR_INVALID_ENUM);
+    FFX_RETURN_ON_ERROR(
+        uint32_t(contextDescription->autoExposure.mode) < FFX_FSR2_AUTO_EXPOSURE_MODE_COUNT,
+        FFX_ERROR_INVALID_ENUM);
+    FFX_RETURN_ON_ERROR(
+        contextDescription->autoExposure.histogramLowPercentile >= 0.0f &&
+        contextDescription->autoExposure.histogramHighPercentile <= 1.0f &&
+        (contextDescription->autoExposure.histogramLowPercentile < contextDescription->autoExposure.histogramHighPercentile ||
+         (contextDescription->autoExposure.histogramLowPercentile == 0.0f && contextDescription->autoExposure.histogramHighPercentile == 0.0f)),
+        FFX_ERROR_INVALID_ARGUMENT);
+    FFX_RETURN_ON_ERROR(
+        contextDescription->autoExposure.adaptationRateUp >= 0.0f &&
+        contextDescription->autoExposure.adaptationRateDown >= 0.0f,
+        FFX_ERROR_INVALID_ARGUMENT);
+    FFX_RETURN_ON_ERROR(
+        uint32_t(contextDescription->jitterSequence.sequence) < FFX_FSR2_JITTER_SEQUENCE_COUNT,
+        FFX_ERROR_INVALID_ENUM);
+    FFX_RETURN_ON_ERROR(
+        contextDescription->jitterSequence.basePhaseCount >= 0.0f,
+        FFX_ERROR_INVALID_ARGUMENT);
+    FFX_RETURN_ON_ERROR(
+        uint32_t(contextDescription->outputEncoding.encoding) < FFX_FSR2_OUTPUT_ENCODING_COUNT,
+        FFX_ERROR_INVALID_ENUM);
+    FFX_RETURN_ON_ERROR(
+        contextDescription->outputEncoding.paperWhiteNits >= 0.0f,
+        FFX_ERROR_INVALID_ARGUMENT);
+    if (contextDescription->jitterSequence.sequence == FFX_FSR2_JITTER_SEQUENCE_USER_TABLE) {
+
+        FFX_RETURN_ON_ERROR(
+            contextDescription->jitterSequence.userTableCount > 0,
+            FFX_ERROR_INVALID_ARGUMENT);
+    }
+    if (contextDescription->flags & FFX_FSR2_ENABLE_MATERIAL_ID_REACTIVITY) {
+
+        FFX_RETURN_ON_ERROR(
+            contextDescription->materialReactivity.table,
+            FFX_ERROR_INVALID_POINTER);
+        FFX_RETURN_ON_ERROR(
+            contextDescription->materialReactivity.count > 0 &&
+            contextDescription->materialReactivity.count <= FFX_FSR2_MAX_MATERIAL_IDS,
+            FFX_ERROR_INVALID_ARGUMENT);
+    }
+
     // validate that all callbacks are set for the interface
     FFX_RETURN_ON_ERROR(contextDescription->callbacks.fpGetDeviceCapabilities, FFX_ERROR_INCOMPLETE_INTERFACE);
     FFX_RETURN_ON_ERROR(contextDescription->callbacks.fpCreateBackendContext, FFX_ERROR_INCOMPLETE_INTERFACE);
@@ -1127,6 +1452,29 @@ FfxErrorCode ffxFsr2ContextDispatch(FfxFsr2Context* context, const FfxFsr2Dispat
         FFX_ERROR_NULL_DEVICE);
     }
 
+    // the accumulate pass permutations always write the depth and motion vector outputs.
+    if (contextPrivate->contextDescription.flags & FFX_FSR2_ENABLE_DISPLAY_RESOLUTION_DEPTH_OUTPUT)
+    {
+    FFX_RETURN_ON_ERROR(
+        !ffxFsr2ResourceIsNull(dispatchParams->outputDepth),
+        FFX_ERROR_INVALID_POINTER);
+    }
+    if (contextPrivate->contextDescription.flags & FFX_FSR2_ENABLE_DISPLAY_RESOLUTION_MOTION_VECTOR_OUTPUT)
+    {
+    FFX_RETURN_ON_ERROR(
+        !ffxFsr2ResourceIsNull(dispatchParams->outputMotionVectors),
+        FFX_ERROR_INVALID_POINTER);
+    }
+    if (contextPrivate->contextDescription.flags & FFX_FSR2_ENABLE_MATERIAL_ID_REACTIVITY)
+    {
+    FFX_RETURN_ON_ERROR(
+        !ffxFsr2ResourceIsNull(dispatchParams->materialId),
+        FFX_ERROR_INVALID_POINTER);
+    }
+    FFX_RETURN_ON_ERROR(
+        uint32_t(dispatchParams->debugView) < FFX_FSR2_DEBUG_VIEW_COUNT,
+        FFX_ERROR_INVALID_ENUM);
+
     // dispatch the FSR2 passes.
     const FfxErrorCode errorCode = fsr2Dispatch(contextPrivate, dispatchParams);
     return errorCode;
@@ -1215,6 +1563,78 @@ FfxErrorCode ffxFsr2GetJitterOffset(float* outX, float* outY, int32_t index, int
     return FFX_OK;
 }
 
+int32_t ffxFsr2GetJitterPhaseCountEx(int32_t renderWidth, int32_t displayWidth, const FfxFsr2JitterSequenceDescription* sequence)
+{
+    if (sequence && sequence->sequence == FFX_FSR2_JITTER_SEQUENCE_USER_TABLE) {
+        return sequence->userTableCount;
+    }
+
+    const float basePhaseCount = (sequence && sequence->basePhaseCount > 0.0f) ? sequence->basePhaseCount : FFX_FSR2_DEFAULT_JITTER_BASE_PHASE_COUNT;
+    const int32_t jitterPhaseCount = int32_t(basePhaseCount * pow((float(displayWidth) / renderWidth), 2.0f));
+    return FFX_MAXIMUM(jitterPhaseCount, 1);
+}
+
+FfxErrorCode ffxFsr2GetJitterOffsetEx(float* outX, float* outY, int32_t index, int32_t phaseCount, const FfxFsr2JitterSequenceDescription* sequence)
+{
+    FFX_RETURN_ON_ERROR(
+        outX,
+        FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(
+        outY,
+        FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(
+        phaseCount > 0,
+        FFX_ERROR_INVALID_ARGUMENT);
+
+    const FfxFsr2JitterSequence jitterSequence = sequence ? sequence->sequence : FFX_FSR2_JITTER_SEQUENCE_HALTON;
+    const int32_t phaseIndex = index % phaseCount;
+
+    float x = 0.0f;
+    float y = 0.0f;
+    switch (jitterSequence) {
+
+    case FFX_FSR2_JITTER_SEQUENCE_HALTON:
+        x = halton(phaseIndex + 1, 2);
+        y = halton(phaseIndex + 1, 3);
+        break;
+    case FFX_FSR2_JITTER_SEQUENCE_R2:
+        r2(&x, &y, phaseIndex + 1);
+        break;
+    case FFX_FSR2_JITTER_SEQUENCE_HALTON_BLUE_NOISE_ORDER:
+        haltonBlueNoiseOrder(&x, &y, phaseIndex, phaseCount);
+        break;
+    case FFX_FSR2_JITTER_SEQUENCE_USER_TABLE:
+        FFX_RETURN_ON_ERROR(
+            sequence->userTable,
+            FFX_ERROR_INVALID_POINTER);
+        FFX_RETURN_ON_ERROR(
+            sequence->userTableCount > 0,
+            FFX_ERROR_INVALID_ARGUMENT);
+        *outX = sequence->userTable[phaseIndex % sequence->userTableCount].x;
+        *outY = sequence->userTable[phaseIndex % sequence->userTableCount].y;
+        return FFX_OK;
+    default:
+        return FFX_ERROR_INVALID_ENUM;
+    }
+
+    *outX = x - 0.5f;
+    *outY = y - 0.5f;
+    return FFX_OK;
+}
+
+FfxErrorCode ffxFsr2ContextGetJitterOffset(FfxFsr2Context* context, float* outX, float* outY, int32_t index, int32_t phaseCount)
+{
+    FFX_RETURN_ON_ERROR(
+        context,
+        FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(
+        phaseCount > 0,
+        FFX_ERROR_INVALID_ARGUMENT);
+
+    FfxFsr2Context_Private* contextPrivate = (FfxFsr2Context_Private*)(context);
+    return ffxFsr2GetJitterOffsetEx(outX, outY, index, phaseCount, &contextPrivate->contextDescription.jitterSequence);
+}
+
 FFX_API bool ffxFsr2ResourceIsNull(FfxResource resource)
 {
     return resource.resource == NULL;
@@ -47,6 +47,43 @@
 /// @ingroup FSR2
 #define FFX_FSR2_CONTEXT_SIZE       (16536)
 
+/// The maximum number of history invalidation rectangles which can be passed
+/// to a single dispatch. See <c><i>FfxFsr2DispatchDescription</i></c>.
+///
+/// @ingroup FSR2
+#define FFX_FSR2_MAX_HISTORY_INVALIDATION_RECTS     (4)
+
+/// The maximum number of entries in the material reactivity table. See
+/// <c><i>FfxFsr2MaterialReactivityDescription</i></c>.
+///
+/// @ingroup FSR2
+#define FFX_FSR2_MAX_MATERIAL_IDS                   (256)
+
+/// The default percentile window of <c><i>FFX_FSR2_AUTO_EXPOSURE_MODE_HISTOGRAM</i></c>.
+/// See <c><i>FfxFsr2AutoExposureDescription</i></c>.
+///
+/// @ingroup FSR2
+#define FFX_FSR2_DEFAULT_HISTOGRAM_LOW_PERCENTILE   (0.1f)
+#define FFX_FSR2_DEFAULT_HISTOGRAM_HIGH_PERCENTILE  (0.9f)
+
+/// The default automatic exposure adaptation rate, per second.
+///
+/// @ingroup FSR2
+#define FFX_FSR2_DEFAULT_EXPOSURE_ADAPTATION_RATE   (1.0f)
+
+/// The default base jitter phase count, which is the length of the jitter
+/// sequence when the render and display resolutions are equal. See
+/// <c><i>FfxFsr2JitterSequenceDescription</i></c>.
+///
+/// @ingroup FSR2
+#define FFX_FSR2_DEFAULT_JITTER_BASE_PHASE_COUNT    (8.0f)
+
+/// The default luminance, in nits, at which a linear output value of 1.0 is
+/// displayed by the HDR output encodings. See <c><i>FfxFsr2OutputEncodingDescription</i></c>.
+///
+/// @ingroup FSR2
+#define FFX_FSR2_DEFAULT_PAPER_WHITE_NITS           (200.0f)
+
 #if defined(__cplusplus)
 extern "C" {
 #endif // #if defined(__cplusplus)
@@ -95,8 +132,199 @@ typedef enum FfxFsr2InitializationFlagBits {
     FFX_FSR2_ENABLE_TEXTURE1D_USAGE                     = (1<<7),   ///< A bit indicating that the backend should use 1D textures.
     FFX_FSR2_ENABLE_DEBUG_CHECKING                      = (1<<8),   ///< A bit indicating that the runtime should check some API values and report issues.
     FFX_FSR2_ALLOW_NULL_DEVICE_AND_COMMAND_LIST         = (1<<9),   ///< A bit indicating that the runtime should not check for null device/command list.
+    FFX_FSR2_ENABLE_COMPACT_TCR_HISTORY                 = (1<<10),  ///< A bit indicating that the transparency and composition histories should only store 16-bit luma.
+    FFX_FSR2_ENABLE_CATMULL_ROM_REPROJECTION            = (1<<11),  ///< A bit indicating that the history should be reprojected with a 5 tap Catmull-Rom filter instead of the 16 tap Lanczos filter.
+    FFX_FSR2_ENABLE_PACKED_LOCK_STATUS                  = (1<<12),  ///< A bit indicating that the lock status should be quantized into the history color surfaces instead of using surfaces of its own. Overrides <c><i>FFX_FSR2_ENABLE_CATMULL_ROM_REPROJECTION</i></c>. The RCAS pass reads the packed history through a permutation of its own which unpacks the color, so it can be combined with sharpening, lens distortion and the groupshared RCAS.
+    FFX_FSR2_ENABLE_DISPLAY_RESOLUTION_DEPTH_OUTPUT     = (1<<13),  ///< A bit indicating that the accumulate pass should also write a display resolution depth to <c><i>FfxFsr2DispatchDescription::outputDepth</i></c>.
+    FFX_FSR2_ENABLE_DISPLAY_RESOLUTION_MOTION_VECTOR_OUTPUT = (1<<14),  ///< A bit indicating that the accumulate pass should also write the display resolution motion vectors it reprojects with to <c><i>FfxFsr2DispatchDescription::outputMotionVectors</i></c>.
+    FFX_FSR2_ENABLE_ALPHA_UPSCALING                     = (1<<15),  ///< A bit indicating that the alpha channel of <c><i>FfxFsr2DispatchDescription::color</i></c> should be temporally upscaled into the alpha channel of <c><i>FfxFsr2DispatchDescription::output</i></c>, otherwise the output alpha is 1.
+    FFX_FSR2_ENABLE_LENS_DISTORTION                     = (1<<16),  ///< A bit indicating that <c><i>FfxFsr2DispatchDescription::output</i></c> should be pre-distorted with <c><i>FfxFsr2DispatchDescription::lensDistortion</i></c>. See <c><i>FfxFsr2LensDistortionDescription</i></c>.
+    FFX_FSR2_ENABLE_MATERIAL_ID_REACTIVITY              = (1<<17),  ///< A bit indicating that the reactive and transparency and composition masks should also be looked up from <c><i>FfxFsr2DispatchDescription::materialId</i></c>. See <c><i>FfxFsr2MaterialReactivityDescription</i></c>.
+    FFX_FSR2_ENABLE_GROUPSHARED_RCAS                    = (1<<18),  ///< A bit indicating that the RCAS pass should load the exposed color of each 16x16 tile and its border into groupshared memory once, and sharpen from there. The output is unchanged. Ignored with <c><i>FFX_FSR2_ENABLE_LENS_DISTORTION</i></c>, which samples the color at distorted positions.
 } FfxFsr2InitializationFlagBits;
 
+/// An enumeration of the strategies used to dilate motion vectors and depth in
+/// the reconstruct pass. See <c><i>FfxFsr2ContextDescription</i></c>.
+///
+/// Thin geometry rendered at low render scales may benefit from a wider search,
+/// while content upscaled by small ratios can skip dilation altogether.
+///
+/// @ingroup FSR2
+typedef enum FfxFsr2MotionVectorDilationMode {
+
+    FFX_FSR2_MOTION_VECTOR_DILATION_MODE_NEAREST_DEPTH_3X3 = 0,      ///< Use the motion vector of the nearest depth sample in a 3x3 neighborhood (default).
+    FFX_FSR2_MOTION_VECTOR_DILATION_MODE_NONE,                      ///< Use the motion vector of the pixel itself.
+    FFX_FSR2_MOTION_VECTOR_DILATION_MODE_NEAREST_DEPTH_5X5,         ///< Use the motion vector of the nearest depth sample in a 5x5 neighborhood.
+    FFX_FSR2_MOTION_VECTOR_DILATION_MODE_MAX_VELOCITY,              ///< Use the longest motion vector in a 5x5 neighborhood, found with a separable max filter.
+    FFX_FSR2_MOTION_VECTOR_DILATION_MODE_COUNT                      ///< The number of motion vector dilation modes.
+} FfxFsr2MotionVectorDilationMode;
+
+/// An enumeration of the methods used to derive the scene luminance that
+/// automatic exposure is computed from. Only used when the context is created
+/// with <c><i>FFX_FSR2_ENABLE_AUTO_EXPOSURE</i></c>.
+///
+/// @ingroup FSR2
+typedef enum FfxFsr2AutoExposureMode {
+
+    FFX_FSR2_AUTO_EXPOSURE_MODE_AVERAGE = 0,                        ///< Use the average log luminance of the whole frame (default).
+    FFX_FSR2_AUTO_EXPOSURE_MODE_HISTOGRAM,                          ///< Use the average log luminance of a percentile window of a log luminance histogram.
+    FFX_FSR2_AUTO_EXPOSURE_MODE_COUNT                               ///< The number of automatic exposure modes.
+} FfxFsr2AutoExposureMode;
+
+/// A structure encapsulating the automatic exposure settings of a context.
+///
+/// In <c><i>FFX_FSR2_AUTO_EXPOSURE_MODE_HISTOGRAM</i></c> the luminance pyramid
+/// pass bins the log2 luminance of every pixel into a 64 bin histogram covering
+/// [-16, 16] stops. The darkest <c><i>histogramLowPercentile</i></c> and brightest
+/// <c><i>1 - histogramHighPercentile</i></c> fractions of the pixels are discarded,
+/// so small light sources or dark corners do not pull the exposure. Render sizes
+/// below 128 pixels in either dimension fall back to the average.
+///
+/// Exposure adapts towards the new value at <c><i>adaptationRateUp</i></c> when the
+/// scene gets brighter and <c><i>adaptationRateDown</i></c> when it gets darker. Both
+/// modes use these rates. Setting a rate to 0 selects <c><i>FFX_FSR2_DEFAULT_EXPOSURE_ADAPTATION_RATE</i></c>,
+/// setting both percentiles to 0 selects <c><i>FFX_FSR2_DEFAULT_HISTOGRAM_LOW_PERCENTILE</i></c>
+/// and <c><i>FFX_FSR2_DEFAULT_HISTOGRAM_HIGH_PERCENTILE</i></c>.
+///
+/// @ingroup FSR2
+typedef struct FfxFsr2AutoExposureDescription {
+
+    FfxFsr2AutoExposureMode     mode;                               ///< The <c><i>FfxFsr2AutoExposureMode</i></c> used by the luminance pyramid pass.
+    float                       histogramLowPercentile;             ///< Fraction of the darkest pixels ignored by the histogram, in [0, 1).
+    float                       histogramHighPercentile;            ///< Fraction of the pixels, counted from the darkest, above which pixels are ignored, in (0, 1].
+    float                       adaptationRateUp;                   ///< Adaptation rate per second when luminance increases.
+    float                       adaptationRateDown;                 ///< Adaptation rate per second when luminance decreases.
+} FfxFsr2AutoExposureDescription;
+
+/// An enumeration of the sequences <c><i>ffxFsr2GetJitterOffsetEx</i></c> can
+/// generate sub-pixel jitter offsets from.
+///
+/// @ingroup FSR2
+typedef enum FfxFsr2JitterSequence {
+
+    FFX_FSR2_JITTER_SEQUENCE_HALTON = 0,                            ///< The Halton(2,3) sequence (default).
+    FFX_FSR2_JITTER_SEQUENCE_R2,                                    ///< The R2 additive recurrence, based on the plastic number.
+    FFX_FSR2_JITTER_SEQUENCE_HALTON_BLUE_NOISE_ORDER,               ///< The Halton(2,3) points of one phase, reordered so each offset is as far as possible from all previous ones.
+    FFX_FSR2_JITTER_SEQUENCE_USER_TABLE,                            ///< A table of offsets provided by the application.
+    FFX_FSR2_JITTER_SEQUENCE_COUNT                                  ///< The number of jitter sequences.
+} FfxFsr2JitterSequence;
+
+/// A structure encapsulating the jitter sequence used by the application.
+///
+/// The jitter phase count for an upscale ratio <c><i>n</i></c> is
+/// <c><i>basePhaseCount * n^2</i></c>, at least 1. Setting
+/// <c><i>basePhaseCount</i></c> to 0 selects
+/// <c><i>FFX_FSR2_DEFAULT_JITTER_BASE_PHASE_COUNT</i></c>. Lowering it shortens
+/// the sequence, so the history converges in fewer frames after a change of
+/// render resolution, at the cost of sampling fewer sub-pixel positions.
+///
+/// With <c><i>FFX_FSR2_JITTER_SEQUENCE_USER_TABLE</i></c> the phase count is
+/// <c><i>userTableCount</i></c>, regardless of the upscale ratio. Offsets are in
+/// unit pixel space, in the range [-0.5, 0.5), and the table must not contain a
+/// null vector.
+///
+/// @ingroup FSR2
+typedef struct FfxFsr2JitterSequenceDescription {
+
+    FfxFsr2JitterSequence       sequence;                           ///< The <c><i>FfxFsr2JitterSequence</i></c> to generate offsets from.
+    float                       basePhaseCount;                     ///< The phase count at an upscale ratio of 1.
+    const FfxFloatCoords2D*     userTable;                          ///< The offsets of <c><i>FFX_FSR2_JITTER_SEQUENCE_USER_TABLE</i></c>.
+    int32_t                     userTableCount;                     ///< The number of offsets in <c><i>userTable</i></c>.
+} FfxFsr2JitterSequenceDescription;
+
+/// A structure describing the radial pre-distortion of the output of a
+/// context created with <c><i>FFX_FSR2_ENABLE_LENS_DISTORTION</i></c>, for
+/// headsets whose compositor would otherwise warp the upscaled image with a
+/// second resample.
+///
+/// The history and every pass before RCAS stay in undistorted space. RCAS
+/// maps each output pixel at UV <c><i>u</i></c> to the undistorted UV
+/// <c><i>center + (u - center) * (1 + k1 * r^2 + k2 * r^4)</i></c>, where
+/// <c><i>r</i></c> is the distance of <c><i>u</i></c> to <c><i>center</i></c>
+/// in units of half the output size along each axis, and sharpens the upscaled
+/// image at that position. Positive coefficients give the barrel distortion
+/// that cancels the pincushion of a typical headset lens. Output pixels mapping
+/// outside the undistorted image are written as black.
+///
+/// RCAS runs whenever the flag is set: with <c><i>enableSharpening</i></c>
+/// false it only resamples. Debug views, the display resolution depth and
+/// motion vector outputs are not distorted.
+///
+/// @ingroup FSR2
+typedef struct FfxFsr2LensDistortionDescription {
+
+    FfxFloatCoords2D            center;                             ///< The center of the lens, in UV space of the output.
+    float                       k1;                                 ///< The coefficient of <c><i>r^2</i></c>.
+    float                       k2;                                 ///< The coefficient of <c><i>r^4</i></c>.
+} FfxFsr2LensDistortionDescription;
+
+/// An enumeration of the encodings the final pass can store the upscaled
+/// color in. See <c><i>FfxFsr2OutputEncodingDescription</i></c>.
+///
+/// @ingroup FSR2
+typedef enum FfxFsr2OutputEncoding {
+
+    FFX_FSR2_OUTPUT_ENCODING_LINEAR = 0,                            ///< Store the linear color, in the color space of the input (default).
+    FFX_FSR2_OUTPUT_ENCODING_PQ_BT2020,                             ///< Convert the BT.709 primaries to BT.2020 and apply the SMPTE ST 2084 (PQ) curve, for HDR10 presentation.
+    FFX_FSR2_OUTPUT_ENCODING_SCRGB,                                 ///< Scale to scRGB, where 1.0 is 80 nits, for FP16 presentation.
+    FFX_FSR2_OUTPUT_ENCODING_COUNT                                  ///< The number of output encodings.
+} FfxFsr2OutputEncoding;
+
+/// A structure encapsulating the encoding of the output of a context.
+///
+/// The encoding is applied by the last pass that writes
+/// <c><i>FfxFsr2DispatchDescription::output</i></c>: RCAS when sharpening is
+/// enabled, the accumulate pass otherwise. This replaces a separate full screen
+/// conversion pass after upscaling. The input color is expected to be linear
+/// with BT.709 primaries, with 1.0 at paper white, and
+/// <c><i>paperWhiteNits</i></c> sets the luminance that 1.0 is displayed at.
+/// Setting it to 0 selects <c><i>FFX_FSR2_DEFAULT_PAPER_WHITE_NITS</i></c>. The
+/// PQ encoding saturates at 10000 nits, and the output resource should be
+/// <c><i>R10G10B10A2_UNORM</i></c> or wider. The scRGB encoding is unbounded
+/// and needs a floating point output resource.
+///
+/// The encoding is read from the FSR2 constant buffer, it does not select a
+/// separate shader permutation.
+///
+/// @ingroup FSR2
+typedef struct FfxFsr2OutputEncodingDescription {
+
+    FfxFsr2OutputEncoding       encoding;                           ///< The <c><i>FfxFsr2OutputEncoding</i></c> of the output.
+    float                       paperWhiteNits;                     ///< The luminance, in nits, of a linear value of 1.0. Ignored by <c><i>FFX_FSR2_OUTPUT_ENCODING_LINEAR</i></c>.
+} FfxFsr2OutputEncodingDescription;
+
+/// A structure describing the reactive and transparency and composition mask
+/// values of a single material ID.
+///
+/// @ingroup FSR2
+typedef struct FfxFsr2MaterialReactivity {
+
+    float                       reactive;                           ///< The reactive mask value (between 0 and 1) of the material.
+    float                       transparencyAndComposition;         ///< The transparency and composition mask value (between 0 and 1) of the material.
+} FfxFsr2MaterialReactivity;
+
+/// A structure encapsulating the material reactivity table of a context
+/// created with <c><i>FFX_FSR2_ENABLE_MATERIAL_ID_REACTIVITY</i></c>.
+///
+/// The depth clip pass reads <c><i>FfxFsr2DispatchDescription::materialId</i></c>
+/// and looks each ID up in the table, so applications that already write a
+/// material or stencil ID do not need to render the reactive and transparency
+/// and composition masks. When those masks are provided as well, the larger of
+/// the authored and the looked up value is used. IDs at or above
+/// <c><i>count</i></c> map to 0.
+///
+/// The table is copied into an internal resource when the context is created,
+/// with the values quantized to 8 bits, so <c><i>table</i></c> only needs to be
+/// valid during <c><i>ffxFsr2ContextCreate</i></c>. Changing the table requires
+/// recreating the context.
+///
+/// @ingroup FSR2
+typedef struct FfxFsr2MaterialReactivityDescription {
+
+    const FfxFsr2MaterialReactivity* table;                         ///< A pointer to <c><i>count</i></c> <c><i>FfxFsr2MaterialReactivity</i></c> entries, indexed by material ID.
+    uint32_t                    count;                              ///< The number of entries in <c><i>table</i></c>, at most <c><i>FFX_FSR2_MAX_MATERIAL_IDS</i></c>.
+} FfxFsr2MaterialReactivityDescription;
+
 /// A structure encapsulating the parameters required to initialize FidelityFX
 /// Super Resolution 2 upscaling.
 ///
@@ -108,10 +336,52 @@ typedef struct FfxFsr2ContextDescription {
     FfxDimensions2D             displaySize;                        ///< The size of the presentation resolution targeted by the upscaling process.
     FfxFsr2Interface            callbacks;                          ///< A set of pointers to the backend implementation for FSR 2.0.
     FfxDevice                   device;                             ///< The abstracted device which is passed to some callback functions.
+    FfxFsr2MotionVectorDilationMode motionVectorDilationMode;       ///< The <c><i>FfxFsr2MotionVectorDilationMode</i></c> used by the reconstruct pass.
+    FfxFsr2AutoExposureDescription autoExposure;                    ///< The <c><i>FfxFsr2AutoExposureDescription</i></c> used when <c><i>FFX_FSR2_ENABLE_AUTO_EXPOSURE</i></c> is set.
+    FfxFsr2JitterSequenceDescription jitterSequence;                ///< The <c><i>FfxFsr2JitterSequenceDescription</i></c> the application jitters with, which sets the lock lifetime. <c><i>userTable</i></c> must stay valid for the lifetime of the context.
+    FfxFsr2OutputEncodingDescription outputEncoding;                ///< The <c><i>FfxFsr2OutputEncodingDescription</i></c> of <c><i>FfxFsr2DispatchDescription::output</i></c>.
+    FfxFsr2MaterialReactivityDescription materialReactivity;        ///< The <c><i>FfxFsr2MaterialReactivityDescription</i></c> used when <c><i>FFX_FSR2_ENABLE_MATERIAL_ID_REACTIVITY</i></c> is set.
 
     FfxFsr2Message              fpMessage;                          ///< A pointer to a function that can recieve messages from the runtime.
 } FfxFsr2ContextDescription;
 
+/// An enumeration of the internal signals of the accumulate pass that can be
+/// written to the output instead of the upscaled color. See
+/// <c><i>FfxFsr2DispatchDescription::debugView</i></c>.
+///
+/// Each view is encoded as an RGB color in [0, 1]:
+///
+/// View                                                        | Red                                   | Green                                 | Blue
+/// ----------------------------------------------------------- | ------------------------------------- | ------------------------------------- | ----------------------------------
+/// <c><i>FFX_FSR2_DEBUG_VIEW_DILATED_MOTION_VECTORS</i></c>    | 0.5 + x / 64, in display pixels       | 0.5 + y / 64, in display pixels       | 0
+/// <c><i>FFX_FSR2_DEBUG_VIEW_DEPTH_CLIP</i></c>                | Depth clip factor                     | Depth clip factor                     | 1 when the pixel has no history, else the depth clip factor
+/// <c><i>FFX_FSR2_DEBUG_VIEW_LOCK_STATUS</i></c>               | Remaining lock lifetime / 2           | Lock contribution of this frame       | 0
+/// <c><i>FFX_FSR2_DEBUG_VIEW_REACTIVE_MASKS</i></c>            | Dilated reactive factor               | Dilated transparency and composition  | 0
+/// <c><i>FFX_FSR2_DEBUG_VIEW_TEMPORAL_REACTIVE_FACTOR</i></c>  | Temporal reactive factor              | Temporal reactive factor              | 1 when the pixel is flagged as moving, else the factor
+/// <c><i>FFX_FSR2_DEBUG_VIEW_ACCUMULATION_WEIGHT</i></c>       | Accumulated history weight            | Weight of this frame's sample * 12    | Blend factor of this frame's sample
+/// <c><i>FFX_FSR2_DEBUG_VIEW_LUMA_INSTABILITY</i></c>          | Luma instability factor               | Luma instability factor               | Luma instability factor
+///
+/// <c><i>FFX_FSR2_DEBUG_VIEW_TILED</i></c> shrinks the views by 3 and lays
+/// them out in a 3x3 grid, in the order of this enumeration, with the
+/// upscaled color in the top left tile and the bottom right tile black. The
+/// tiles are a third of the display size, rounded down, and the rows and
+/// columns past them are black too.
+///
+/// @ingroup FSR2
+typedef enum FfxFsr2DebugView {
+
+    FFX_FSR2_DEBUG_VIEW_NONE = 0,                                   ///< Write the upscaled color (default).
+    FFX_FSR2_DEBUG_VIEW_DILATED_MOTION_VECTORS,                     ///< The dilated motion vectors used to reproject the history.
+    FFX_FSR2_DEBUG_VIEW_DEPTH_CLIP,                                 ///< The disocclusion detected by the depth clip pass.
+    FFX_FSR2_DEBUG_VIEW_LOCK_STATUS,                                ///< The lock lifetime and lock contribution.
+    FFX_FSR2_DEBUG_VIEW_REACTIVE_MASKS,                             ///< The dilated reactive and transparency and composition masks.
+    FFX_FSR2_DEBUG_VIEW_TEMPORAL_REACTIVE_FACTOR,                   ///< The temporal reactive factor stored with the history.
+    FFX_FSR2_DEBUG_VIEW_ACCUMULATION_WEIGHT,                        ///< The accumulation weights of the history and of this frame's sample.
+    FFX_FSR2_DEBUG_VIEW_LUMA_INSTABILITY,                           ///< The luma instability used to protect the history from shimmering.
+    FFX_FSR2_DEBUG_VIEW_TILED,                                      ///< All of the above, and the upscaled color, in a 3x3 grid.
+    FFX_FSR2_DEBUG_VIEW_COUNT                                       ///< The number of debug views.
+} FfxFsr2DebugView;
+
 /// A structure encapsulating the parameters for dispatching the various passes
 /// of FidelityFX Super Resolution 2.
 ///
@@ -125,12 +395,18 @@ typedef struct FfxFsr2DispatchDescription {
     FfxResource                 exposure;                           ///< A optional <c><i>FfxResource</i></c> containing a 1x1 exposure value.
     FfxResource                 reactive;                           ///< A optional <c><i>FfxResource</i></c> containing alpha value of reactive objects in the scene.
     FfxResource                 transparencyAndComposition;         ///< A optional <c><i>FfxResource</i></c> containing alpha value of special objects in the scene.
+    FfxResource                 materialId;                         ///< A <c><i>FfxResource</i></c> containing 8 or 16bit unsigned integer material IDs (at render resolution), required when <c><i>FFX_FSR2_ENABLE_MATERIAL_ID_REACTIVITY</i></c> is set. A stencil buffer must be copied to, or viewed as, an <c><i>R8_UINT</i></c> resource.
     FfxResource                 output;                             ///< A <c><i>FfxResource</i></c> containing the output color buffer for the current frame (at presentation resolution).
+    FfxResource                 outputDepth;                        ///< A <c><i>FfxResource</i></c> receiving 32bit depth values at presentation resolution, required when <c><i>FFX_FSR2_ENABLE_DISPLAY_RESOLUTION_DEPTH_OUTPUT</i></c> is set.
+    FfxResource                 outputMotionVectors;                ///< A <c><i>FfxResource</i></c> receiving 2-dimensional motion vectors in UV space at presentation resolution, required when <c><i>FFX_FSR2_ENABLE_DISPLAY_RESOLUTION_MOTION_VECTOR_OUTPUT</i></c> is set.
     FfxFloatCoords2D            jitterOffset;                       ///< The subpixel jitter offset applied to the camera.
     FfxFloatCoords2D            motionVectorScale;                  ///< The scale factor to apply to motion vectors.
     FfxDimensions2D             renderSize;                         ///< The resolution that was used for rendering the input resources.
     bool                        enableSharpening;                   ///< Enable an additional sharpening pass.
     float                       sharpness;                          ///< The sharpness value between 0 and 1, where 0 is no additional sharpness and 1 is maximum additional sharpness.
+    FfxResource                 sharpnessMap;                       ///< A optional <c><i>FfxResource</i></c> (of any resolution) whose values between 0 and 1 scale the sharpening of each output pixel, where 0 disables it and 1 applies <c><i>sharpness</i></c> unchanged.
+    bool                        disableSharpeningDenoise;           ///< Sharpen noise as strongly as detail, by default RCAS halves the sharpening of what it detects as noise.
+    float                       sharpeningDepthEdgeThreshold;       ///< The relative view depth step (between 0 and 1) above which sharpening fades out, to avoid halos around silhouettes. Sharpening is removed at twice the value, 0 disables the limiter.
     float                       frameTimeDelta;                     ///< The time elapsed since the last frame (expressed in milliseconds).
     float                       preExposure;                        ///< The pre exposure value (must be > 0.0f)
     bool                        reset;                              ///< A boolean value which when set to true, indicates the camera has moved discontinuously.
@@ -139,6 +415,11 @@ typedef struct FfxFsr2DispatchDescription {
     float                       cameraFovAngleVertical;             ///< The camera angle field of view in the vertical direction (expressed in radians).
     float                       viewSpaceToMetersFactor;            ///< The scale factor to convert view space units to meters
     bool                        deviceDepthNegativeOneToOne;        ///< Use OpenGL's default device Z range of [-1, 1].
+    FfxResource                 historyInvalidationMask;            ///< A optional <c><i>FfxResource</i></c> (of any resolution) where values above 0.5 mark pixels whose history must be discarded this frame.
+    FfxRect2D                   historyInvalidationRects[FFX_FSR2_MAX_HISTORY_INVALIDATION_RECTS]; ///< Rectangles (at presentation resolution) whose history must be discarded this frame.
+    uint32_t                    historyInvalidationRectCount;       ///< The number of valid entries in <c><i>historyInvalidationRects</i></c>.
+    FfxFsr2DebugView            debugView;                          ///< The <c><i>FfxFsr2DebugView</i></c> written to <c><i>output</i></c> instead of the upscaled color. Sharpening is skipped when set.
+    FfxFsr2LensDistortionDescription lensDistortion;                ///< The <c><i>FfxFsr2LensDistortionDescription</i></c> of <c><i>output</i></c>, used when <c><i>FFX_FSR2_ENABLE_LENS_DISTORTION</i></c> is set.
 
     // EXPERIMENTAL reactive mask generation parameters
     bool                        enableAutoReactive;                 ///< A boolean value to indicate internal reactive autogeneration should be used
@@ -438,6 +719,83 @@ FFX_API int32_t ffxFsr2GetJitterPhaseCount(int32_t renderWidth, int32_t displayW
 /// @ingroup FSR2
 FFX_API FfxErrorCode ffxFsr2GetJitterOffset(float* outX, float* outY, int32_t index, int32_t phaseCount);
 
+/// A helper function to calculate the jitter phase count of a
+/// <c><i>FfxFsr2JitterSequenceDescription</i></c>.
+///
+/// This is the same as <c><i>ffxFsr2GetJitterPhaseCount</i></c> with a
+/// configurable base phase count. Applications using a sequence other than the
+/// default one should pass the same description in
+/// <c><i>FfxFsr2ContextDescription::jitterSequence</i></c>, so that the lock
+/// lifetime computed by FSR2 matches the sequence length.
+///
+/// @param [in] renderWidth             The render resolution width.
+/// @param [in] displayWidth            The display resolution width.
+/// @param [in] sequence                A pointer to a <c><i>FfxFsr2JitterSequenceDescription</i></c> structure. May be <c>NULL</c> to use the defaults.
+///
+/// @returns
+/// The jitter phase count for the scaling factor between <c><i>renderWidth</i></c> and <c><i>displayWidth</i></c>.
+///
+/// @ingroup FSR2
+FFX_API int32_t ffxFsr2GetJitterPhaseCountEx(int32_t renderWidth, int32_t displayWidth, const FfxFsr2JitterSequenceDescription* sequence);
+
+/// A helper function to calculate the subpixel jitter offset of a
+/// <c><i>FfxFsr2JitterSequenceDescription</i></c>.
+///
+/// This is the same as <c><i>ffxFsr2GetJitterOffset</i></c> with a selectable
+/// sequence. Over a full phase, <c><i>FFX_FSR2_JITTER_SEQUENCE_R2</i></c>
+/// leaves smaller gaps between the samples on the display than Halton(2,3).
+/// <c><i>FFX_FSR2_JITTER_SEQUENCE_HALTON_BLUE_NOISE_ORDER</i></c> uses the same
+/// offsets as the default sequence over a full phase, but orders the first 256
+/// of them so that each offset is as far as possible from all previous ones.
+/// This shrinks the largest gap of the first frames, but covers fewer sub-pixel
+/// positions and takes longer to reach every display pixel, 16 frames instead
+/// of 12 at 3x. Which sequence converges fastest depends on the upscale ratio,
+/// see <c><i>ffxFsr2MeasureJitterCoverageReference</i></c>.
+///
+/// The blue noise orders of every phase count are built together on the first
+/// call with that sequence, which takes a few milliseconds, or at the creation
+/// of a context using it.
+///
+/// @param [out] outX                   A pointer to a <c>float</c> which will contain the subpixel jitter offset for the x dimension.
+/// @param [out] outY                   A pointer to a <c>float</c> which will contain the subpixel jitter offset for the y dimension.
+/// @param [in] index                   The index within the jitter sequence.
+/// @param [in] phaseCount              The length of jitter phase. See <c><i>ffxFsr2GetJitterPhaseCountEx</i></c>.
+/// @param [in] sequence                A pointer to a <c><i>FfxFsr2JitterSequenceDescription</i></c> structure. May be <c>NULL</c> to use the defaults.
+///
+/// @retval
+/// FFX_OK                              The operation completed successfully.
+/// @retval
+/// FFX_ERROR_INVALID_POINTER           Either <c><i>outX</i></c> or <c><i>outY</i></c> was <c>NULL</c>, or the user table was <c>NULL</c>.
+/// @retval
+/// FFX_ERROR_INVALID_ARGUMENT          Argument <c><i>phaseCount</i></c>, or the user table count, must be greater than 0.
+/// @retval
+/// FFX_ERROR_INVALID_ENUM              The <c><i>sequence</i></c> was not a valid <c><i>FfxFsr2JitterSequence</i></c>.
+///
+/// @ingroup FSR2
+FFX_API FfxErrorCode ffxFsr2GetJitterOffsetEx(float* outX, float* outY, int32_t index, int32_t phaseCount, const FfxFsr2JitterSequenceDescription* sequence);
+
+/// A helper function to calculate the subpixel jitter offset of the
+/// <c><i>FfxFsr2ContextDescription::jitterSequence</i></c> of a context.
+///
+/// This is the same as <c><i>ffxFsr2GetJitterOffsetEx</i></c> with the
+/// sequence of the context.
+///
+/// @param [in] context                 A pointer to a <c><i>FfxFsr2Context</i></c> structure.
+/// @param [out] outX                   A pointer to a <c>float</c> which will contain the subpixel jitter offset for the x dimension.
+/// @param [out] outY                   A pointer to a <c>float</c> which will contain the subpixel jitter offset for the y dimension.
+/// @param [in] index                   The index within the jitter sequence.
+/// @param [in] phaseCount              The length of jitter phase. See <c><i>ffxFsr2GetJitterPhaseCountEx</i></c>.
+///
+/// @retval
+/// FFX_OK                              The operation completed successfully.
+/// @retval
+/// FFX_ERROR_INVALID_POINTER           Either <c><i>context</i></c>, <c><i>outX</i></c> or <c><i>outY</i></c> was <c>NULL</c>.
+/// @retval
+/// FFX_ERROR_INVALID_ARGUMENT          Argument <c><i>phaseCount</i></c> must be greater than 0.
+///
+/// @ingroup FSR2
+FFX_API FfxErrorCode ffxFsr2ContextGetJitterOffset(FfxFsr2Context* context, float* outX, float* outY, int32_t index, int32_t phaseCount);
+
 /// A helper function to check if a resource is
 /// <c><i>FFX_FSR2_RESOURCE_IDENTIFIER_NULL</i></c>.
 ///
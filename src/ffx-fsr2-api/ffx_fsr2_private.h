@@ -44,6 +44,13 @@ typedef struct Fsr2Constants {
     float                       deltaTime;
     float                       dynamicResChangeFactor;
     float                       viewSpaceToMetersFactor;
+    uint32_t                    historyInvalidationRectCount;
+    uint32_t                    historyInvalidationRects[FFX_FSR2_MAX_HISTORY_INVALIDATION_RECTS * 2];   // packed 16bit min/max corners, two rects per 4 component vector
+    uint32_t                    debugView;
+    float                       outputScale;
+    float                       lensDistortionCenter[2];
+    float                       lensDistortionCoefficients[2];
+    uint32_t                    permutationOptions;     // patched per dispatch from FfxPipelineState::permutationOptions
 } Fsr2Constants;
 
 struct FfxFsr2ContextDescription;
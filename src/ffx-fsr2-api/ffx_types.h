@@ -32,10 +32,10 @@
 #endif // #if defined (FFX_GCC)
 
 /// Maximum supported number of simultaneously bound SRVs.
-#define FFX_MAX_NUM_SRVS            16
+#define FFX_MAX_NUM_SRVS            20
 
 /// Maximum supported number of simultaneously bound UAVs.
-#define FFX_MAX_NUM_UAVS            8
+#define FFX_MAX_NUM_UAVS            12
 
 /// Maximum number of constant buffers bound.
 #define FFX_MAX_NUM_CONST_BUFFERS   2
@@ -188,6 +188,7 @@ typedef struct FfxDeviceCapabilities {
     uint32_t                        waveLaneCountMin;                       ///< The minimum supported wavefront width.
     uint32_t                        waveLaneCountMax;                       ///< The maximum supported wavefront width.
     bool                            fp16Supported;                          ///< The device supports FP16 in hardware.
+    bool                            waveLaneShuffleSupported;               ///< The device supports reading values from arbitrary lanes of a wavefront in compute shaders.
     bool                            raytracingSupported;                    ///< The device supports raytracing.
 } FfxDeviceCapabilities;
 
@@ -212,6 +213,15 @@ typedef struct FfxFloatCoords2D {
     float                           y;                                      ///< The y coordinate of a 2-dimensional point.
 } FfxFloatCoords2D;
 
+/// A structure encapsulating a 2-dimensional rectangle, using 32bit signed integers.
+typedef struct FfxRect2D {
+
+    int32_t                         left;                                   ///< The left-most coordinate of the rectangle (inclusive).
+    int32_t                         top;                                    ///< The top-most coordinate of the rectangle (inclusive).
+    int32_t                         width;                                  ///< The width of the rectangle.
+    int32_t                         height;                                 ///< The height of the rectangle.
+} FfxRect2D;
+
 /// A structure describing a resource.
 typedef struct FfxResourceDescription {
 
@@ -256,6 +266,7 @@ typedef struct FfxPipelineState {
     uint32_t                        uavCount;                                       ///< Count of UAVs used in this pipeline
     uint32_t                        srvCount;                                       ///< Count of SRVs used in this pipeline
     uint32_t                        constCount;                                     ///< Count of constant buffers used in this pipeline
+    uint32_t                        permutationOptions;                             ///< Permutation switches read at runtime by uber shaders, patched into the FSR2 constant buffer
 
     FfxResourceBinding              uavResourceBindings[FFX_MAX_NUM_UAVS];          ///< Array of ResourceIdentifiers bound as UAVs
     FfxResourceBinding              srvResourceBindings[FFX_MAX_NUM_SRVS];          ///< Array of ResourceIdentifiers bound as SRVs
@@ -305,6 +316,8 @@ typedef struct FfxCreateResourceDescription {
 typedef struct FfxPipelineDescription {
 
     uint32_t                            contextFlags;                   ///< A collection of <c><i>FfxFsr2InitializationFlagBits</i></c> which were passed to the context.
+    uint32_t                            motionVectorDilationMode;       ///< The <c><i>FfxFsr2MotionVectorDilationMode</i></c> which was passed to the context.
+    uint32_t                            outputEncoding;                 ///< The <c><i>FfxFsr2OutputEncoding</i></c> which was passed to the context.
     FfxFilterType*                      samplers;                       ///< Array of static samplers.
     size_t                              samplerCount;                   ///< The number of samples contained inside <c><i>samplers</i></c>.
     const uint32_t*                     rootConstantBufferSizes;        ///< Array containing the sizes of the root constant buffers (count of 32 bit elements).
@@ -34,12 +34,15 @@ template<class T>
 void populate_permutation_key(uint32_t options, T& key)
 {
   key.index = 0;
+#if !defined(FFX_FSR2_UBER_SHADERS)
+  // the uber shaders read these switches from cbFSR2 at runtime, see FfxPipelineState::permutationOptions
   key.FFX_FSR2_OPTION_REPROJECT_USE_LANCZOS_TYPE = FFX_CONTAINS_FLAG(options, FSR2_SHADER_PERMUTATION_REPROJECT_USE_LANCZOS_TYPE);
   key.FFX_FSR2_OPTION_HDR_COLOR_INPUT = FFX_CONTAINS_FLAG(options, FSR2_SHADER_PERMUTATION_HDR_COLOR_INPUT);
   key.FFX_FSR2_OPTION_LOW_RESOLUTION_MOTION_VECTORS = FFX_CONTAINS_FLAG(options, FSR2_SHADER_PERMUTATION_LOW_RES_MOTION_VECTORS);
   key.FFX_FSR2_OPTION_JITTERED_MOTION_VECTORS = FFX_CONTAINS_FLAG(options, FSR2_SHADER_PERMUTATION_JITTER_MOTION_VECTORS);
   key.FFX_FSR2_OPTION_INVERTED_DEPTH = FFX_CONTAINS_FLAG(options, FSR2_SHADER_PERMUTATION_DEPTH_INVERTED);
   key.FFX_FSR2_OPTION_APPLY_SHARPENING = FFX_CONTAINS_FLAG(options, FSR2_SHADER_PERMUTATION_ENABLE_SHARPENING);
+#endif
   key.FFX_HALF = FFX_CONTAINS_FLAG(options, FSR2_SHADER_PERMUTATION_ALLOW_FP16);
 }
 
@@ -66,6 +69,7 @@ Fsr2ShaderBlobGL fsr2GetDepthClipPassPermutationBlobByIndex(uint32_t permutation
   ffx_fsr2_depth_clip_pass_PermutationKey key;
 
   populate_permutation_key(permutationOptions, key);
+  key.FFX_FSR2_OPTION_MATERIAL_ID_REACTIVITY = FFX_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_MATERIAL_ID_REACTIVITY);
 
   const int32_t tableIndex = g_ffx_fsr2_depth_clip_pass_IndirectionTable[key.index];
   return populate_shader_blob(g_ffx_fsr2_depth_clip_pass_PermutationInfo, tableIndex);
@@ -76,6 +80,7 @@ Fsr2ShaderBlobGL fsr2GetReconstructPreviousDepthPassPermutationBlobByIndex(uint3
   ffx_fsr2_reconstruct_previous_depth_pass_PermutationKey key;
 
   populate_permutation_key(permutationOptions, key);
+  key.FFX_FSR2_OPTION_MOTION_VECTOR_DILATION = FFX_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_MOTION_VECTOR_DILATION_0) | (FFX_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_MOTION_VECTOR_DILATION_1) << 1);
 
   const int32_t tableIndex = g_ffx_fsr2_reconstruct_previous_depth_pass_IndirectionTable[key.index];
   return populate_shader_blob(g_ffx_fsr2_reconstruct_previous_depth_pass_PermutationInfo, tableIndex);
@@ -96,6 +101,9 @@ Fsr2ShaderBlobGL fsr2GetAccumulatePassPermutationBlobByIndex(uint32_t permutatio
   ffx_fsr2_accumulate_pass_PermutationKey key;
 
   populate_permutation_key(permutationOptions, key);
+#if !defined(FFX_FSR2_UBER_SHADERS)
+  key.FFX_FSR2_OPTION_PACKED_LOCK_STATUS = FFX_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_PACKED_LOCK_STATUS);
+#endif // #if !defined(FFX_FSR2_UBER_SHADERS)
 
   const int32_t tableIndex = g_ffx_fsr2_accumulate_pass_IndirectionTable[key.index];
   return populate_shader_blob(g_ffx_fsr2_accumulate_pass_PermutationInfo, tableIndex);
@@ -106,6 +114,9 @@ Fsr2ShaderBlobGL fsr2GetRCASPassPermutationBlobByIndex(uint32_t permutationOptio
   ffx_fsr2_rcas_pass_PermutationKey key;
 
   populate_permutation_key(permutationOptions, key);
+#if !defined(FFX_FSR2_UBER_SHADERS)
+  key.FFX_FSR2_OPTION_PACKED_LOCK_STATUS = FFX_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_PACKED_LOCK_STATUS);
+#endif // #if !defined(FFX_FSR2_UBER_SHADERS)
 
   const int32_t tableIndex = g_ffx_fsr2_rcas_pass_IndirectionTable[key.index];
   return populate_shader_blob(g_ffx_fsr2_rcas_pass_PermutationInfo, tableIndex);
@@ -116,12 +127,15 @@ Fsr2ShaderBlobGL fsr2GetComputeLuminancePyramidPassPermutationBlobByIndex(uint32
   ffx_fsr2_compute_luminance_pyramid_pass_PermutationKey key;
 
   key.index = 0;
+#if !defined(FFX_FSR2_UBER_SHADERS)
   key.FFX_FSR2_OPTION_REPROJECT_USE_LANCZOS_TYPE = FFX_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_REPROJECT_USE_LANCZOS_TYPE);
   key.FFX_FSR2_OPTION_HDR_COLOR_INPUT = FFX_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_HDR_COLOR_INPUT);
   key.FFX_FSR2_OPTION_LOW_RESOLUTION_MOTION_VECTORS = FFX_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_LOW_RES_MOTION_VECTORS);
   key.FFX_FSR2_OPTION_JITTERED_MOTION_VECTORS = FFX_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_JITTER_MOTION_VECTORS);
   key.FFX_FSR2_OPTION_INVERTED_DEPTH = FFX_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_DEPTH_INVERTED);
   key.FFX_FSR2_OPTION_APPLY_SHARPENING = FFX_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_ENABLE_SHARPENING);
+#endif
+  key.FFX_FSR2_OPTION_SPD_SUBGROUP_SHUFFLE = FFX_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_SPD_SUBGROUP_SHUFFLE);
 
   const int32_t tableIndex = g_ffx_fsr2_compute_luminance_pyramid_pass_IndirectionTable[key.index];
   return populate_shader_blob(g_ffx_fsr2_compute_luminance_pyramid_pass_PermutationInfo, tableIndex);
@@ -142,6 +156,7 @@ Fsr2ShaderBlobGL fsr2GetTcrAutogeneratePassPermutationBlobByIndex(uint32_t permu
   ffx_fsr2_tcr_autogen_pass_PermutationKey key;
 
   populate_permutation_key(permutationOptions, key);
+  key.FFX_FSR2_OPTION_COMPACT_TCR_HISTORY = FFX_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_COMPACT_TCR_HISTORY);
 
   const int32_t tableIndex = g_ffx_fsr2_tcr_autogen_pass_IndirectionTable[key.index];
   return populate_shader_blob(g_ffx_fsr2_tcr_autogen_pass_PermutationInfo, tableIndex);
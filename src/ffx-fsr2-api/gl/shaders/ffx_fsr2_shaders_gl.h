@@ -55,6 +55,20 @@ extern "C" {
         FSR2_SHADER_PERMUTATION_ENABLE_SHARPENING = (1 << 5),    // FFX_FSR2_OPTION_APPLY_SHARPENING
         FSR2_SHADER_PERMUTATION_FORCE_WAVE64 = (1 << 6),    // doesn't map to a define, selects different table
         FSR2_SHADER_PERMUTATION_ALLOW_FP16 = (1 << 7),    // FFX_USE_16BIT
+        FSR2_SHADER_PERMUTATION_MOTION_VECTOR_DILATION_0 = (1 << 8),    // FFX_FSR2_OPTION_MOTION_VECTOR_DILATION, bit 0 of the dilation mode
+        FSR2_SHADER_PERMUTATION_MOTION_VECTOR_DILATION_1 = (1 << 9),    // FFX_FSR2_OPTION_MOTION_VECTOR_DILATION, bit 1 of the dilation mode
+        FSR2_SHADER_PERMUTATION_SPD_SUBGROUP_SHUFFLE = (1 << 10),    // FFX_FSR2_OPTION_SPD_SUBGROUP_SHUFFLE, luminance pyramid pass only
+        FSR2_SHADER_PERMUTATION_COMPACT_TCR_HISTORY = (1 << 11),    // FFX_FSR2_OPTION_COMPACT_TCR_HISTORY, tcr autogen pass only
+        FSR2_SHADER_PERMUTATION_REPROJECT_CATMULL_ROM = (1 << 12),  // read from cbFSR2 by the accumulate pass, not a compiled permutation
+        FSR2_SHADER_PERMUTATION_PACKED_LOCK_STATUS = (1 << 13),     // FFX_FSR2_OPTION_PACKED_LOCK_STATUS, accumulate and rcas passes only
+        FSR2_SHADER_PERMUTATION_UPSCALED_DEPTH_OUTPUT = (1 << 14),  // read from cbFSR2 by the accumulate pass, not a compiled permutation
+        FSR2_SHADER_PERMUTATION_UPSCALED_MOTION_VECTOR_OUTPUT = (1 << 15), // read from cbFSR2 by the accumulate pass, not a compiled permutation
+        FSR2_SHADER_PERMUTATION_ALPHA_UPSCALING = (1 << 16),  // read from cbFSR2 by the accumulate and rcas passes, not a compiled permutation
+        FSR2_SHADER_PERMUTATION_OUTPUT_ENCODING_0 = (1 << 17),  // bit 0 of the output encoding, read from cbFSR2 by the accumulate and rcas passes
+        FSR2_SHADER_PERMUTATION_OUTPUT_ENCODING_1 = (1 << 18),  // bit 1 of the output encoding, read from cbFSR2 by the accumulate and rcas passes
+        FSR2_SHADER_PERMUTATION_LENS_DISTORTION = (1 << 19),    // read from cbFSR2 by the rcas pass, not a compiled permutation
+        FSR2_SHADER_PERMUTATION_MATERIAL_ID_REACTIVITY = (1 << 20), // FFX_FSR2_OPTION_MATERIAL_ID_REACTIVITY, depth clip pass only
+        FSR2_SHADER_PERMUTATION_RCAS_GROUPSHARED = (1 << 21),   // read from cbFSR2 by the rcas pass, not a compiled permutation
     } Fs2ShaderPermutationOptionsGL;
 
     // Get a GL shader blob for the specified pass and permutation index.
@@ -646,6 +646,12 @@ void FsrEasuH(
 // RCAS also supports a define to enable a more expensive path to avoid some sharpening of noise.
 // Would suggest it is better to apply film grain after RCAS sharpening (and after scaling) instead of using this define,
 //  #define FSR_RCAS_DENOISE 1
+// The 32-bit version can instead hand the lobe to a callback, to limit it with data RCAS does not see (noise term 'nz' in {0.5 to 1}),
+//  #define FSR_RCAS_LOBE_CALLBACK 1
+//  FfxFloat32 FsrRcasLobeF(FfxFloat32 lobe, FfxFloat32 nz, FfxInt32x2 p);
+// The 32-bit version can also forward a per-pixel value of the caller to every load, passed as the last argument of FsrRcasF(),
+//  #define FSR_RCAS_LOAD_PARAMETER FfxFloat32x2
+//  FfxFloat32x4 FsrRcasLoadF(FfxInt32x2 p, FSR_RCAS_LOAD_PARAMETER param);
 //==============================================================================================================================
 // This is set at the limit of providing unnatural results for sharpening.
 #define FSR_RCAS_LIMIT (0.25-(1.0/16.0))
@@ -676,8 +682,17 @@ void FsrEasuH(
 //==============================================================================================================================
 #if defined(FFX_GPU)&&defined(FSR_RCAS_F)
  // Input callback prototypes that need to be implemented by calling shader
+#ifdef FSR_RCAS_LOAD_PARAMETER
+ FfxFloat32x4 FsrRcasLoadF(FfxInt32x2 p, FSR_RCAS_LOAD_PARAMETER param);
+ #define FSR_RCAS_LOAD_F(p) FsrRcasLoadF(p, param)
+#else
  FfxFloat32x4 FsrRcasLoadF(FfxInt32x2 p);
+ #define FSR_RCAS_LOAD_F(p) FsrRcasLoadF(p)
+#endif
  void FsrRcasInputF(inout FfxFloat32 r,inout FfxFloat32 g,inout FfxFloat32 b);
+#ifdef FSR_RCAS_LOBE_CALLBACK
+ FfxFloat32 FsrRcasLobeF(FfxFloat32 lobe, FfxFloat32 nz, FfxInt32x2 p);
+#endif
 //------------------------------------------------------------------------------------------------------------------------------
  void FsrRcasF(out FfxFloat32 pixR,  // Output values, non-vector so port between RcasFilter() and RcasFilterH() is easy.
                out FfxFloat32 pixG,
@@ -686,24 +701,30 @@ void FsrEasuH(
                out FfxFloat32 pixA,
 #endif
                FfxUInt32x2 ip,  // Integer pixel position in output.
+#ifdef FSR_RCAS_LOAD_PARAMETER
+               FfxUInt32x4 con,  // Constant generated by RcasSetup().
+               FSR_RCAS_LOAD_PARAMETER param)
+ {  // Passed to every FsrRcasLoadF().
+#else
                FfxUInt32x4 con)
  {  // Constant generated by RcasSetup().
+#endif
      // Algorithm uses minimal 3x3 pixel neighborhood.
      //    b
      //  d e f
      //    h
      FfxInt32x2   sp = FfxInt32x2(ip);
-     FfxFloat32x3 b  = FsrRcasLoadF(sp + FfxInt32x2(0, -1)).rgb;
-     FfxFloat32x3 d  = FsrRcasLoadF(sp + FfxInt32x2(-1, 0)).rgb;
+     FfxFloat32x3 b  = FSR_RCAS_LOAD_F(sp + FfxInt32x2(0, -1)).rgb;
+     FfxFloat32x3 d  = FSR_RCAS_LOAD_F(sp + FfxInt32x2(-1, 0)).rgb;
 #ifdef FSR_RCAS_PASSTHROUGH_ALPHA
-     FfxFloat32x4 ee = FsrRcasLoadF(sp);
+     FfxFloat32x4 ee = FSR_RCAS_LOAD_F(sp);
      FfxFloat32x3 e  = ee.rgb;
      pixA            = ee.a;
 #else
-     FfxFloat32x3 e = FsrRcasLoadF(sp).rgb;
+     FfxFloat32x3 e = FSR_RCAS_LOAD_F(sp).rgb;
 #endif
-     FfxFloat32x3 f = FsrRcasLoadF(sp + FfxInt32x2(1, 0)).rgb;
-     FfxFloat32x3 h = FsrRcasLoadF(sp + FfxInt32x2(0, 1)).rgb;
+     FfxFloat32x3 f = FSR_RCAS_LOAD_F(sp + FfxInt32x2(1, 0)).rgb;
+     FfxFloat32x3 h = FSR_RCAS_LOAD_F(sp + FfxInt32x2(0, 1)).rgb;
      // Rename (32-bit) or regroup (16-bit).
      FfxFloat32 bR = b.r;
      FfxFloat32 bG = b.g;
@@ -760,6 +781,9 @@ void FsrEasuH(
  // Apply noise removal.
 #ifdef FSR_RCAS_DENOISE
      lobe *= nz;
+#endif
+#ifdef FSR_RCAS_LOBE_CALLBACK
+     lobe = FsrRcasLobeF(lobe, nz, sp);
 #endif
      // Resolve, which needs the medium precision rcp approximation to avoid visible tonality changes.
      FfxFloat32 rcpL = ffxApproximateReciprocalMedium(FfxFloat32(4.0) * lobe + FfxFloat32(1.0));
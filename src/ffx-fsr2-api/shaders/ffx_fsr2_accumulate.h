@@ -38,20 +38,20 @@ void Accumulate(const AccumulationPassCommonParams params, FFX_PARAMETER_INOUT F
     // Aviod invalid values when accumulation and upsampled weight is 0
     fAccumulation = ffxMax(FSR2_EPSILON.xxx, fAccumulation + fUpsampledColorAndWeight.www);
 
-#if FFX_FSR2_OPTION_HDR_COLOR_INPUT
-    //YCoCg -> RGB -> Tonemap -> YCoCg (Use RGB tonemapper to avoid color desaturation)
-    fUpsampledColorAndWeight.xyz = RGBToYCoCg(Tonemap(YCoCgToRGB(fUpsampledColorAndWeight.xyz)));
-    fHistoryColor = RGBToYCoCg(Tonemap(YCoCgToRGB(fHistoryColor)));
-#endif
+    if (FFX_FSR2_HDR_COLOR_INPUT) {
+        //YCoCg -> RGB -> Tonemap -> YCoCg (Use RGB tonemapper to avoid color desaturation)
+        fUpsampledColorAndWeight.xyz = RGBToYCoCg(Tonemap(YCoCgToRGB(fUpsampledColorAndWeight.xyz)));
+        fHistoryColor = RGBToYCoCg(Tonemap(YCoCgToRGB(fHistoryColor)));
+    }
 
     const FfxFloat32x3 fAlpha = fUpsampledColorAndWeight.www / fAccumulation;
     fHistoryColor = ffxLerp(fHistoryColor, fUpsampledColorAndWeight.xyz, fAlpha);
 
     fHistoryColor = YCoCgToRGB(fHistoryColor);
 
-#if FFX_FSR2_OPTION_HDR_COLOR_INPUT
-    fHistoryColor = InverseTonemap(fHistoryColor);
-#endif
+    if (FFX_FSR2_HDR_COLOR_INPUT) {
+        fHistoryColor = InverseTonemap(fHistoryColor);
+    }
 }
 
 void RectifyHistory(
@@ -99,10 +99,92 @@ void RectifyHistory(
 
 void WriteUpscaledOutput(FfxInt32x2 iPxHrPos, FfxFloat32x3 fUpscaledColor)
 {
-    StoreUpscaledOutput(iPxHrPos, fUpscaledColor);
+    StoreUpscaledOutput(iPxHrPos, EncodeOutput(fUpscaledColor));
+}
+
+FfxFloat32 AccumulateAlpha(const AccumulationPassCommonParams params, const UpsampledAlpha upsampledAlpha, FfxFloat32 fAccumulation, FfxFloat32 fUpsampledWeight)
+{
+    if (params.bIsNewSample) {
+        return upsampledAlpha.fAlpha;
+    }
+
+    // Unlike color, locks and luma instability never keep alpha history outside of its range, a coverage edge dragged along by history is a visible halo once composited
+    const FfxFloat32 fHistoryAlpha = clamp(SampleUpscaledAlphaHistory(params.fReprojectedHrUv), upsampledAlpha.fMin, upsampledAlpha.fMax);
+
+    const FfxFloat32 fBlendFactor = fUpsampledWeight / ffxMax(FSR2_EPSILON, fAccumulation + fUpsampledWeight);
+    return ffxLerp(fHistoryAlpha, upsampledAlpha.fAlpha, fBlendFactor);
 }
 
-void FinalizeLockStatus(const AccumulationPassCommonParams params, FfxFloat32x2 fLockStatus, FfxFloat32 fUpsampledWeight)
+struct DebugViewSignals
+{
+    FfxFloat32x3 fColor;
+    FfxFloat32x2 fLockStatus;
+    FfxFloat32 fLockContribution;
+    FfxFloat32 fTemporalReactiveFactor;
+    FfxFloat32 fAccumulation;
+    FfxFloat32 fUpsampledWeight;
+    FfxFloat32 fLumaInstability;
+};
+
+// Encodings are documented with FfxFsr2DebugView and mirrored by ffxFsr2EncodeDebugViewReference
+FfxFloat32x3 ComputeDebugViewColor(FfxUInt32 uView, const AccumulationPassCommonParams params, const DebugViewSignals signals)
+{
+    FfxFloat32x3 fColor = FfxFloat32x3(0.0f, 0.0f, 0.0f);
+
+    if (uView == FFX_FSR2_DEBUGVIEW_NONE) {
+        fColor = signals.fColor;
+    } else if (uView == FFX_FSR2_DEBUGVIEW_DILATED_MOTION_VECTORS) {
+        const FfxFloat32x2 fPxMotionVector = params.fMotionVector * FfxFloat32x2(DisplaySize());
+        fColor = FfxFloat32x3(ffxSaturate(0.5f + fPxMotionVector / 64.0f), 0.0f);
+    } else if (uView == FFX_FSR2_DEBUGVIEW_DEPTH_CLIP) {
+        fColor = FfxFloat32x3(params.fDepthClipFactor, params.fDepthClipFactor, params.bIsNewSample ? 1.0f : params.fDepthClipFactor);
+    } else if (uView == FFX_FSR2_DEBUGVIEW_LOCK_STATUS) {
+        fColor = FfxFloat32x3(ffxSaturate(signals.fLockStatus[LOCK_LIFETIME_REMAINING] * 0.5f), ffxSaturate(signals.fLockContribution), 0.0f);
+    } else if (uView == FFX_FSR2_DEBUGVIEW_REACTIVE_MASKS) {
+        fColor = FfxFloat32x3(params.fDilatedReactiveFactor, params.fAccumulationMask, 0.0f);
+    } else if (uView == FFX_FSR2_DEBUGVIEW_TEMPORAL_REACTIVE_FACTOR) {
+        // A negative factor flags a pixel that was in motion
+        const FfxFloat32 fFactor = ffxSaturate(abs(signals.fTemporalReactiveFactor));
+        fColor = FfxFloat32x3(fFactor, fFactor, signals.fTemporalReactiveFactor < 0.0f ? 1.0f : fFactor);
+    } else if (uView == FFX_FSR2_DEBUGVIEW_ACCUMULATION_WEIGHT) {
+        const FfxFloat32 fBlendFactor = params.bIsNewSample ? 1.0f : signals.fUpsampledWeight / ffxMax(FSR2_EPSILON, signals.fAccumulation + signals.fUpsampledWeight);
+        fColor = FfxFloat32x3(ffxSaturate(signals.fAccumulation / fMaxAccumulationLanczosWeight), ffxSaturate(signals.fUpsampledWeight / fUpsampleLanczosWeightScale), ffxSaturate(fBlendFactor));
+    } else if (uView == FFX_FSR2_DEBUGVIEW_LUMA_INSTABILITY) {
+        fColor = FFX_BROADCAST_FLOAT32X3(ffxSaturate(signals.fLumaInstability));
+    }
+
+    return fColor;
+}
+
+void WriteDebugView(const AccumulationPassCommonParams params, const DebugViewSignals signals)
+{
+    if (DebugView() != FFX_FSR2_DEBUGVIEW_TILED) {
+        WriteUpscaledOutput(params.iPxHrPos, ComputeDebugViewColor(DebugView(), params, signals));
+        return;
+    }
+
+    // Every third pixel scatters its views to a 3x3 grid of tiles, pixels past the grid are cleared
+    const FfxInt32x2 iTileSize = DisplaySize() / 3;
+    if (params.iPxHrPos.x >= iTileSize.x * 3 || params.iPxHrPos.y >= iTileSize.y * 3) {
+        WriteUpscaledOutput(params.iPxHrPos, FfxFloat32x3(0.0f, 0.0f, 0.0f));
+    } else if ((params.iPxHrPos.x % 3) == 0 && (params.iPxHrPos.y % 3) == 0) {
+        for (FfxInt32 iTile = 0; iTile < 9; iTile++) {
+            const FfxInt32x2 iTileOrigin = FfxInt32x2(iTile % 3, iTile / 3) * iTileSize;
+            WriteUpscaledOutput(iTileOrigin + params.iPxHrPos / 3, ComputeDebugViewColor(FfxUInt32(iTile), params, signals));
+        }
+    }
+}
+
+void WriteUpscaledDepthOutput(const AccumulationPassCommonParams params)
+{
+    // Depth of the render resolution pixel nearest to the jittered sample this pixel reconstructs, never filtered across edges
+    const FfxFloat32x2 fLrPos = params.fHrUv * FfxFloat32x2(RenderSize()) + Jitter();
+    const FfxInt32x2 iPxLrPos = ffxMin(FfxInt32x2(ffxMax(fLrPos, FfxFloat32x2(0.0f, 0.0f))), RenderSize() - FfxInt32x2(1, 1));
+
+    StoreUpscaledDepthOutput(params.iPxHrPos, LoadInputDepth(iPxLrPos));
+}
+
+void FinalizeLockStatus(const AccumulationPassCommonParams params, FFX_PARAMETER_INOUT FfxFloat32x2 fLockStatus, FfxFloat32 fUpsampledWeight)
 {
     // we expect similar motion for next frame
     // kill lock if that location is outside screen, avoid locks to be clamped to screen borders
@@ -117,7 +199,13 @@ void FinalizeLockStatus(const AccumulationPassCommonParams params, FfxFloat32x2
         fLockStatus[LOCK_LIFETIME_REMAINING] = ffxMax(FfxFloat32(0), fLockStatus[LOCK_LIFETIME_REMAINING] - fLifetimeDecrease);
     }
 
-    StoreLockStatus(params.iPxHrPos, fLockStatus);
+    // the packed lock status is stored together with the history color
+#if FFX_FSR2_OPTION_PACKED_LOCK_STATUS
+    if (!FFX_FSR2_PACKED_LOCK_STATUS)
+#endif
+    {
+        StoreLockStatus(params.iPxHrPos, fLockStatus);
+    }
 }
 
 
@@ -143,9 +231,9 @@ FfxFloat32 ComputeLumaInstabilityFactor(const AccumulationPassCommonParams param
 
     FfxFloat32 fCurrentFrameLuma = clippingBox.boxCenter.x;
 
-#if FFX_FSR2_OPTION_HDR_COLOR_INPUT
-    fCurrentFrameLuma = fCurrentFrameLuma / (1.0f + ffxMax(0.0f, fCurrentFrameLuma));
-#endif
+    if (FFX_FSR2_HDR_COLOR_INPUT) {
+        fCurrentFrameLuma = fCurrentFrameLuma / (1.0f + ffxMax(0.0f, fCurrentFrameLuma));
+    }
 
     fCurrentFrameLuma = round(fCurrentFrameLuma * 255.0f) / 255.0f;
 
@@ -231,6 +319,9 @@ AccumulationPassCommonParams InitParams(FfxInt32x2 iPxHrPos)
     params.fAccumulationMask = fDilatedReactiveMasks.y;
     params.bIsResetFrame = (0 == FrameIndex());
 
+    // Pixels inside a history invalidation region are treated as if the whole frame had been reset.
+    params.bIsResetFrame = params.bIsResetFrame || IsHistoryInvalidated(iPxHrPos);
+
     params.bIsNewSample = (params.bIsExistingSample == false || params.bIsResetFrame);
 
     return params;
@@ -260,7 +351,8 @@ void Accumulate(FfxInt32x2 iPxHrPos)
 
     // Load upsampled input color
     RectificationBox clippingBox;
-    FfxFloat32x4 fUpsampledColorAndWeight = ComputeUpsampledColorAndWeight(params, clippingBox, fThisFrameReactiveFactor);
+    UpsampledAlpha upsampledAlpha;
+    FfxFloat32x4 fUpsampledColorAndWeight = ComputeUpsampledColorAndWeight(params, clippingBox, fThisFrameReactiveFactor, upsampledAlpha);
     
     const FfxFloat32 fLumaInstabilityFactor = ComputeLumaInstabilityFactor(params, clippingBox, fThisFrameReactiveFactor, fLuminanceDiff);
 
@@ -276,6 +368,12 @@ void Accumulate(FfxInt32x2 iPxHrPos)
         Accumulate(params, fHistoryColor, fAccumulation, fUpsampledColorAndWeight);
     }
 
+    FfxFloat32 fUpscaledAlpha = 1.0f;
+    if (FFX_FSR2_ALPHA_UPSCALING) {
+        fUpscaledAlpha = AccumulateAlpha(params, upsampledAlpha, fAccumulation.x, fUpsampledColorAndWeight.w);
+        StoreInternalAlpha(iPxHrPos, fUpscaledAlpha);
+    }
+
     fHistoryColor = UnprepareRgb(fHistoryColor, Exposure());
 
     FinalizeLockStatus(params, fLockStatus, fUpsampledColorAndWeight.w);
@@ -283,12 +381,39 @@ void Accumulate(FfxInt32x2 iPxHrPos)
     // Get new temporal reactive factor
     fTemporalReactiveFactor = ComputeTemporalReactiveFactor(params, fThisFrameReactiveFactor);
 
-    StoreInternalColorAndWeight(iPxHrPos, FfxFloat32x4(fHistoryColor, fTemporalReactiveFactor));
-
-    // Output final color when RCAS is disabled
-#if FFX_FSR2_OPTION_APPLY_SHARPENING == 0
-    WriteUpscaledOutput(iPxHrPos, fHistoryColor);
+#if FFX_FSR2_OPTION_PACKED_LOCK_STATUS
+    if (FFX_FSR2_PACKED_LOCK_STATUS) {
+        StoreInternalColorAndWeight(iPxHrPos, PackHistory(fHistoryColor, fTemporalReactiveFactor, fLockStatus));
+    } else
 #endif
+    {
+        StoreInternalColorAndWeight(iPxHrPos, FfxFloat32x4(fHistoryColor, fTemporalReactiveFactor));
+    }
+
+    // Output final color when RCAS is disabled, debug views replace it and always run without RCAS
+    if (!FFX_FSR2_APPLY_SHARPENING) {
+        if (DebugView() != FFX_FSR2_DEBUGVIEW_NONE) {
+            DebugViewSignals signals;
+            signals.fColor = fHistoryColor;
+            signals.fLockStatus = fLockStatus;
+            signals.fLockContribution = fLockContributionThisFrame;
+            signals.fTemporalReactiveFactor = fTemporalReactiveFactor;
+            signals.fAccumulation = fAccumulation.x;
+            signals.fUpsampledWeight = fUpsampledColorAndWeight.w;
+            signals.fLumaInstability = fLumaInstabilityFactor;
+            WriteDebugView(params, signals);
+        } else {
+            // opaque without alpha upscaling, like StoreUpscaledOutput
+            StoreUpscaledOutputWithAlpha(iPxHrPos, EncodeOutput(fHistoryColor), fUpscaledAlpha);
+        }
+    }
+    if (FFX_FSR2_UPSCALED_DEPTH_OUTPUT) {
+        WriteUpscaledDepthOutput(params);
+    }
+    if (FFX_FSR2_UPSCALED_MOTION_VECTOR_OUTPUT) {
+        // The motion vector this pixel was reprojected with, in the UV space convention of the input motion vectors
+        StoreUpscaledMotionVectorOutput(iPxHrPos, params.fMotionVector);
+    }
     StoreNewLocks(iPxHrPos, 0);
 }
 
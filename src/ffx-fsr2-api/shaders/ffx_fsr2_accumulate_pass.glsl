@@ -28,7 +28,10 @@
 
 #define FSR2_BIND_SRV_INPUT_EXPOSURE                         0
 #define FSR2_BIND_SRV_DILATED_REACTIVE_MASKS                 1
-#if FFX_FSR2_OPTION_LOW_RESOLUTION_MOTION_VECTORS
+#if FFX_FSR2_OPTION_UBER
+#define FSR2_BIND_SRV_DILATED_MOTION_VECTORS                 2
+#define FSR2_BIND_SRV_INPUT_MOTION_VECTORS                   26
+#elif FFX_FSR2_OPTION_LOW_RESOLUTION_MOTION_VECTORS
 #define FSR2_BIND_SRV_DILATED_MOTION_VECTORS                 2
 #else
 #define FSR2_BIND_SRV_INPUT_MOTION_VECTORS                   2
@@ -43,14 +46,22 @@
 #define FSR2_BIND_SRV_SCENE_LUMINANCE_MIPS                   10
 #define FSR2_BIND_SRV_AUTO_EXPOSURE                          11
 #define FSR2_BIND_SRV_LUMA_HISTORY                           12
+#define FSR2_BIND_SRV_HISTORY_INVALIDATION_MASK              13
+
+#define FSR2_BIND_UAV_INTERNAL_UPSCALED                      14
+#define FSR2_BIND_UAV_LOCK_STATUS                            15
+#define FSR2_BIND_UAV_UPSCALED_OUTPUT                        16
+#define FSR2_BIND_UAV_NEW_LOCKS                              17
+#define FSR2_BIND_UAV_LUMA_HISTORY                           18
 
-#define FSR2_BIND_UAV_INTERNAL_UPSCALED                      13
-#define FSR2_BIND_UAV_LOCK_STATUS                            14
-#define FSR2_BIND_UAV_UPSCALED_OUTPUT                        15
-#define FSR2_BIND_UAV_NEW_LOCKS                              16
-#define FSR2_BIND_UAV_LUMA_HISTORY                           17
+#define FSR2_BIND_CB_FSR2                                    19
 
-#define FSR2_BIND_CB_FSR2                                    18
+#define FSR2_BIND_SRV_INPUT_DEPTH                            20
+#define FSR2_BIND_UAV_UPSCALED_DEPTH_OUTPUT                  21
+#define FSR2_BIND_UAV_UPSCALED_MOTION_VECTOR_OUTPUT          22
+#define FSR2_BIND_SRV_INPUT_COLOR                            23
+#define FSR2_BIND_SRV_INTERNAL_UPSCALED_ALPHA                24
+#define FSR2_BIND_UAV_INTERNAL_UPSCALED_ALPHA                25
 
 #include "ffx_fsr2_callbacks_glsl.h"
 #include "ffx_fsr2_common.h"
@@ -21,7 +21,10 @@
 
 #define FSR2_BIND_SRV_INPUT_EXPOSURE                         0
 #define FSR2_BIND_SRV_DILATED_REACTIVE_MASKS                 1
-#if FFX_FSR2_OPTION_LOW_RESOLUTION_MOTION_VECTORS
+#if FFX_FSR2_OPTION_UBER
+#define FSR2_BIND_SRV_DILATED_MOTION_VECTORS                 2
+#define FSR2_BIND_SRV_INPUT_MOTION_VECTORS                   15
+#elif FFX_FSR2_OPTION_LOW_RESOLUTION_MOTION_VECTORS
 #define FSR2_BIND_SRV_DILATED_MOTION_VECTORS                 2
 #else
 #define FSR2_BIND_SRV_INPUT_MOTION_VECTORS                   2
@@ -34,12 +37,19 @@
 #define FSR2_BIND_SRV_SCENE_LUMINANCE_MIPS                   8
 #define FSR2_BIND_SRV_AUTO_EXPOSURE                          9
 #define FSR2_BIND_SRV_LUMA_HISTORY                           10
+#define FSR2_BIND_SRV_HISTORY_INVALIDATION_MASK              11
+#define FSR2_BIND_SRV_INPUT_DEPTH                            12
+#define FSR2_BIND_SRV_INPUT_COLOR                            13
+#define FSR2_BIND_SRV_INTERNAL_UPSCALED_ALPHA                14
 
 #define FSR2_BIND_UAV_INTERNAL_UPSCALED                      0
 #define FSR2_BIND_UAV_LOCK_STATUS                            1
 #define FSR2_BIND_UAV_UPSCALED_OUTPUT                        2
 #define FSR2_BIND_UAV_NEW_LOCKS                              3
 #define FSR2_BIND_UAV_LUMA_HISTORY                           4
+#define FSR2_BIND_UAV_UPSCALED_DEPTH_OUTPUT                  5
+#define FSR2_BIND_UAV_UPSCALED_MOTION_VECTOR_OUTPUT          6
+#define FSR2_BIND_UAV_INTERNAL_UPSCALED_ALPHA                7
 
 #define FSR2_BIND_CB_FSR2                                    0
 
@@ -52,6 +52,13 @@
 		FfxFloat32    fDeltaTime;
 		FfxFloat32    fDynamicResChangeFactor;
 		FfxFloat32    fViewSpaceToMetersFactor;
+		FfxUInt32     uHistoryInvalidationRectCount;
+		FfxUInt32x4   uHistoryInvalidationRects[2];
+		FfxUInt32     uDebugView;
+		FfxFloat32    fOutputScale;
+		FfxFloat32x2  fLensDistortionCenter;
+		FfxFloat32x2  fLensDistortionCoefficients;
+		FfxUInt32     uPermutationOptions;
 	} cbFSR2;
 #endif
 
@@ -150,6 +157,41 @@ FfxFloat32 ViewSpaceToMetersFactor()
 	return cbFSR2.fViewSpaceToMetersFactor;
 }
 
+FfxUInt32 HistoryInvalidationRectCount()
+{
+	return cbFSR2.uHistoryInvalidationRectCount;
+}
+
+FfxUInt32x4 HistoryInvalidationRects(FfxUInt32 uIndex)
+{
+	return cbFSR2.uHistoryInvalidationRects[uIndex];
+}
+
+FfxUInt32 DebugView()
+{
+	return cbFSR2.uDebugView;
+}
+
+FfxFloat32 OutputScale()
+{
+	return cbFSR2.fOutputScale;
+}
+
+FfxFloat32x2 LensDistortionCenter()
+{
+	return cbFSR2.fLensDistortionCenter;
+}
+
+FfxFloat32x2 LensDistortionCoefficients()
+{
+	return cbFSR2.fLensDistortionCoefficients;
+}
+
+FfxUInt32 PermutationOptions()
+{
+	return cbFSR2.uPermutationOptions;
+}
+
 //layout (binding = 0) uniform sampler s_PointClamp;
 //layout (binding = 1) uniform sampler s_LinearClamp;
 
@@ -178,6 +220,9 @@ FfxFloat32 ViewSpaceToMetersFactor()
 #if defined(FSR2_BIND_SRV_TRANSPARENCY_AND_COMPOSITION_MASK)
 	uniform sampler2D r_transparency_and_composition_mask;
 #endif
+#if defined(FSR2_BIND_SRV_HISTORY_INVALIDATION_MASK)
+	uniform sampler2D r_history_invalidation_mask;
+#endif
 #if defined(FSR2_BIND_SRV_RECONSTRUCTED_PREV_NEAREST_DEPTH)
 	uniform usampler2D r_reconstructed_previous_nearest_depth;
 #endif
@@ -211,6 +256,21 @@ FfxFloat32 ViewSpaceToMetersFactor()
 #if defined(FSR2_BIND_SRV_RCAS_INPUT)
 	uniform sampler2D r_rcas_input;
 #endif
+#if defined(FSR2_BIND_SRV_INTERNAL_UPSCALED_ALPHA)
+	uniform sampler2D r_internal_upscaled_alpha;
+#endif
+#if defined(FSR2_BIND_SRV_RCAS_INPUT_ALPHA)
+	uniform sampler2D r_rcas_input_alpha;
+#endif
+#if defined(FSR2_BIND_SRV_SHARPNESS_MAP)
+	uniform sampler2D r_sharpness_map;
+#endif
+#if defined(FSR2_BIND_SRV_MATERIAL_ID)
+	uniform usampler2D r_material_id;
+#endif
+#if defined(FSR2_BIND_SRV_MATERIAL_REACTIVITY_TABLE)
+	uniform sampler2D r_material_reactivity_table;
+#endif
 #if defined(FSR2_BIND_SRV_LANCZOS_LUT)
 	uniform sampler2D r_lanczos_lut;
 #endif
@@ -241,8 +301,14 @@ FfxFloat32 ViewSpaceToMetersFactor()
 	layout (r16f)          writeonly uniform image2D rw_dilatedDepth;
 #endif
 #if defined FSR2_BIND_UAV_INTERNAL_UPSCALED
+#if FFX_FSR2_OPTION_UBER
+	                       writeonly uniform image2D rw_internal_upscaled_color; // packed lock status selects the format
+#elif FFX_FSR2_OPTION_PACKED_LOCK_STATUS
+	layout (rgba16)        writeonly uniform image2D rw_internal_upscaled_color;
+#else
 	layout (rgba16f)       writeonly uniform image2D rw_internal_upscaled_color;
 #endif
+#endif
 #if defined FSR2_BIND_UAV_LOCK_STATUS
 	layout (rg16f)         uniform image2D rw_lock_status;
 #endif
@@ -261,6 +327,15 @@ FfxFloat32 ViewSpaceToMetersFactor()
 #if defined FSR2_BIND_UAV_UPSCALED_OUTPUT
                            writeonly uniform image2D rw_upscaled_output;
 #endif
+#if defined FSR2_BIND_UAV_UPSCALED_DEPTH_OUTPUT
+	layout (r32f)          writeonly uniform image2D rw_upscaled_depth_output;
+#endif
+#if defined FSR2_BIND_UAV_UPSCALED_MOTION_VECTOR_OUTPUT
+	layout (rg16f)         writeonly uniform image2D rw_upscaled_motion_vector_output;
+#endif
+#if defined FSR2_BIND_UAV_INTERNAL_UPSCALED_ALPHA
+	layout (r16f)          writeonly uniform image2D rw_internal_upscaled_alpha;
+#endif
 #if defined FSR2_BIND_UAV_EXPOSURE_MIP_LUMA_CHANGE
 	layout (r16f)          coherent uniform image2D rw_img_mip_shading_change;
 #endif
@@ -279,6 +354,9 @@ FfxFloat32 ViewSpaceToMetersFactor()
 #if defined FSR2_BIND_UAV_SPD_GLOBAL_ATOMIC 
 	layout (r32ui)         coherent uniform uimage2D rw_spd_global_atomic;
 #endif
+#if defined FSR2_BIND_UAV_EXPOSURE_HISTOGRAM
+	layout (r32ui)         coherent uniform uimage2D rw_exposure_histogram;
+#endif
 
 #if defined FSR2_BIND_UAV_AUTOREACTIVE
 	layout(r32f)           uniform image2D rw_output_autoreactive;
@@ -287,11 +365,19 @@ FfxFloat32 ViewSpaceToMetersFactor()
 	layout(r32f)           uniform image2D rw_output_autocomposition;
 #endif
 #if defined FSR2_BIND_UAV_PREV_PRE_ALPHA_COLOR
+#if FFX_FSR2_OPTION_COMPACT_TCR_HISTORY
+	layout(r16f)           uniform image2D rw_output_prev_color_pre_alpha;
+#else
 	layout(r11f_g11f_b10f) uniform image2D rw_output_prev_color_pre_alpha;
 #endif
+#endif
 #if defined FSR2_BIND_UAV_PREV_POST_ALPHA_COLOR
+#if FFX_FSR2_OPTION_COMPACT_TCR_HISTORY
+	layout(r16f)           uniform image2D rw_output_prev_color_post_alpha;
+#else
 	layout(r11f_g11f_b10f) uniform image2D rw_output_prev_color_post_alpha;
 #endif
+#endif
 
 #if defined(FSR2_BIND_SRV_SCENE_LUMINANCE_MIPS)
 FfxFloat32 LoadMipLuma(FfxInt32x2 iPxPos, FfxInt32 mipLevel)
@@ -329,6 +415,35 @@ FfxFloat32 LoadTransparencyAndCompositionMask(FfxUInt32x2 iPxPos)
 }
 #endif
 
+#if defined(FSR2_BIND_SRV_HISTORY_INVALIDATION_MASK)
+FfxFloat32 SampleHistoryInvalidationMask(FfxFloat32x2 fUV)
+{
+	// s_PointClamp
+	return texelFetch(r_history_invalidation_mask, FfxInt32x2(fUV * textureSize(r_history_invalidation_mask, 0)), 0).r;
+}
+#endif
+
+#if defined(FSR2_BIND_SRV_SHARPNESS_MAP)
+FfxFloat32 SampleSharpnessMap(FfxFloat32x2 fUV)
+{
+	return textureLod(r_sharpness_map, fUV, 0.0f).r;
+}
+#endif
+
+#if defined(FSR2_BIND_SRV_MATERIAL_ID)
+FfxUInt32 LoadMaterialId(FfxUInt32x2 iPxPos)
+{
+	return texelFetch(r_material_id, FfxInt32x2(iPxPos), 0).r;
+}
+#endif
+
+#if defined(FSR2_BIND_SRV_MATERIAL_REACTIVITY_TABLE)
+FfxFloat32x2 LoadMaterialReactivity(FfxUInt32 uMaterialId)
+{
+	return texelFetch(r_material_reactivity_table, FfxInt32x2(uMaterialId, 0), 0).rg;
+}
+#endif
+
 #if defined(FSR2_BIND_SRV_INPUT_COLOR)
 FfxFloat32x3 LoadInputColor(FfxInt32x2 iPxPos)
 {
@@ -336,6 +451,13 @@ FfxFloat32x3 LoadInputColor(FfxInt32x2 iPxPos)
 }
 #endif
 
+#if defined(FSR2_BIND_SRV_INPUT_COLOR)
+FfxFloat32 LoadInputAlpha(FfxInt32x2 iPxPos)
+{
+	return texelFetch(r_input_color_jittered, iPxPos, 0).a;
+}
+#endif
+
 #if defined(FSR2_BIND_SRV_INPUT_COLOR)
 FfxFloat32x3 SampleInputColor(FfxFloat32x2 fUV)
 {
@@ -358,9 +480,9 @@ FfxFloat32x2 LoadInputMotionVector(FfxInt32x2 iPxDilatedMotionVectorPos)
 
 	FfxFloat32x2 fUvMotionVector = fSrcMotionVector * MotionVectorScale();
 
-#if FFX_FSR2_OPTION_JITTERED_MOTION_VECTORS
-	fUvMotionVector -= MotionVectorJitterCancellation();
-#endif
+	if (FFX_FSR2_JITTERED_MOTION_VECTORS) {
+		fUvMotionVector -= MotionVectorJitterCancellation();
+	}
 
 	return fUvMotionVector;
 }
@@ -371,6 +493,12 @@ FfxFloat32x4 LoadHistory(FfxInt32x2 iPxHistory)
 {
 	return texelFetch(r_internal_upscaled_color, iPxHistory, 0);
 }
+
+FfxFloat32x4 SampleHistory(FfxFloat32x2 fUV)
+{
+	// s_LinearClamp
+	return textureLod(r_internal_upscaled_color, fUV, 0.0f);
+}
 #endif
 
 #if defined(FSR2_BIND_UAV_LUMA_HISTORY)
@@ -409,6 +537,42 @@ void StoreUpscaledOutput(FfxInt32x2 iPxPos, FfxFloat32x3 fColor)
 }
 #endif
 
+#if defined(FSR2_BIND_UAV_UPSCALED_OUTPUT)
+void StoreUpscaledOutputWithAlpha(FfxInt32x2 iPxPos, FfxFloat32x3 fColor, FfxFloat32 fAlpha)
+{
+    imageStore(rw_upscaled_output, FfxInt32x2(iPxPos), FfxFloat32x4(fColor, fAlpha));
+}
+#endif
+
+#if defined(FSR2_BIND_SRV_INTERNAL_UPSCALED_ALPHA)
+FfxFloat32 SampleUpscaledAlphaHistory(FfxFloat32x2 fUV)
+{
+	// s_LinearClamp
+	return textureLod(r_internal_upscaled_alpha, fUV, 0.0f).r;
+}
+#endif
+
+#if defined(FSR2_BIND_UAV_INTERNAL_UPSCALED_ALPHA)
+void StoreInternalAlpha(FfxInt32x2 iPxPos, FfxFloat32 fAlpha)
+{
+	imageStore(rw_internal_upscaled_alpha, iPxPos, FfxFloat32x4(fAlpha, 0.0f, 0.0f, 0.0f));
+}
+#endif
+
+#if defined(FSR2_BIND_UAV_UPSCALED_DEPTH_OUTPUT)
+void StoreUpscaledDepthOutput(FfxInt32x2 iPxPos, FfxFloat32 fDepth)
+{
+    imageStore(rw_upscaled_depth_output, FfxInt32x2(iPxPos), FfxFloat32x4(fDepth, 0.0f, 0.0f, 0.0f));
+}
+#endif
+
+#if defined(FSR2_BIND_UAV_UPSCALED_MOTION_VECTOR_OUTPUT)
+void StoreUpscaledMotionVectorOutput(FfxInt32x2 iPxPos, FfxFloat32x2 fMotionVector)
+{
+    imageStore(rw_upscaled_motion_vector_output, FfxInt32x2(iPxPos), FfxFloat32x4(fMotionVector, 0.0f, 0.0f));
+}
+#endif
+
 #if defined(FSR2_BIND_SRV_LOCK_STATUS)
 FfxFloat32x2 LoadLockStatus(FfxInt32x2 iPxPos)
 {
@@ -503,11 +667,11 @@ void StoreReconstructedDepth(FfxInt32x2 iPxSample, FfxFloat32 fDepth)
 {
 	FfxUInt32 uDepth = floatBitsToUint(fDepth);
 
-	#if FFX_FSR2_OPTION_INVERTED_DEPTH
+	if (FFX_FSR2_INVERTED_DEPTH) {
 		imageAtomicMax(rw_reconstructed_previous_nearest_depth, iPxSample, uDepth);
-	#else
+	} else {
 		imageAtomicMin(rw_reconstructed_previous_nearest_depth, iPxSample, uDepth); // min for standard, max for inverted depth
-	#endif
+	}
 }
 #endif
 
@@ -651,18 +815,32 @@ FfxFloat32x3 LoadOpaqueOnly(FFX_PARAMETER_IN FFX_MIN16_I2 iPxPos)
 #endif
 
 #if defined(FSR2_BIND_SRV_PREV_PRE_ALPHA_COLOR)
+#if FFX_FSR2_OPTION_COMPACT_TCR_HISTORY
+FfxFloat32 LoadPrevPreAlphaLuma(FFX_PARAMETER_IN FFX_MIN16_I2 iPxPos)
+{
+	return texelFetch(r_input_prev_color_pre_alpha, iPxPos, 0).x;
+}
+#else
 FfxFloat32x3 LoadPrevPreAlpha(FFX_PARAMETER_IN FFX_MIN16_I2 iPxPos)
 {
 	return texelFetch(r_input_prev_color_pre_alpha, iPxPos, 0).xyz;
 }
 #endif
+#endif
 
 #if defined(FSR2_BIND_SRV_PREV_POST_ALPHA_COLOR)
+#if FFX_FSR2_OPTION_COMPACT_TCR_HISTORY
+FfxFloat32 LoadPrevPostAlphaLuma(FFX_PARAMETER_IN FFX_MIN16_I2 iPxPos)
+{
+	return texelFetch(r_input_prev_color_post_alpha, iPxPos, 0).x;
+}
+#else
 FfxFloat32x3 LoadPrevPostAlpha(FFX_PARAMETER_IN FFX_MIN16_I2 iPxPos)
 {
 	return texelFetch(r_input_prev_color_post_alpha, iPxPos, 0).xyz;
 }
 #endif
+#endif
 
 #if defined(FSR2_BIND_UAV_AUTOREACTIVE)
 #if defined(FSR2_BIND_UAV_AUTOCOMPOSITION)
@@ -676,17 +854,31 @@ void StoreAutoReactive(FFX_PARAMETER_IN FFX_MIN16_I2 iPxPos, FFX_PARAMETER_IN FF
 #endif
 
 #if defined(FSR2_BIND_UAV_PREV_PRE_ALPHA_COLOR)
+#if FFX_FSR2_OPTION_COMPACT_TCR_HISTORY
+void StorePrevPreAlphaLuma(FFX_PARAMETER_IN FFX_MIN16_I2 iPxPos, FFX_PARAMETER_IN FfxFloat32 fLuma)
+{
+	imageStore(rw_output_prev_color_pre_alpha, iPxPos, vec4(fLuma, 0.0f, 0.0f, 0.0f));
+}
+#else
 void StorePrevPreAlpha(FFX_PARAMETER_IN FFX_MIN16_I2 iPxPos, FFX_PARAMETER_IN FFX_MIN16_F3 color)
 {
 	imageStore(rw_output_prev_color_pre_alpha, iPxPos, vec4(color, 0.0f));
 }
 #endif
+#endif
 
 #if defined(FSR2_BIND_UAV_PREV_POST_ALPHA_COLOR)
+#if FFX_FSR2_OPTION_COMPACT_TCR_HISTORY
+void StorePrevPostAlphaLuma(FFX_PARAMETER_IN FFX_MIN16_I2 iPxPos, FFX_PARAMETER_IN FfxFloat32 fLuma)
+{
+	imageStore(rw_output_prev_color_post_alpha, iPxPos, vec4(fLuma, 0.0f, 0.0f, 0.0f));
+}
+#else
 void StorePrevPostAlpha(FFX_PARAMETER_IN FFX_MIN16_I2 iPxPos, FFX_PARAMETER_IN FFX_MIN16_F3 color)
 {
 	imageStore(rw_output_prev_color_post_alpha, iPxPos, vec4(color, 0.0f));
 }
 #endif
+#endif
 
 #endif // #if defined(FFX_GPU)
@@ -71,6 +71,13 @@
         FfxFloat32    fDeltaTime;
         FfxFloat32    fDynamicResChangeFactor;
         FfxFloat32    fViewSpaceToMetersFactor;
+        FfxUInt32     uHistoryInvalidationRectCount;
+        FfxUInt32x4   uHistoryInvalidationRects[2];
+        FfxUInt32     uDebugView;
+        FfxFloat32    fOutputScale;
+        FfxFloat32x2  fLensDistortionCenter;
+        FfxFloat32x2  fLensDistortionCoefficients;
+        FfxUInt32     uPermutationOptions;
     };
 
 #define FFX_FSR2_CONSTANT_BUFFER_1_SIZE (sizeof(cbFSR2) / 4)  // Number of 32-bit values. This must be kept in sync with the cbFSR2 size.
@@ -95,7 +102,7 @@
                                                       "comparisonFunc = COMPARISON_NEVER, " \
                                                       "borderColor = STATIC_BORDER_COLOR_TRANSPARENT_BLACK)" )]
 
-#define FFX_FSR2_CONSTANT_BUFFER_2_SIZE 6  // Number of 32-bit values. This must be kept in sync with max( cbRCAS , cbSPD) size.
+#define FFX_FSR2_CONSTANT_BUFFER_2_SIZE 11 // Number of 32-bit values. This must be kept in sync with max( cbRCAS , cbSPD) size.
 
 #define FFX_FSR2_CB2_ROOTSIG [RootSignature( "DescriptorTable(UAV(u0, numDescriptors = " FFX_FSR2_ROOTSIG_STRINGIFY(FFX_FSR2_RESOURCE_IDENTIFIER_COUNT) ")), " \
                                     "DescriptorTable(SRV(t0, numDescriptors = " FFX_FSR2_ROOTSIG_STRINGIFY(FFX_FSR2_RESOURCE_IDENTIFIER_COUNT) ")), " \
@@ -218,6 +225,41 @@ FfxFloat32 ViewSpaceToMetersFactor()
     return fViewSpaceToMetersFactor;
 }
 
+FfxUInt32 HistoryInvalidationRectCount()
+{
+    return uHistoryInvalidationRectCount;
+}
+
+FfxUInt32x4 HistoryInvalidationRects(FfxUInt32 uIndex)
+{
+    return uHistoryInvalidationRects[uIndex];
+}
+
+FfxUInt32 DebugView()
+{
+    return uDebugView;
+}
+
+FfxFloat32 OutputScale()
+{
+    return fOutputScale;
+}
+
+FfxFloat32x2 LensDistortionCenter()
+{
+    return fLensDistortionCenter;
+}
+
+FfxFloat32x2 LensDistortionCoefficients()
+{
+    return fLensDistortionCoefficients;
+}
+
+FfxUInt32 PermutationOptions()
+{
+    return uPermutationOptions;
+}
+
 
 SamplerState s_PointClamp : register(s0);
 SamplerState s_LinearClamp : register(s1);
@@ -232,6 +274,7 @@ SamplerState s_LinearClamp : register(s1);
     Texture2D<FfxFloat32x2>                       r_auto_exposure                           : FFX_FSR2_DECLARE_SRV(FFX_FSR2_RESOURCE_IDENTIFIER_AUTO_EXPOSURE);
     Texture2D<FfxFloat32>                         r_reactive_mask                           : FFX_FSR2_DECLARE_SRV(FFX_FSR2_RESOURCE_IDENTIFIER_INPUT_REACTIVE_MASK);
     Texture2D<FfxFloat32>                         r_transparency_and_composition_mask       : FFX_FSR2_DECLARE_SRV(FFX_FSR2_RESOURCE_IDENTIFIER_INPUT_TRANSPARENCY_AND_COMPOSITION_MASK);
+    Texture2D<FfxFloat32>                         r_history_invalidation_mask               : FFX_FSR2_DECLARE_SRV(FFX_FSR2_RESOURCE_IDENTIFIER_INPUT_HISTORY_INVALIDATION_MASK);
     Texture2D<FfxUInt32>                          r_reconstructed_previous_nearest_depth    : FFX_FSR2_DECLARE_SRV(FFX_FSR2_RESOURCE_IDENTIFIER_RECONSTRUCTED_PREVIOUS_NEAREST_DEPTH);
     Texture2D<FfxFloat32x2>                       r_dilated_motion_vectors                  : FFX_FSR2_DECLARE_SRV(FFX_FSR2_RESOURCE_IDENTIFIER_DILATED_MOTION_VECTORS);
     Texture2D<FfxFloat32x2>                       r_previous_dilated_motion_vectors         : FFX_FSR2_DECLARE_SRV(FFX_FSR2_RESOURCE_IDENTIFIER_PREVIOUS_DILATED_MOTION_VECTORS);
@@ -243,12 +286,22 @@ SamplerState s_LinearClamp : register(s1);
     Texture2D<FfxFloat32x4>                       r_prepared_input_color                    : FFX_FSR2_DECLARE_SRV(FFX_FSR2_RESOURCE_IDENTIFIER_PREPARED_INPUT_COLOR);
     Texture2D<FfxFloat32x4>                       r_luma_history                            : FFX_FSR2_DECLARE_SRV(FFX_FSR2_RESOURCE_IDENTIFIER_LUMA_HISTORY);
     Texture2D<FfxFloat32x4>                       r_rcas_input                              : FFX_FSR2_DECLARE_SRV(FFX_FSR2_RESOURCE_IDENTIFIER_RCAS_INPUT);
+    Texture2D<FfxFloat32>                         r_internal_upscaled_alpha                 : FFX_FSR2_DECLARE_SRV(FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_UPSCALED_ALPHA);
+    Texture2D<FfxFloat32>                         r_rcas_input_alpha                        : FFX_FSR2_DECLARE_SRV(FFX_FSR2_RESOURCE_IDENTIFIER_RCAS_INPUT_ALPHA);
+    Texture2D<FfxFloat32>                         r_sharpness_map                           : FFX_FSR2_DECLARE_SRV(FFX_FSR2_RESOURCE_IDENTIFIER_INPUT_SHARPNESS_MAP);
+    Texture2D<FfxUInt32>                          r_material_id                             : FFX_FSR2_DECLARE_SRV(FFX_FSR2_RESOURCE_IDENTIFIER_INPUT_MATERIAL_ID);
+    Texture2D<unorm FfxFloat32x2>                 r_material_reactivity_table               : FFX_FSR2_DECLARE_SRV(FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_MATERIAL_REACTIVITY_TABLE);
     Texture2D<FfxFloat32>                         r_lanczos_lut                             : FFX_FSR2_DECLARE_SRV(FFX_FSR2_RESOURCE_IDENTIFIER_LANCZOS_LUT);
     Texture2D<FfxFloat32>                         r_imgMips                                 : FFX_FSR2_DECLARE_SRV(FFX_FSR2_RESOURCE_IDENTIFIER_SCENE_LUMINANCE);
     Texture2D<FfxFloat32>                         r_upsample_maximum_bias_lut               : FFX_FSR2_DECLARE_SRV(FFX_FSR2_RESOURCE_IDENTITIER_UPSAMPLE_MAXIMUM_BIAS_LUT);
     Texture2D<unorm FfxFloat32x2>                 r_dilated_reactive_masks                  : FFX_FSR2_DECLARE_SRV(FFX_FSR2_RESOURCE_IDENTIFIER_DILATED_REACTIVE_MASKS);
+#if FFX_FSR2_OPTION_COMPACT_TCR_HISTORY
+    Texture2D<float>                              r_input_prev_color_pre_alpha              : FFX_FSR2_DECLARE_SRV(FFX_FSR2_RESOURCE_IDENTIFIER_PREV_PRE_ALPHA_COLOR);
+    Texture2D<float>                              r_input_prev_color_post_alpha             : FFX_FSR2_DECLARE_SRV(FFX_FSR2_RESOURCE_IDENTIFIER_PREV_POST_ALPHA_COLOR);
+#else
     Texture2D<float3>                             r_input_prev_color_pre_alpha              : FFX_FSR2_DECLARE_SRV(FFX_FSR2_RESOURCE_IDENTIFIER_PREV_PRE_ALPHA_COLOR);
     Texture2D<float3>                             r_input_prev_color_post_alpha             : FFX_FSR2_DECLARE_SRV(FFX_FSR2_RESOURCE_IDENTIFIER_PREV_POST_ALPHA_COLOR);
+#endif
 
     Texture2D<FfxFloat32x4>                       r_debug_out                               : FFX_FSR2_DECLARE_SRV(FFX_FSR2_RESOURCE_IDENTIFIER_DEBUG_OUTPUT);
 
@@ -263,18 +316,27 @@ SamplerState s_LinearClamp : register(s1);
     RWTexture2D<FfxFloat32x4>                     rw_prepared_input_color                   : FFX_FSR2_DECLARE_UAV(FFX_FSR2_RESOURCE_IDENTIFIER_PREPARED_INPUT_COLOR);
     RWTexture2D<FfxFloat32x4>                     rw_luma_history                           : FFX_FSR2_DECLARE_UAV(FFX_FSR2_RESOURCE_IDENTIFIER_LUMA_HISTORY);
     RWTexture2D<FfxFloat32x4>                     rw_upscaled_output                        : FFX_FSR2_DECLARE_UAV(FFX_FSR2_RESOURCE_IDENTIFIER_UPSCALED_OUTPUT);
+    RWTexture2D<FfxFloat32>                       rw_upscaled_depth_output                  : FFX_FSR2_DECLARE_UAV(FFX_FSR2_RESOURCE_IDENTIFIER_UPSCALED_DEPTH_OUTPUT);
+    RWTexture2D<FfxFloat32x2>                     rw_upscaled_motion_vector_output          : FFX_FSR2_DECLARE_UAV(FFX_FSR2_RESOURCE_IDENTIFIER_UPSCALED_MOTION_VECTOR_OUTPUT);
+    RWTexture2D<FfxFloat32>                       rw_internal_upscaled_alpha                : FFX_FSR2_DECLARE_UAV(FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_UPSCALED_ALPHA);
 
     globallycoherent RWTexture2D<FfxFloat32>      rw_img_mip_shading_change                 : FFX_FSR2_DECLARE_UAV(FFX_FSR2_RESOURCE_IDENTIFIER_SCENE_LUMINANCE_MIPMAP_SHADING_CHANGE);
     globallycoherent RWTexture2D<FfxFloat32>      rw_img_mip_5                              : FFX_FSR2_DECLARE_UAV(FFX_FSR2_RESOURCE_IDENTIFIER_SCENE_LUMINANCE_MIPMAP_5);
     RWTexture2D<unorm FfxFloat32x2>               rw_dilated_reactive_masks                 : FFX_FSR2_DECLARE_UAV(FFX_FSR2_RESOURCE_IDENTIFIER_DILATED_REACTIVE_MASKS);
     RWTexture2D<FfxFloat32x2>                     rw_auto_exposure                          : FFX_FSR2_DECLARE_UAV(FFX_FSR2_RESOURCE_IDENTIFIER_AUTO_EXPOSURE);
     globallycoherent RWTexture2D<FfxUInt32>       rw_spd_global_atomic                      : FFX_FSR2_DECLARE_UAV(FFX_FSR2_RESOURCE_IDENTIFIER_SPD_ATOMIC_COUNT);
+    globallycoherent RWTexture2D<FfxUInt32>       rw_exposure_histogram                     : FFX_FSR2_DECLARE_UAV(FFX_FSR2_RESOURCE_IDENTIFIER_EXPOSURE_HISTOGRAM);
     RWTexture2D<FfxFloat32x4>                     rw_debug_out                              : FFX_FSR2_DECLARE_UAV(FFX_FSR2_RESOURCE_IDENTIFIER_DEBUG_OUTPUT);
     
     RWTexture2D<float>                            rw_output_autoreactive                    : FFX_FSR2_DECLARE_UAV(FFX_FSR2_RESOURCE_IDENTIFIER_AUTOREACTIVE);
     RWTexture2D<float>                            rw_output_autocomposition                 : FFX_FSR2_DECLARE_UAV(FFX_FSR2_RESOURCE_IDENTIFIER_AUTOCOMPOSITION);
+#if FFX_FSR2_OPTION_COMPACT_TCR_HISTORY
+    RWTexture2D<float>                            rw_output_prev_color_pre_alpha            : FFX_FSR2_DECLARE_UAV(FFX_FSR2_RESOURCE_IDENTIFIER_PREV_PRE_ALPHA_COLOR);
+    RWTexture2D<float>                            rw_output_prev_color_post_alpha           : FFX_FSR2_DECLARE_UAV(FFX_FSR2_RESOURCE_IDENTIFIER_PREV_POST_ALPHA_COLOR);
+#else
     RWTexture2D<float3>                           rw_output_prev_color_pre_alpha            : FFX_FSR2_DECLARE_UAV(FFX_FSR2_RESOURCE_IDENTIFIER_PREV_PRE_ALPHA_COLOR);
     RWTexture2D<float3>                           rw_output_prev_color_post_alpha           : FFX_FSR2_DECLARE_UAV(FFX_FSR2_RESOURCE_IDENTIFIER_PREV_POST_ALPHA_COLOR);  
+#endif
 
 #else // #if defined(FFX_INTERNAL)
     #if defined FSR2_BIND_SRV_INPUT_COLOR
@@ -301,6 +363,9 @@ SamplerState s_LinearClamp : register(s1);
     #if defined FSR2_BIND_SRV_TRANSPARENCY_AND_COMPOSITION_MASK
         Texture2D<FfxFloat32>                     r_transparency_and_composition_mask       : FFX_FSR2_DECLARE_SRV(FSR2_BIND_SRV_TRANSPARENCY_AND_COMPOSITION_MASK);
     #endif
+    #if defined FSR2_BIND_SRV_HISTORY_INVALIDATION_MASK
+        Texture2D<FfxFloat32>                     r_history_invalidation_mask               : FFX_FSR2_DECLARE_SRV(FSR2_BIND_SRV_HISTORY_INVALIDATION_MASK);
+    #endif
     #if defined FSR2_BIND_SRV_RECONSTRUCTED_PREV_NEAREST_DEPTH
         Texture2D<FfxUInt32>                      r_reconstructed_previous_nearest_depth    : FFX_FSR2_DECLARE_SRV(FSR2_BIND_SRV_RECONSTRUCTED_PREV_NEAREST_DEPTH);
     #endif 
@@ -334,6 +399,21 @@ SamplerState s_LinearClamp : register(s1);
     #if defined FSR2_BIND_SRV_RCAS_INPUT
         Texture2D<FfxFloat32x4>                   r_rcas_input                              : FFX_FSR2_DECLARE_SRV(FSR2_BIND_SRV_RCAS_INPUT);
     #endif
+    #if defined FSR2_BIND_SRV_INTERNAL_UPSCALED_ALPHA
+        Texture2D<FfxFloat32>                     r_internal_upscaled_alpha                 : FFX_FSR2_DECLARE_SRV(FSR2_BIND_SRV_INTERNAL_UPSCALED_ALPHA);
+    #endif
+    #if defined FSR2_BIND_SRV_RCAS_INPUT_ALPHA
+        Texture2D<FfxFloat32>                     r_rcas_input_alpha                        : FFX_FSR2_DECLARE_SRV(FSR2_BIND_SRV_RCAS_INPUT_ALPHA);
+    #endif
+    #if defined FSR2_BIND_SRV_SHARPNESS_MAP
+        Texture2D<FfxFloat32>                     r_sharpness_map                           : FFX_FSR2_DECLARE_SRV(FSR2_BIND_SRV_SHARPNESS_MAP);
+    #endif
+    #if defined FSR2_BIND_SRV_MATERIAL_ID
+        Texture2D<FfxUInt32>                      r_material_id                             : FFX_FSR2_DECLARE_SRV(FSR2_BIND_SRV_MATERIAL_ID);
+    #endif
+    #if defined FSR2_BIND_SRV_MATERIAL_REACTIVITY_TABLE
+        Texture2D<unorm FfxFloat32x2>             r_material_reactivity_table               : FFX_FSR2_DECLARE_SRV(FSR2_BIND_SRV_MATERIAL_REACTIVITY_TABLE);
+    #endif
     #if defined FSR2_BIND_SRV_LANCZOS_LUT
         Texture2D<FfxFloat32>                     r_lanczos_lut                             : FFX_FSR2_DECLARE_SRV(FSR2_BIND_SRV_LANCZOS_LUT);
     #endif
@@ -348,11 +428,19 @@ SamplerState s_LinearClamp : register(s1);
     #endif
 
     #if defined FSR2_BIND_SRV_PREV_PRE_ALPHA_COLOR
+    #if FFX_FSR2_OPTION_COMPACT_TCR_HISTORY
+        Texture2D<float>                          r_input_prev_color_pre_alpha              : FFX_FSR2_DECLARE_SRV(FFX_FSR2_RESOURCE_IDENTIFIER_PREV_PRE_ALPHA_COLOR);
+    #else
         Texture2D<float3>                         r_input_prev_color_pre_alpha              : FFX_FSR2_DECLARE_SRV(FFX_FSR2_RESOURCE_IDENTIFIER_PREV_PRE_ALPHA_COLOR);
     #endif
+    #endif
     #if defined FSR2_BIND_SRV_PREV_POST_ALPHA_COLOR
+    #if FFX_FSR2_OPTION_COMPACT_TCR_HISTORY
+        Texture2D<float>                          r_input_prev_color_post_alpha             : FFX_FSR2_DECLARE_SRV(FFX_FSR2_RESOURCE_IDENTIFIER_PREV_POST_ALPHA_COLOR);
+    #else
         Texture2D<float3>                         r_input_prev_color_post_alpha             : FFX_FSR2_DECLARE_SRV(FFX_FSR2_RESOURCE_IDENTIFIER_PREV_POST_ALPHA_COLOR);
     #endif
+    #endif
    
     // UAV declarations
     #if defined FSR2_BIND_UAV_RECONSTRUCTED_PREV_NEAREST_DEPTH
@@ -385,6 +473,15 @@ SamplerState s_LinearClamp : register(s1);
     #if defined FSR2_BIND_UAV_UPSCALED_OUTPUT
         RWTexture2D<FfxFloat32x4>                 rw_upscaled_output                        : FFX_FSR2_DECLARE_UAV(FSR2_BIND_UAV_UPSCALED_OUTPUT);
     #endif
+    #if defined FSR2_BIND_UAV_UPSCALED_DEPTH_OUTPUT
+        RWTexture2D<FfxFloat32>                   rw_upscaled_depth_output                  : FFX_FSR2_DECLARE_UAV(FSR2_BIND_UAV_UPSCALED_DEPTH_OUTPUT);
+    #endif
+    #if defined FSR2_BIND_UAV_UPSCALED_MOTION_VECTOR_OUTPUT
+        RWTexture2D<FfxFloat32x2>                 rw_upscaled_motion_vector_output          : FFX_FSR2_DECLARE_UAV(FSR2_BIND_UAV_UPSCALED_MOTION_VECTOR_OUTPUT);
+    #endif
+    #if defined FSR2_BIND_UAV_INTERNAL_UPSCALED_ALPHA
+        RWTexture2D<FfxFloat32>                   rw_internal_upscaled_alpha                : FFX_FSR2_DECLARE_UAV(FSR2_BIND_UAV_INTERNAL_UPSCALED_ALPHA);
+    #endif
     #if defined FSR2_BIND_UAV_EXPOSURE_MIP_LUMA_CHANGE
         globallycoherent RWTexture2D<FfxFloat32>  rw_img_mip_shading_change                 : FFX_FSR2_DECLARE_UAV(FSR2_BIND_UAV_EXPOSURE_MIP_LUMA_CHANGE);
     #endif
@@ -403,6 +500,9 @@ SamplerState s_LinearClamp : register(s1);
     #if defined FSR2_BIND_UAV_SPD_GLOBAL_ATOMIC
         globallycoherent RWTexture2D<FfxUInt32>   rw_spd_global_atomic                      : FFX_FSR2_DECLARE_UAV(FSR2_BIND_UAV_SPD_GLOBAL_ATOMIC);
     #endif
+    #if defined FSR2_BIND_UAV_EXPOSURE_HISTOGRAM
+        globallycoherent RWTexture2D<FfxUInt32>   rw_exposure_histogram                     : FFX_FSR2_DECLARE_UAV(FSR2_BIND_UAV_EXPOSURE_HISTOGRAM);
+    #endif
 
     #if defined FSR2_BIND_UAV_AUTOREACTIVE
         RWTexture2D<float>                        rw_output_autoreactive                    : FFX_FSR2_DECLARE_UAV(FSR2_BIND_UAV_AUTOREACTIVE);
@@ -411,11 +511,19 @@ SamplerState s_LinearClamp : register(s1);
         RWTexture2D<float>                        rw_output_autocomposition                 : FFX_FSR2_DECLARE_UAV(FSR2_BIND_UAV_AUTOCOMPOSITION);
     #endif
     #if defined FSR2_BIND_UAV_PREV_PRE_ALPHA_COLOR
+    #if FFX_FSR2_OPTION_COMPACT_TCR_HISTORY
+        RWTexture2D<float>                        rw_output_prev_color_pre_alpha            : FFX_FSR2_DECLARE_UAV(FSR2_BIND_UAV_PREV_PRE_ALPHA_COLOR);
+    #else
         RWTexture2D<float3>                       rw_output_prev_color_pre_alpha            : FFX_FSR2_DECLARE_UAV(FSR2_BIND_UAV_PREV_PRE_ALPHA_COLOR);
     #endif
+    #endif
     #if defined FSR2_BIND_UAV_PREV_POST_ALPHA_COLOR
+    #if FFX_FSR2_OPTION_COMPACT_TCR_HISTORY
+        RWTexture2D<float>                        rw_output_prev_color_post_alpha           : FFX_FSR2_DECLARE_UAV(FSR2_BIND_UAV_PREV_POST_ALPHA_COLOR);
+    #else
         RWTexture2D<float3>                       rw_output_prev_color_post_alpha           : FFX_FSR2_DECLARE_UAV(FSR2_BIND_UAV_PREV_POST_ALPHA_COLOR);
     #endif
+    #endif
 #endif // #if defined(FFX_INTERNAL)
 
 #if defined(FSR2_BIND_SRV_SCENE_LUMINANCE_MIPS) || defined(FFX_INTERNAL)
@@ -460,6 +568,34 @@ FfxFloat32 LoadTransparencyAndCompositionMask(FfxUInt32x2 iPxPos)
 }
 #endif
 
+#if defined(FSR2_BIND_SRV_HISTORY_INVALIDATION_MASK) || defined(FFX_INTERNAL)
+FfxFloat32 SampleHistoryInvalidationMask(FfxFloat32x2 fUV)
+{
+    return r_history_invalidation_mask.SampleLevel(s_PointClamp, fUV, 0);
+}
+#endif
+
+#if defined(FSR2_BIND_SRV_SHARPNESS_MAP) || defined(FFX_INTERNAL)
+FfxFloat32 SampleSharpnessMap(FfxFloat32x2 fUV)
+{
+    return r_sharpness_map.SampleLevel(s_LinearClamp, fUV, 0);
+}
+#endif
+
+#if defined(FSR2_BIND_SRV_MATERIAL_ID) || defined(FFX_INTERNAL)
+FfxUInt32 LoadMaterialId(FfxUInt32x2 iPxPos)
+{
+    return r_material_id[iPxPos];
+}
+#endif
+
+#if defined(FSR2_BIND_SRV_MATERIAL_REACTIVITY_TABLE) || defined(FFX_INTERNAL)
+FfxFloat32x2 LoadMaterialReactivity(FfxUInt32 uMaterialId)
+{
+    return r_material_reactivity_table[FfxUInt32x2(uMaterialId, 0)];
+}
+#endif
+
 #if defined(FSR2_BIND_SRV_INPUT_COLOR) || defined(FFX_INTERNAL)
 FfxFloat32x3 LoadInputColor(FfxUInt32x2 iPxPos)
 {
@@ -467,6 +603,13 @@ FfxFloat32x3 LoadInputColor(FfxUInt32x2 iPxPos)
 }
 #endif
 
+#if defined(FSR2_BIND_SRV_INPUT_COLOR) || defined(FFX_INTERNAL)
+FfxFloat32 LoadInputAlpha(FfxUInt32x2 iPxPos)
+{
+    return r_input_color_jittered[iPxPos].a;
+}
+#endif
+
 #if defined(FSR2_BIND_SRV_INPUT_COLOR) || defined(FFX_INTERNAL)
 FfxFloat32x3 SampleInputColor(FfxFloat32x2 fUV)
 {
@@ -488,9 +631,9 @@ FfxFloat32x2 LoadInputMotionVector(FfxUInt32x2 iPxDilatedMotionVectorPos)
 
     FfxFloat32x2 fUvMotionVector = fSrcMotionVector * MotionVectorScale();
 
-#if FFX_FSR2_OPTION_JITTERED_MOTION_VECTORS
-    fUvMotionVector -= MotionVectorJitterCancellation();
-#endif
+    if (FFX_FSR2_JITTERED_MOTION_VECTORS) {
+        fUvMotionVector -= MotionVectorJitterCancellation();
+    }
 
     return fUvMotionVector;
 }
@@ -501,6 +644,11 @@ FfxFloat32x4 LoadHistory(FfxUInt32x2 iPxHistory)
 {
     return r_internal_upscaled_color[iPxHistory];
 }
+
+FfxFloat32x4 SampleHistory(FfxFloat32x2 fUV)
+{
+    return r_internal_upscaled_color.SampleLevel(s_LinearClamp, fUV, 0);
+}
 #endif
 
 #if defined(FSR2_BIND_UAV_LUMA_HISTORY) || defined(FFX_INTERNAL)
@@ -545,6 +693,41 @@ void StoreUpscaledOutput(FfxUInt32x2 iPxPos, FfxFloat32x3 fColor)
 }
 #endif
 
+#if defined(FSR2_BIND_UAV_UPSCALED_OUTPUT) || defined(FFX_INTERNAL)
+void StoreUpscaledOutputWithAlpha(FfxUInt32x2 iPxPos, FfxFloat32x3 fColor, FfxFloat32 fAlpha)
+{
+    rw_upscaled_output[iPxPos] = FfxFloat32x4(fColor, fAlpha);
+}
+#endif
+
+#if defined(FSR2_BIND_SRV_INTERNAL_UPSCALED_ALPHA) || defined(FFX_INTERNAL)
+FfxFloat32 SampleUpscaledAlphaHistory(FfxFloat32x2 fUV)
+{
+    return r_internal_upscaled_alpha.SampleLevel(s_LinearClamp, fUV, 0);
+}
+#endif
+
+#if defined(FSR2_BIND_UAV_INTERNAL_UPSCALED_ALPHA) || defined(FFX_INTERNAL)
+void StoreInternalAlpha(FfxUInt32x2 iPxPos, FfxFloat32 fAlpha)
+{
+    rw_internal_upscaled_alpha[iPxPos] = fAlpha;
+}
+#endif
+
+#if defined(FSR2_BIND_UAV_UPSCALED_DEPTH_OUTPUT) || defined(FFX_INTERNAL)
+void StoreUpscaledDepthOutput(FfxUInt32x2 iPxPos, FfxFloat32 fDepth)
+{
+    rw_upscaled_depth_output[iPxPos] = fDepth;
+}
+#endif
+
+#if defined(FSR2_BIND_UAV_UPSCALED_MOTION_VECTOR_OUTPUT) || defined(FFX_INTERNAL)
+void StoreUpscaledMotionVectorOutput(FfxUInt32x2 iPxPos, FfxFloat32x2 fMotionVector)
+{
+    rw_upscaled_motion_vector_output[iPxPos] = fMotionVector;
+}
+#endif
+
 //LOCK_LIFETIME_REMAINING == 0
 //Should make LockInitialLifetime() return a const 1.0f later
 #if defined(FSR2_BIND_SRV_LOCK_STATUS) || defined(FFX_INTERNAL)
@@ -630,11 +813,11 @@ void StoreReconstructedDepth(FfxUInt32x2 iPxSample, FfxFloat32 fDepth)
 {
     FfxUInt32 uDepth = asuint(fDepth);
 
-    #if FFX_FSR2_OPTION_INVERTED_DEPTH
+    if (FFX_FSR2_INVERTED_DEPTH) {
         InterlockedMax(rw_reconstructed_previous_nearest_depth[iPxSample], uDepth);
-    #else
+    } else {
         InterlockedMin(rw_reconstructed_previous_nearest_depth[iPxSample], uDepth); // min for standard, max for inverted depth
-    #endif
+    }
 }
 #endif
 
@@ -757,18 +940,32 @@ FfxFloat32x3 LoadOpaqueOnly(FFX_PARAMETER_IN FFX_MIN16_I2 iPxPos)
 #endif
 
 #if defined(FSR2_BIND_SRV_PREV_PRE_ALPHA_COLOR) || defined(FFX_INTERNAL)
+#if FFX_FSR2_OPTION_COMPACT_TCR_HISTORY
+FfxFloat32 LoadPrevPreAlphaLuma(FFX_PARAMETER_IN FFX_MIN16_I2 iPxPos)
+{
+    return r_input_prev_color_pre_alpha[iPxPos];
+}
+#else
 FfxFloat32x3 LoadPrevPreAlpha(FFX_PARAMETER_IN FFX_MIN16_I2 iPxPos)
 {
     return r_input_prev_color_pre_alpha[iPxPos];
 }
 #endif
+#endif
 
 #if defined(FSR2_BIND_SRV_PREV_POST_ALPHA_COLOR) || defined(FFX_INTERNAL)
+#if FFX_FSR2_OPTION_COMPACT_TCR_HISTORY
+FfxFloat32 LoadPrevPostAlphaLuma(FFX_PARAMETER_IN FFX_MIN16_I2 iPxPos)
+{
+    return r_input_prev_color_post_alpha[iPxPos];
+}
+#else
 FfxFloat32x3 LoadPrevPostAlpha(FFX_PARAMETER_IN FFX_MIN16_I2 iPxPos)
 {
     return r_input_prev_color_post_alpha[iPxPos];
 }
 #endif
+#endif
 
 #if defined(FSR2_BIND_UAV_AUTOREACTIVE) || defined(FFX_INTERNAL)
 #if defined(FSR2_BIND_UAV_AUTOCOMPOSITION) || defined(FFX_INTERNAL)
@@ -782,18 +979,32 @@ void StoreAutoReactive(FFX_PARAMETER_IN FFX_MIN16_I2 iPxPos, FFX_PARAMETER_IN FF
 #endif
 
 #if defined(FSR2_BIND_UAV_PREV_PRE_ALPHA_COLOR) || defined(FFX_INTERNAL)
+#if FFX_FSR2_OPTION_COMPACT_TCR_HISTORY
+void StorePrevPreAlphaLuma(FFX_PARAMETER_IN FFX_MIN16_I2 iPxPos, FFX_PARAMETER_IN FfxFloat32 fLuma)
+{
+    rw_output_prev_color_pre_alpha[iPxPos] = fLuma;
+}
+#else
 void StorePrevPreAlpha(FFX_PARAMETER_IN FFX_MIN16_I2 iPxPos, FFX_PARAMETER_IN FFX_MIN16_F3 color)
 {
     rw_output_prev_color_pre_alpha[iPxPos] = color;
 
 }
 #endif
+#endif
 
 #if defined(FSR2_BIND_UAV_PREV_POST_ALPHA_COLOR) || defined(FFX_INTERNAL)
+#if FFX_FSR2_OPTION_COMPACT_TCR_HISTORY
+void StorePrevPostAlphaLuma(FFX_PARAMETER_IN FFX_MIN16_I2 iPxPos, FFX_PARAMETER_IN FfxFloat32 fLuma)
+{
+    rw_output_prev_color_post_alpha[iPxPos] = fLuma;
+}
+#else
 void StorePrevPostAlpha(FFX_PARAMETER_IN FFX_MIN16_I2 iPxPos, FFX_PARAMETER_IN FFX_MIN16_F3 color)
 {
     rw_output_prev_color_post_alpha[iPxPos] = color;
 }
 #endif
+#endif
 
 #endif // #if defined(FFX_GPU)
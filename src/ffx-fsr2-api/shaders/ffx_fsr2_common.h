@@ -445,6 +445,32 @@ FFX_MIN16_I2 ComputeHrPosFromLrPos(FFX_MIN16_I2 iPxLrPos)
 }
 #endif
 
+#if defined(FSR2_BIND_SRV_HISTORY_INVALIDATION_MASK)
+FfxBoolean IsHistoryInvalidated(FfxInt32x2 iPxHrPos)
+{
+    const FfxFloat32x2 fHrUv = (iPxHrPos + 0.5f) / DisplaySize();
+    if (SampleHistoryInvalidationMask(fHrUv) > 0.5f) {
+        return true;
+    }
+
+    // Rects are packed as 16bit (min, max) corners at display resolution, two rects per vector.
+    for (FfxUInt32 uRectIndex = 0; uRectIndex < HistoryInvalidationRectCount(); uRectIndex++) {
+
+        const FfxUInt32x4 uPackedRects = HistoryInvalidationRects(uRectIndex >> 1u);
+        const FfxUInt32x2 uPackedRect = ((uRectIndex & 1u) != 0u) ? uPackedRects.zw : uPackedRects.xy;
+
+        const FfxInt32x2 iRectMin = FfxInt32x2(uPackedRect.x & 0xFFFFu, uPackedRect.x >> 16u);
+        const FfxInt32x2 iRectMax = FfxInt32x2(uPackedRect.y & 0xFFFFu, uPackedRect.y >> 16u);
+
+        if (all(FFX_GREATER_THAN_EQUAL(iPxHrPos, iRectMin)) && all(FFX_LESS_THAN(iPxHrPos, iRectMax))) {
+            return true;
+        }
+    }
+
+    return false;
+}
+#endif
+
 FfxFloat32x2 ComputeNdc(FfxFloat32x2 fPxPos, FfxInt32x2 iSize)
 {
     return fPxPos / FfxFloat32x2(iSize) * FfxFloat32x2(2.0f, -2.0f) + FfxFloat32x2(-1.0f, 1.0f);
@@ -483,11 +509,7 @@ FfxFloat32x3 GetViewSpacePositionInMeters(FfxInt32x2 iViewportPos, FfxInt32x2 iV
 
 FfxFloat32 GetMaxDistanceInMeters()
 {
-#if FFX_FSR2_OPTION_INVERTED_DEPTH
-    return GetViewSpaceDepth(0.0f) * ViewSpaceToMetersFactor();
-#else
-    return GetViewSpaceDepth(1.0f) * ViewSpaceToMetersFactor();
-#endif
+    return GetViewSpaceDepth(FFX_FSR2_INVERTED_DEPTH ? 0.0f : 1.0f) * ViewSpaceToMetersFactor();
 }
 
 FfxFloat32x3 PrepareRgb(FfxFloat32x3 fRgb, FfxFloat32 fExposure, FfxFloat32 fPreExposure)
@@ -508,6 +530,39 @@ FfxFloat32x3 UnprepareRgb(FfxFloat32x3 fRgb, FfxFloat32 fExposure)
     return fRgb;
 }
 
+FfxFloat32x3 Rec709ToRec2020(FfxFloat32x3 fRgb)
+{
+    return FfxFloat32x3(
+        dot(fRgb, FfxFloat32x3(0.627404f, 0.329283f, 0.043313f)),
+        dot(fRgb, FfxFloat32x3(0.069097f, 0.919540f, 0.011362f)),
+        dot(fRgb, FfxFloat32x3(0.016391f, 0.088013f, 0.895595f)));
+}
+
+// SMPTE ST 2084 inverse EOTF, 1.0 in is 10000 nits
+FfxFloat32x3 LinearToPQ(FfxFloat32x3 fRgb)
+{
+    const FfxFloat32 m1 = 2610.0f / 16384.0f;
+    const FfxFloat32 m2 = 2523.0f / 4096.0f * 128.0f;
+    const FfxFloat32 c1 = 3424.0f / 4096.0f;
+    const FfxFloat32 c2 = 2413.0f / 4096.0f * 32.0f;
+    const FfxFloat32 c3 = 2392.0f / 4096.0f * 32.0f;
+
+    const FfxFloat32x3 fYm1 = ffxPow(ffxSaturate(fRgb), FFX_BROADCAST_FLOAT32X3(m1));
+    return ffxPow((c1 + c2 * fYm1) / (1.0f + c3 * fYm1), FFX_BROADCAST_FLOAT32X3(m2));
+}
+
+// Converts the linear scene color to the swapchain encoding, OutputScale() maps 1.0 to paper white in the units of the encoding
+FfxFloat32x3 EncodeOutput(FfxFloat32x3 fRgb)
+{
+    if (FFX_FSR2_OUTPUT_ENCODING == FfxUInt32(FFX_FSR2_OUTPUTENCODING_PQ_BT2020)) {
+        return LinearToPQ(Rec709ToRec2020(ffxMax(fRgb, FFX_BROADCAST_FLOAT32X3(0.0f))) * OutputScale());
+    }
+    if (FFX_FSR2_OUTPUT_ENCODING == FfxUInt32(FFX_FSR2_OUTPUTENCODING_SCRGB)) {
+        return fRgb * OutputScale();
+    }
+    return fRgb;
+}
+
 
 struct BilinearSamplingData
 {
@@ -560,6 +615,74 @@ FfxFloat32 PointToPlaneDistance(PlaneData plane, FfxFloat32x3 fPoint)
     return abs(dot(plane.fNormal, fPoint) + plane.fDistanceFromOrigin);
 }
 
+#if FFX_FSR2_OPTION_PACKED_LOCK_STATUS
+// The history and the lock status share one R16G16B16A16_UNORM surface, each channel holding a 16 bit code:
+//  xyz: the color as a half without its sign bit and last mantissa bit, above 2 bits of the temporal reactive factor
+//  w:   the lock lifetime in the upper 8 bits and the temporal luma in the lower 8 bits
+// The temporal reactive factor keeps its sign and 5 bits of magnitude.
+#define FSR2_PACKED_LOCK_LIFETIME_RANGE 2.0f
+#define FSR2_PACKED_LOCK_TEMPORAL_LUMA_RANGE 4.0f
+
+FfxUInt32 PackedHistoryCode(FfxFloat32 fPacked)
+{
+    return FfxUInt32(fPacked * 65535.0f + 0.5f);
+}
+
+FfxFloat32 UnpackHistoryColorChannel(FfxUInt32 uCode)
+{
+#if defined(FFX_HLSL)
+    return f16tof32((uCode >> 2) << 1);
+#elif defined(FFX_GLSL)
+    return unpackHalf2x16((uCode >> 2) << 1).x;
+#endif
+}
+
+FfxUInt32 PackHistoryColorChannel(FfxFloat32 fColor)
+{
+    return ffxMin((f32tof16(ffxMax(0.0f, fColor)) + 1u) >> 1, 0x3DFFu) << 2;
+}
+
+FfxFloat32x4 UnpackHistory(FfxFloat32x4 fPacked)
+{
+    const FfxUInt32 uRed = PackedHistoryCode(fPacked.x);
+    const FfxUInt32 uGreen = PackedHistoryCode(fPacked.y);
+    const FfxUInt32 uBlue = PackedHistoryCode(fPacked.z);
+
+    const FfxUInt32 uReactive = (uRed & 3u) | ((uGreen & 3u) << 2) | ((uBlue & 3u) << 4);
+    const FfxFloat32 fReactive = FfxFloat32(uReactive & 31u) / 31.0f;
+
+    return FfxFloat32x4(UnpackHistoryColorChannel(uRed), UnpackHistoryColorChannel(uGreen), UnpackHistoryColorChannel(uBlue),
+        ((uReactive & 32u) != 0u) ? -ffxMax(FSR2_EPSILON, fReactive) : fReactive);
+}
+
+FfxFloat32x2 UnpackLockStatus(FfxFloat32x4 fPacked)
+{
+    const FfxUInt32 uLockStatus = PackedHistoryCode(fPacked.w);
+
+    FfxFloat32x2 fLockStatus;
+    fLockStatus[LOCK_LIFETIME_REMAINING] = FfxFloat32(uLockStatus >> 8) * (FSR2_PACKED_LOCK_LIFETIME_RANGE / 255.0f);
+    fLockStatus[LOCK_TEMPORAL_LUMA] = FfxFloat32(uLockStatus & 255u) * (FSR2_PACKED_LOCK_TEMPORAL_LUMA_RANGE / 255.0f);
+
+    return fLockStatus;
+}
+
+FfxFloat32x4 PackHistory(FfxFloat32x3 fColor, FfxFloat32 fTemporalReactiveFactor, FfxFloat32x2 fLockStatus)
+{
+    const FfxUInt32 uReactive = FfxUInt32(ffxSaturate(abs(fTemporalReactiveFactor)) * 31.0f + 0.5f) | ((fTemporalReactiveFactor < 0.0f) ? 32u : 0u);
+
+    const FfxUInt32 uLifetime = FfxUInt32(ffxSaturate(fLockStatus[LOCK_LIFETIME_REMAINING] / FSR2_PACKED_LOCK_LIFETIME_RANGE) * 255.0f + 0.5f);
+    const FfxUInt32 uTemporalLuma = FfxUInt32(ffxSaturate(fLockStatus[LOCK_TEMPORAL_LUMA] / FSR2_PACKED_LOCK_TEMPORAL_LUMA_RANGE) * 255.0f + 0.5f);
+
+    const FfxUInt32x4 uPacked = FfxUInt32x4(
+        PackHistoryColorChannel(fColor.r) | (uReactive & 3u),
+        PackHistoryColorChannel(fColor.g) | ((uReactive >> 2) & 3u),
+        PackHistoryColorChannel(fColor.b) | (uReactive >> 4),
+        (uLifetime << 8) | uTemporalLuma);
+
+    return FfxFloat32x4(uPacked) / 65535.0f;
+}
+#endif // #if FFX_FSR2_OPTION_PACKED_LOCK_STATUS
+
 #endif // #if defined(FFX_GPU)
 
 #endif //!defined(FFX_FSR2_COMMON_H)
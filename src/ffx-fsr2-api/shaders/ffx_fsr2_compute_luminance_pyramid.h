@@ -20,6 +20,80 @@
 // THE SOFTWARE.
 
 FFX_GROUPSHARED FfxUInt32 spdCounter;
+FFX_GROUPSHARED FfxUInt32 spdExposureHistogram[FFX_FSR2_EXPOSURE_HISTOGRAM_BIN_COUNT];
+
+// The histogram is flushed to memory after mip 5 and resolved on the last mip, which needs at least one more mip in between
+FfxBoolean UseExposureHistogram()
+{
+    return AutoExposureMode() == FFX_FSR2_AUTO_EXPOSURE_HISTOGRAM && MipCount() > 6;
+}
+
+FfxUInt32 ExposureHistogramBin(FfxFloat32 fLogLuma)
+{
+    const FfxFloat32 fLog2Luma = fLogLuma * 1.442695f; // log2(e)
+    const FfxFloat32 fBinsPerStop = FfxFloat32(FFX_FSR2_EXPOSURE_HISTOGRAM_BIN_COUNT) / (FFX_FSR2_EXPOSURE_HISTOGRAM_MAX_LOG2_LUMA - FFX_FSR2_EXPOSURE_HISTOGRAM_MIN_LOG2_LUMA);
+    const FfxFloat32 fBin = (fLog2Luma - FFX_FSR2_EXPOSURE_HISTOGRAM_MIN_LOG2_LUMA) * fBinsPerStop;
+
+    return FfxUInt32(ffxMin(ffxMax(fBin, 0.0f), FfxFloat32(FFX_FSR2_EXPOSURE_HISTOGRAM_BIN_COUNT - 1)));
+}
+
+void AddToLocalExposureHistogram(FfxUInt32 uBin)
+{
+#if defined(FFX_HLSL)
+    InterlockedAdd(spdExposureHistogram[uBin], 1);
+#elif defined(FFX_GLSL)
+    atomicAdd(spdExposureHistogram[uBin], 1u);
+#endif
+}
+
+void FlushLocalExposureHistogram()
+{
+    for (FfxUInt32 uBin = 0; uBin < FFX_FSR2_EXPOSURE_HISTOGRAM_BIN_COUNT; ++uBin)
+    {
+        if (spdExposureHistogram[uBin] > 0)
+        {
+            SPD_AddToExposureHistogram(uBin, spdExposureHistogram[uBin]);
+        }
+    }
+
+    // make the bins visible before this workgroup signals the atomic counter
+    SPD_ExposureHistogramMemoryBarrier();
+}
+
+// Reads and clears the global histogram, returns the average log luma of the configured percentile window
+FfxFloat32 ResolveExposureHistogram()
+{
+    FfxFloat32 fTotal = 0.0f;
+    for (FfxUInt32 uBin = 0; uBin < FFX_FSR2_EXPOSURE_HISTOGRAM_BIN_COUNT; ++uBin)
+    {
+        spdExposureHistogram[uBin] = SPD_TakeExposureHistogramBin(uBin);
+        fTotal += FfxFloat32(spdExposureHistogram[uBin]);
+    }
+
+    const FfxFloat32 fWindowStart = fTotal * ExposureHistogramPercentiles().x;
+    const FfxFloat32 fWindowEnd = fTotal * ExposureHistogramPercentiles().y;
+    const FfxFloat32 fStopsPerBin = (FFX_FSR2_EXPOSURE_HISTOGRAM_MAX_LOG2_LUMA - FFX_FSR2_EXPOSURE_HISTOGRAM_MIN_LOG2_LUMA) / FfxFloat32(FFX_FSR2_EXPOSURE_HISTOGRAM_BIN_COUNT);
+
+    FfxFloat32 fCumulative = 0.0f;
+    FfxFloat32 fWeightedLog2Luma = 0.0f;
+    FfxFloat32 fWeight = 0.0f;
+    for (FfxUInt32 uBin = 0; uBin < FFX_FSR2_EXPOSURE_HISTOGRAM_BIN_COUNT; ++uBin)
+    {
+        const FfxFloat32 fCount = FfxFloat32(spdExposureHistogram[uBin]);
+
+        // only the part of the bin that falls inside the window contributes
+        const FfxFloat32 fInside = ffxMax(0.0f, ffxMin(fCumulative + fCount, fWindowEnd) - ffxMax(fCumulative, fWindowStart));
+        const FfxFloat32 fBinLog2Luma = FFX_FSR2_EXPOSURE_HISTOGRAM_MIN_LOG2_LUMA + (FfxFloat32(uBin) + 0.5f) * fStopsPerBin;
+
+        fWeightedLog2Luma += fInside * fBinLog2Luma;
+        fWeight += fInside;
+        fCumulative += fCount;
+    }
+
+    const FfxFloat32 fLog2Luma = (fWeight > 0.0f) ? fWeightedLog2Luma / fWeight : 0.0f;
+
+    return fLog2Luma * 0.693147f; // ln(2)
+}
 
 #ifndef SPD_PACKED_ONLY
 FFX_GROUPSHARED FfxFloat32 spdIntermediateR[16][16];
@@ -39,7 +113,13 @@ FfxFloat32x4 SpdLoadSourceImage(FfxFloat32x2 tex, FfxUInt32 slice)
     const FfxFloat32 fLogLuma = log(ffxMax(FSR2_EPSILON, RGBToLuma(fRgb)));
 
     // Make sure out of screen pixels contribute no value to the end result
-    const FfxFloat32 result = all(FFX_LESS_THAN(tex, RenderSize())) ? fLogLuma : 0.0f;
+    const FfxBoolean bOnScreen = all(FFX_LESS_THAN(tex, RenderSize()));
+    const FfxFloat32 result = bOnScreen ? fLogLuma : 0.0f;
+
+    if (UseExposureHistogram() && bOnScreen)
+    {
+        AddToLocalExposureHistogram(ExposureHistogramBin(fLogLuma));
+    }
 
     return FfxFloat32x4(result, 0, 0, 0);
 }
@@ -56,6 +136,12 @@ void SpdStore(FfxInt32x2 pix, FfxFloat32x4 outValue, FfxUInt32 index, FfxUInt32
         SPD_SetMipmap(pix, index, outValue.r);
     }
 
+    // mip 5 is stored by a single thread per workgroup, after all source pixels were binned
+    if (index == 5 && UseExposureHistogram())
+    {
+        FlushLocalExposureHistogram();
+    }
+
     if (index == MipCount() - 1) { //accumulate on 1x1 level
 
         if (all(FFX_EQUAL(pix, FfxInt32x2(0, 0))))
@@ -63,9 +149,14 @@ void SpdStore(FfxInt32x2 pix, FfxFloat32x4 outValue, FfxUInt32 index, FfxUInt32
             FfxFloat32 prev = SPD_LoadExposureBuffer().y;
             FfxFloat32 result = outValue.r;
 
+            if (UseExposureHistogram())
+            {
+                result = ResolveExposureHistogram();
+            }
+
             if (prev < resetAutoExposureAverageSmoothing) // Compare Lavg, so small or negative values
             {
-                FfxFloat32 rate = 1.0f;
+                FfxFloat32 rate = (result > prev) ? AdaptationRateUp() : AdaptationRateDown();
                 result = prev + (result - prev) * (1 - exp(-DeltaTime() * rate));
             }
             FfxFloat32x2 spdOutput = FfxFloat32x2(ComputeAutoExposureFromLavg(result), result);
@@ -165,10 +256,23 @@ FfxFloat16x4 SpdReduce4H(FfxFloat16x4 v0, FfxFloat16x4 v1, FfxFloat16x4 v2, FfxF
 }
 #endif
 
+#if defined(FFX_GLSL) && FFX_FSR2_OPTION_SPD_SUBGROUP_SHUFFLE
+#define SPD_SUBGROUP_SHUFFLE 1
+#endif
+
 #include "ffx_spd.h"
 
 void ComputeAutoExposure(FfxUInt32x3 WorkGroupId, FfxUInt32 LocalThreadIndex)
 {
+    if (UseExposureHistogram())
+    {
+        if (LocalThreadIndex < FFX_FSR2_EXPOSURE_HISTOGRAM_BIN_COUNT)
+        {
+            spdExposureHistogram[LocalThreadIndex] = 0;
+        }
+        SpdWorkgroupShuffleBarrier();
+    }
+
 #if FFX_HALF
     SpdDownsampleH(
         FfxUInt32x2(WorkGroupId.xy),
@@ -29,8 +29,9 @@
 #define FSR2_BIND_UAV_EXPOSURE_MIP_LUMA_CHANGE        2
 #define FSR2_BIND_UAV_EXPOSURE_MIP_5                  3
 #define FSR2_BIND_UAV_AUTO_EXPOSURE                   4
-#define FSR2_BIND_CB_FSR2                             5
-#define FSR2_BIND_CB_SPD                              6
+#define FSR2_BIND_UAV_EXPOSURE_HISTOGRAM              5
+#define FSR2_BIND_CB_FSR2                             6
+#define FSR2_BIND_CB_SPD                              7
 
 #include "ffx_fsr2_callbacks_glsl.h"
 #include "ffx_fsr2_common.h"
@@ -42,6 +43,11 @@
 		uint numWorkGroups;
 		uvec2 workGroupOffset;
 		uvec2 renderSize;
+		uint autoExposureMode;
+		float histogramLowPercentile;
+		float histogramHighPercentile;
+		float adaptationRateUp;
+		float adaptationRateDown;
 	} cbSPD;
 
 	uint MipCount()
@@ -63,6 +69,26 @@
 	{
 		return cbSPD.renderSize;
 	}
+
+	uint AutoExposureMode()
+	{
+		return cbSPD.autoExposureMode;
+	}
+
+	vec2 ExposureHistogramPercentiles()
+	{
+		return vec2(cbSPD.histogramLowPercentile, cbSPD.histogramHighPercentile);
+	}
+
+	float AdaptationRateUp()
+	{
+		return cbSPD.adaptationRateUp;
+	}
+
+	float AdaptationRateDown()
+	{
+		return cbSPD.adaptationRateDown;
+	}
 #endif
 
 vec2 SPD_LoadExposureBuffer()
@@ -112,6 +138,21 @@ void SPD_ResetAtomicCounter()
 	imageStore(rw_spd_global_atomic, ivec2(0,0), uvec4(0));
 }
 
+void SPD_AddToExposureHistogram(uint uBin, uint uCount)
+{
+	imageAtomicAdd(rw_exposure_histogram, ivec2(uBin, 0), uCount);
+}
+
+uint SPD_TakeExposureHistogramBin(uint uBin)
+{
+	return imageAtomicExchange(rw_exposure_histogram, ivec2(uBin, 0), 0u);
+}
+
+void SPD_ExposureHistogramMemoryBarrier()
+{
+	memoryBarrierImage();
+}
+
 #include "ffx_fsr2_compute_luminance_pyramid.h"
 
 #ifndef FFX_FSR2_THREAD_GROUP_WIDTH
@@ -24,6 +24,7 @@
 #define FSR2_BIND_UAV_EXPOSURE_MIP_LUMA_CHANGE        1
 #define FSR2_BIND_UAV_EXPOSURE_MIP_5                  2
 #define FSR2_BIND_UAV_AUTO_EXPOSURE                   3
+#define FSR2_BIND_UAV_EXPOSURE_HISTOGRAM              4
 #define FSR2_BIND_CB_FSR2                             0
 #define FSR2_BIND_CB_SPD                              1
 
@@ -37,6 +38,11 @@
         FfxUInt32   numWorkGroups;
         FfxUInt32x2 workGroupOffset;
         FfxUInt32x2 renderSize;
+        FfxUInt32   autoExposureMode;
+        FfxFloat32  histogramLowPercentile;
+        FfxFloat32  histogramHighPercentile;
+        FfxFloat32  adaptationRateUp;
+        FfxFloat32  adaptationRateDown;
     };
 
     FfxUInt32 MipCount()
@@ -58,6 +64,26 @@
     {
         return renderSize;
     }
+
+    FfxUInt32 AutoExposureMode()
+    {
+        return autoExposureMode;
+    }
+
+    FfxFloat32x2 ExposureHistogramPercentiles()
+    {
+        return FfxFloat32x2(histogramLowPercentile, histogramHighPercentile);
+    }
+
+    FfxFloat32 AdaptationRateUp()
+    {
+        return adaptationRateUp;
+    }
+
+    FfxFloat32 AdaptationRateDown()
+    {
+        return adaptationRateDown;
+    }
 #endif
 
 
@@ -108,6 +134,23 @@ void SPD_ResetAtomicCounter()
     rw_spd_global_atomic[FfxInt32x2(0,0)] = 0;
 }
 
+void SPD_AddToExposureHistogram(FfxUInt32 uBin, FfxUInt32 uCount)
+{
+    InterlockedAdd(rw_exposure_histogram[FfxInt32x2(uBin, 0)], uCount);
+}
+
+FfxUInt32 SPD_TakeExposureHistogramBin(FfxUInt32 uBin)
+{
+    FfxUInt32 uCount;
+    InterlockedExchange(rw_exposure_histogram[FfxInt32x2(uBin, 0)], 0, uCount);
+    return uCount;
+}
+
+void SPD_ExposureHistogramMemoryBarrier()
+{
+    DeviceMemoryBarrier();
+}
+
 #include "ffx_fsr2_compute_luminance_pyramid.h"
 
 #ifndef FFX_FSR2_THREAD_GROUP_WIDTH
@@ -48,11 +48,7 @@ FfxFloat32 ComputeDepthClip(FfxFloat32x2 fUvSample, FfxFloat32 fCurrentDepthSamp
 
                 if (fDepthDiff > 0.0f) {
 
-#if FFX_FSR2_OPTION_INVERTED_DEPTH
-                    const FfxFloat32 fPlaneDepth = ffxMin(fPrevDepthSample, fCurrentDepthSample);
-#else
-                    const FfxFloat32 fPlaneDepth = ffxMax(fPrevDepthSample, fCurrentDepthSample);
-#endif
+                    const FfxFloat32 fPlaneDepth = FFX_FSR2_INVERTED_DEPTH ? ffxMin(fPrevDepthSample, fCurrentDepthSample) : ffxMax(fPrevDepthSample, fCurrentDepthSample);
                     
                     const FfxFloat32x3 fCenter = GetViewSpacePosition(FfxInt32x2(RenderSize() * 0.5f), RenderSize(), fPlaneDepth);
                     const FfxFloat32x3 fCorner = GetViewSpacePosition(FfxInt32x2(0, 0), RenderSize(), fPlaneDepth);
@@ -145,6 +141,15 @@ FfxFloat32 ComputeTemporalMotionDivergence(FfxInt32x2 iPxPos)
     return fPxDistance > 1.0f ? ffxLerp(0.0f, 1.0f - ffxSaturate(length(fPrevMotionVector) / length(fMotionVector)), ffxSaturate(ffxPow(fPxDistance / 20.0f, 3.0f))) : 0;
 }
 
+#if FFX_FSR2_OPTION_MATERIAL_ID_REACTIVITY
+FfxFloat32x2 LoadMaterialReactiveMasks(FfxInt32x2 iPxPos)
+{
+    const FfxUInt32 uMaterialId = LoadMaterialId(iPxPos);
+
+    return (uMaterialId < FfxUInt32(FFX_FSR2_MATERIAL_REACTIVITY_TABLE_SIZE)) ? LoadMaterialReactivity(uMaterialId) : FfxFloat32x2(0.0f, 0.0f);
+}
+#endif
+
 void PreProcessReactiveMasks(FfxInt32x2 iPxLrPos, FfxFloat32 fMotionDivergence)
 {
     // Compensate for bilinear sampling in accumulation pass
@@ -171,6 +176,13 @@ void PreProcessReactiveMasks(FfxInt32x2 iPxLrPos, FfxFloat32 fMotionDivergence)
             FfxFloat32 fReactiveSample = LoadReactiveMask(sampleCoord);
             FfxFloat32 fTransparencyAndCompositionSample = LoadTransparencyAndCompositionMask(sampleCoord);
 
+#if FFX_FSR2_OPTION_MATERIAL_ID_REACTIVITY
+            // authored masks take precedence where they are stronger than the material table
+            const FfxFloat32x2 fMaterialReactiveMasks = LoadMaterialReactiveMasks(sampleCoord);
+            fReactiveSample = ffxMax(fReactiveSample, fMaterialReactiveMasks.x);
+            fTransparencyAndCompositionSample = ffxMax(fTransparencyAndCompositionSample, fMaterialReactiveMasks.y);
+#endif
+
             fColorSamples[sampleIdx] = fColorSample;
             fReactiveSamples[sampleIdx] = fReactiveSample;
             fTransparencyAndCompositionSamples[sampleIdx] = fTransparencyAndCompositionSample;
@@ -243,11 +255,7 @@ void DepthClip(FfxInt32x2 iPxPos)
     StorePreparedInputColor(iPxPos, FfxFloat32x4(fPreparedYCoCg, fDepthClip));
 
     // Compute dilated reactive mask
-#if FFX_FSR2_OPTION_LOW_RESOLUTION_MOTION_VECTORS
-    FfxInt32x2 iSamplePos = iPxPos;
-#else
-    FfxInt32x2 iSamplePos = ComputeHrPosFromLrPos(iPxPos);
-#endif
+    FfxInt32x2 iSamplePos = FFX_FSR2_LOW_RESOLUTION_MOTION_VECTORS ? iPxPos : ComputeHrPosFromLrPos(iPxPos);
 
     FfxFloat32 fMotionDivergence = ComputeMotionDivergence(iSamplePos, RenderSize());
     FfxFloat32 fTemporalMotionDifference = ffxSaturate(ComputeTemporalMotionDivergence(iPxPos) - ComputeDepthDivergence(iPxPos));
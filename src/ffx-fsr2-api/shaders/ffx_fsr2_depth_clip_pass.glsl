@@ -41,6 +41,10 @@
 #define FSR2_BIND_UAV_PREPARED_INPUT_COLOR                  13
 
 #define FSR2_BIND_CB_FSR2                                   14
+#if FFX_FSR2_OPTION_MATERIAL_ID_REACTIVITY
+#define FSR2_BIND_SRV_MATERIAL_ID                           15
+#define FSR2_BIND_SRV_MATERIAL_REACTIVITY_TABLE             16
+#endif
 
 #include "ffx_fsr2_callbacks_glsl.h"
 #include "ffx_fsr2_common.h"
@@ -34,6 +34,10 @@
 #define FSR2_BIND_UAV_PREPARED_INPUT_COLOR                  1
 
 #define FSR2_BIND_CB_FSR2                                   0
+#if FFX_FSR2_OPTION_MATERIAL_ID_REACTIVITY
+#define FSR2_BIND_SRV_MATERIAL_ID                           10
+#define FSR2_BIND_SRV_MATERIAL_REACTIVITY_TABLE             11
+#endif
 
 #include "ffx_fsr2_callbacks_hlsl.h"
 #include "ffx_fsr2_common.h"
@@ -26,11 +26,7 @@ void ClearResourcesForNextFrame(in FfxInt32x2 iPxHrPos)
 {
     if (all(FFX_LESS_THAN(iPxHrPos, FfxInt32x2(RenderSize()))))
     {
-#if FFX_FSR2_OPTION_INVERTED_DEPTH
-        const FfxUInt32 farZ = 0x0;
-#else
-        const FfxUInt32 farZ = 0x3f800000;
-#endif
+        const FfxUInt32 farZ = FFX_FSR2_INVERTED_DEPTH ? 0x0 : 0x3f800000;
         SetReconstructedDepth(iPxHrPos, farZ);
     }
 }
@@ -104,9 +100,12 @@ FfxBoolean ComputeThinFeatureConfidence(FfxInt32x2 pos)
 
 void ComputeLock(FfxInt32x2 iPxLrPos)
 {
-    if (ComputeThinFeatureConfidence(iPxLrPos))
+    const FfxInt32x2 iPxHrPos = ComputeHrPosFromLrPos(iPxLrPos);
+
+    // New locks in invalidated regions would be ignored by the accumulate pass, same as on a reset frame.
+    if (!IsHistoryInvalidated(iPxHrPos) && ComputeThinFeatureConfidence(iPxLrPos))
     {
-        StoreNewLocks(ComputeHrPosFromLrPos(iPxLrPos), 1.f);
+        StoreNewLocks(iPxHrPos, 1.f);
     }
 
     ClearResourcesForNextFrame(iPxLrPos);
@@ -25,9 +25,10 @@
 #extension GL_EXT_samplerless_texture_functions : require
 
 #define FSR2_BIND_SRV_LOCK_INPUT_LUMA                       0
-#define FSR2_BIND_UAV_NEW_LOCKS                             1
-#define FSR2_BIND_UAV_RECONSTRUCTED_PREV_NEAREST_DEPTH      2
-#define FSR2_BIND_CB_FSR2                                   3
+#define FSR2_BIND_SRV_HISTORY_INVALIDATION_MASK             1
+#define FSR2_BIND_UAV_NEW_LOCKS                             2
+#define FSR2_BIND_UAV_RECONSTRUCTED_PREV_NEAREST_DEPTH      3
+#define FSR2_BIND_CB_FSR2                                   4
 
 #include "ffx_fsr2_callbacks_glsl.h"
 #include "ffx_fsr2_common.h"
@@ -20,6 +20,7 @@
 // THE SOFTWARE.
 
 #define FSR2_BIND_SRV_LOCK_INPUT_LUMA                       0
+#define FSR2_BIND_SRV_HISTORY_INVALIDATION_MASK             1
 #define FSR2_BIND_UAV_NEW_LOCKS                             0
 #define FSR2_BIND_UAV_RECONSTRUCTED_PREV_NEAREST_DEPTH      1
 #define FSR2_BIND_CB_FSR2                                   0
@@ -21,15 +21,131 @@
 
 #define GROUP_SIZE  8
 
-#define FSR_RCAS_DENOISE 1
-
 void WriteUpscaledOutput(FFX_MIN16_U2 iPxHrPos, FfxFloat32x3 fUpscaledColor)
 {
-    StoreUpscaledOutput(FFX_MIN16_I2(iPxHrPos), fUpscaledColor);
+    StoreUpscaledOutput(FFX_MIN16_I2(iPxHrPos), EncodeOutput(fUpscaledColor));
 }
 
-#define FSR_RCAS_F
-FfxFloat32x4 FsrRcasLoadF(FfxInt32x2 p)
+FfxFloat32x2 ComputeUndistortedUv(FfxFloat32x2 fUv)
+{
+    const FfxFloat32x2 fCoefficients = LensDistortionCoefficients();
+    const FfxFloat32x2 fOffset = fUv - LensDistortionCenter();
+    const FfxFloat32 fRadiusSq = dot(fOffset * 2.0f, fOffset * 2.0f);
+
+    return LensDistortionCenter() + fOffset * (1.0f + fRadiusSq * (fCoefficients.x + fRadiusSq * fCoefficients.y));
+}
+
+// Scale the lobe by the sharpness map, a value of 1 leaves the constant identical to the one set up on the CPU
+FfxUInt32x4 ComputeRcasConfig(FfxFloat32x2 fUv)
+{
+    FfxUInt32x4 uConfig = RCASConfig();
+    uConfig.x = ffxAsUInt32(ffxAsFloat(uConfig.x) * ffxSaturate(SampleSharpnessMap(fUv)));
+
+    return uConfig;
+}
+
+// Reciprocal of the view space depth, 0 for depth at infinity so the sky compares as the farthest surface
+FfxFloat32 LoadRcasRcpViewDepth(FfxInt32x2 iPxLrPos)
+{
+    const FfxInt32x2 iClampedPos = clamp(iPxLrPos, FfxInt32x2(0, 0), RenderSize() - FfxInt32x2(1, 1));
+
+    return abs(1.0f / GetViewSpaceDepth(LoadDilatedDepth(iClampedPos)));
+}
+
+// Fade the lobe out near a depth discontinuity, the relative depth step of a silhouette against a far background
+// is close to 1 and sharpening across it overshoots into a halo around the object. The dilated depth grows
+// silhouettes by a render pixel, so the taps are spread three render pixels apart to see past it from both sides.
+FfxFloat32 ComputeDepthEdgeLimit(FfxInt32x2 iPxPos, FfxFloat32 fThreshold)
+{
+    const FfxInt32x2 iPxLrPos = FfxInt32x2((FfxFloat32x2(iPxPos) + 0.5f) * DownscaleFactor());
+
+    FfxFloat32 fRcpDepthMin = FSR2_FLT_MAX;
+    FfxFloat32 fRcpDepthMax = 0.0f;
+    for (FfxInt32 y = -1; y <= 1; ++y) {
+        for (FfxInt32 x = -1; x <= 1; ++x) {
+            const FfxFloat32 fRcpDepth = LoadRcasRcpViewDepth(iPxLrPos + FfxInt32x2(x, y) * 3);
+            fRcpDepthMin = ffxMin(fRcpDepthMin, fRcpDepth);
+            fRcpDepthMax = ffxMax(fRcpDepthMax, fRcpDepth);
+        }
+    }
+
+    // 1 - nearest / farthest view depth, full sharpening up to the threshold, none from twice the threshold
+    const FfxFloat32 fRelativeDepthStep = (fRcpDepthMax > 0.0f) ? (1.0f - fRcpDepthMin / fRcpDepthMax) : 0.0f;
+
+    return ffxSaturate(2.0f - fRelativeDepthStep / fThreshold);
+}
+
+// Both limiters are read from the RCAS config, so neither needs a permutation
+#define FSR_RCAS_LOBE_CALLBACK 1
+FfxFloat32 FsrRcasLobeF(FfxFloat32 fLobe, FfxFloat32 fNoise, FfxInt32x2 iPxPos)
+{
+    const FfxUInt32x4 uConfig = RCASConfig();
+
+    if ((uConfig.z & FfxUInt32(FFX_FSR2_RCAS_CONFIG_DENOISE)) != FfxUInt32(0)) {
+        fLobe *= fNoise;
+    }
+
+    const FfxFloat32 fDepthEdgeThreshold = ffxAsFloat(uConfig.w);
+    if (fDepthEdgeThreshold > 0.0f) {
+        fLobe *= ComputeDepthEdgeLimit(iPxPos, fDepthEdgeThreshold);
+    }
+
+    return fLobe;
+}
+
+// The 16x16 tile of a workgroup plus a one pixel border, every tap of the tile is loaded and exposed once instead of by up to 5 threads
+#define RCAS_TILE_SIZE 18
+FFX_GROUPSHARED FfxFloat32 rcasTileR[RCAS_TILE_SIZE][RCAS_TILE_SIZE];
+FFX_GROUPSHARED FfxFloat32 rcasTileG[RCAS_TILE_SIZE][RCAS_TILE_SIZE];
+FFX_GROUPSHARED FfxFloat32 rcasTileB[RCAS_TILE_SIZE][RCAS_TILE_SIZE];
+
+// The lens distortion path samples between pixels and can't use the tile, both are compiled and one is picked at runtime
+FfxBoolean UseRcasTile()
+{
+    return FFX_FSR2_RCAS_GROUPSHARED && !FFX_FSR2_LENS_DISTORTION;
+}
+
+// Display position of the top left border pixel of the tile of the workgroup filtering the pixel
+FfxInt32x2 ComputeRcasTileOrigin(FfxUInt32x2 uPxPos)
+{
+    return FfxInt32x2((uPxPos >> 4u) << 4u) - FfxInt32x2(1, 1);
+}
+
+// The caller synchronizes the group, so the barrier stays in uniform control flow when the tile is skipped
+void LoadRcasTile(FfxUInt32 uLocalIndex, FfxUInt32x2 uWorkGroupId)
+{
+    const FfxInt32x2 iTileOrigin = ComputeRcasTileOrigin(uWorkGroupId << 4u);
+
+    // Out of bounds loads return 0, the same as the taps of the border pixels read without the tile
+    const FfxUInt32 uTileSize = FfxUInt32(RCAS_TILE_SIZE);
+    for (FfxUInt32 i = uLocalIndex; i < uTileSize * uTileSize; i += 64u) {
+        const FfxInt32x2 iTilePos = FfxInt32x2(FfxUInt32x2(i % uTileSize, i / uTileSize));
+        const FfxFloat32x3 fColor = PrepareRgb(LoadRCAS_Input(iTileOrigin + iTilePos).rgb, Exposure(), PreExposure());
+
+        rcasTileR[iTilePos.y][iTilePos.x] = fColor.r;
+        rcasTileG[iTilePos.y][iTilePos.x] = fColor.g;
+        rcasTileB[iTilePos.y][iTilePos.x] = fColor.b;
+    }
+}
+
+FfxFloat32x4 LoadRcasTileTap(FfxInt32x2 p, FfxInt32x2 iTileOrigin)
+{
+    // RCAS only reads the color, the taps in the tile are already exposed
+    const FfxInt32x2 iTilePos = p - iTileOrigin;
+
+    return FfxFloat32x4(rcasTileR[iTilePos.y][iTilePos.x], rcasTileG[iTilePos.y][iTilePos.x], rcasTileB[iTilePos.y][iTilePos.x], 0.0f);
+}
+
+FfxFloat32x4 SampleRcasTap(FfxInt32x2 p, FfxFloat32x2 fSampleOffset)
+{
+    FfxFloat32x4 fColor = SampleRCAS_Input((FfxFloat32x2(p) + 0.5f + fSampleOffset) / FfxFloat32x2(DisplaySize()));
+
+    fColor.rgb = PrepareRgb(fColor.rgb, Exposure(), PreExposure());
+
+    return fColor;
+}
+
+FfxFloat32x4 LoadRcasTap(FfxInt32x2 p)
 {
     FfxFloat32x4 fColor = LoadRCAS_Input(p);
 
@@ -38,23 +154,95 @@ FfxFloat32x4 FsrRcasLoadF(FfxInt32x2 p)
     return fColor;
 }
 
+// Passed by FsrRcasF to the loads of every tap of the pixel being filtered
+struct RcasLoadParameter
+{
+    FfxInt32x2 iTileOrigin;
+    FfxFloat32x2 fSampleOffset; // Sub-pixel offset of the undistorted position of the pixel
+};
+#define FSR_RCAS_LOAD_PARAMETER RcasLoadParameter
+
+RcasLoadParameter MakeRcasLoadParameter(FfxUInt32x2 uPxPos, FfxFloat32x2 fSampleOffset)
+{
+    RcasLoadParameter param;
+    param.iTileOrigin = ComputeRcasTileOrigin(uPxPos);
+    param.fSampleOffset = fSampleOffset;
+    return param;
+}
+
+#define FSR_RCAS_F
+FfxFloat32x4 FsrRcasLoadF(FfxInt32x2 p, RcasLoadParameter param)
+{
+    if (UseRcasTile()) {
+        return LoadRcasTileTap(p, param.iTileOrigin);
+    }
+    if (FFX_FSR2_LENS_DISTORTION) {
+        return SampleRcasTap(p, param.fSampleOffset);
+    }
+    return LoadRcasTap(p);
+}
+
 void FsrRcasInputF(inout FfxFloat32 r, inout FfxFloat32 g, inout FfxFloat32 b) {}
 
 #include "ffx_fsr1.h"
 
 
+void CurrFilterLensDistortion(FFX_MIN16_U2 pos)
+{
+    // Gather from the undistorted history, so the output is resampled once instead of again by the compositor
+    const FfxFloat32x2 fUndistortedUv = ComputeUndistortedUv((FfxFloat32x2(pos) + 0.5f) / FfxFloat32x2(DisplaySize()));
+    if (fUndistortedUv.x < 0.0f || fUndistortedUv.y < 0.0f || fUndistortedUv.x > 1.0f || fUndistortedUv.y > 1.0f) {
+        if (FFX_FSR2_ALPHA_UPSCALING) {
+            StoreUpscaledOutputWithAlpha(FFX_MIN16_I2(pos), EncodeOutput(FfxFloat32x3(0.0f, 0.0f, 0.0f)), 0.0f);
+            return;
+        }
+        WriteUpscaledOutput(pos, FfxFloat32x3(0.0f, 0.0f, 0.0f));
+        return;
+    }
+
+    const FfxFloat32x2 fPxPos = fUndistortedUv * FfxFloat32x2(DisplaySize()) - 0.5f;
+    const FfxFloat32x2 fPxBase = ffxMax(floor(fPxPos), FfxFloat32x2(0.0f, 0.0f));
+
+    FfxFloat32x3 c;
+    FsrRcasF(c.r, c.g, c.b, FfxUInt32x2(fPxBase), ComputeRcasConfig(fUndistortedUv), MakeRcasLoadParameter(FfxUInt32x2(pos), fPxPos - fPxBase));
+
+    c = UnprepareRgb(c, Exposure());
+
+    if (FFX_FSR2_ALPHA_UPSCALING) {
+        StoreUpscaledOutputWithAlpha(FFX_MIN16_I2(pos), EncodeOutput(c), SampleRCAS_InputAlpha(fUndistortedUv));
+        return;
+    }
+    WriteUpscaledOutput(pos, c);
+}
+
 void CurrFilter(FFX_MIN16_U2 pos)
 {
+    if (FFX_FSR2_LENS_DISTORTION) {
+        CurrFilterLensDistortion(pos);
+        return;
+    }
+
     FfxFloat32x3 c;
-    FsrRcasF(c.r, c.g, c.b, pos, RCASConfig());
+    // the taps are loaded from the tile or without an offset
+    FsrRcasF(c.r, c.g, c.b, pos, ComputeRcasConfig((FfxFloat32x2(pos) + 0.5f) / FfxFloat32x2(DisplaySize())), MakeRcasLoadParameter(FfxUInt32x2(pos), FfxFloat32x2(0.0f, 0.0f)));
 
     c = UnprepareRgb(c, Exposure());
 
+    if (FFX_FSR2_ALPHA_UPSCALING) {
+        // alpha is passed through unsharpened, sharpening coverage would overshoot into halos along its edges
+        StoreUpscaledOutputWithAlpha(FFX_MIN16_I2(pos), EncodeOutput(c), LoadRCAS_InputAlpha(FFX_MIN16_I2(pos)));
+        return;
+    }
     WriteUpscaledOutput(pos, c);
 }
 
 void RCAS(FfxUInt32x3 LocalThreadId, FfxUInt32x3 WorkGroupId, FfxUInt32x3 Dtid)
 {
+    if (UseRcasTile()) {
+        LoadRcasTile(LocalThreadId.x, WorkGroupId.xy);
+    }
+    FFX_GROUP_MEMORY_BARRIER();
+
     // Do remapping of local xy in workgroup for a more PS-like swizzle pattern.
     FfxUInt32x2 gxy = ffxRemapForQuad(LocalThreadId.x) + FfxUInt32x2(WorkGroupId.x << 4u, WorkGroupId.y << 4u);
     CurrFilter(FFX_MIN16_U2(gxy));
@@ -31,6 +31,9 @@
 #define FSR2_BIND_UAV_UPSCALED_OUTPUT       2
 #define FSR2_BIND_CB_FSR2                   3
 #define FSR2_BIND_CB_RCAS                   4
+#define FSR2_BIND_SRV_SHARPNESS_MAP         6
+#define FSR2_BIND_SRV_DILATED_DEPTH         7
+#define FSR2_BIND_SRV_RCAS_INPUT_ALPHA      5
 
 #include "ffx_fsr2_callbacks_glsl.h"
 #include "ffx_fsr2_common.h"
@@ -55,9 +58,47 @@
 
 vec4 LoadRCAS_Input(FfxInt32x2 iPxPos)
 {
+#if FFX_FSR2_OPTION_PACKED_LOCK_STATUS
+    if (FFX_FSR2_PACKED_LOCK_STATUS) {
+        // The upscaled color shares its surface with the lock status, only the color is sharpened
+        return UnpackHistory(texelFetch(r_rcas_input, iPxPos, 0));
+    }
+#endif
     return texelFetch(r_rcas_input, iPxPos, 0);
 }
 
+float LoadRCAS_InputAlpha(FfxInt32x2 iPxPos)
+{
+    return texelFetch(r_rcas_input_alpha, iPxPos, 0).r;
+}
+
+vec4 SampleRCAS_Input(FfxFloat32x2 fUv)
+{
+#if FFX_FSR2_OPTION_PACKED_LOCK_STATUS
+    if (FFX_FSR2_PACKED_LOCK_STATUS) {
+        // Filtering the packed codes would blend their bit fields, the four taps are unpacked before they are weighted
+        const FfxFloat32x2 fPxPos = fUv * FfxFloat32x2(DisplaySize()) - 0.5f;
+        const FfxFloat32x2 fPxBase = floor(fPxPos);
+        const FfxFloat32x2 fWeight = fPxPos - fPxBase;
+        const FfxInt32x2 iPxBase = FfxInt32x2(fPxBase);
+        const FfxInt32x2 iPxMax = DisplaySize() - FfxInt32x2(1, 1);
+
+        const FfxFloat32x4 fTop = ffxLerp(LoadRCAS_Input(clamp(iPxBase, FfxInt32x2(0, 0), iPxMax)),
+            LoadRCAS_Input(clamp(iPxBase + FfxInt32x2(1, 0), FfxInt32x2(0, 0), iPxMax)), fWeight.x);
+        const FfxFloat32x4 fBottom = ffxLerp(LoadRCAS_Input(clamp(iPxBase + FfxInt32x2(0, 1), FfxInt32x2(0, 0), iPxMax)),
+            LoadRCAS_Input(clamp(iPxBase + FfxInt32x2(1, 1), FfxInt32x2(0, 0), iPxMax)), fWeight.x);
+
+        return ffxLerp(fTop, fBottom, fWeight.y);
+    }
+#endif
+    return textureLod(sampler2D(r_rcas_input, s_LinearClamp), fUv, 0.0f);
+}
+
+float SampleRCAS_InputAlpha(FfxFloat32x2 fUv)
+{
+    return textureLod(sampler2D(r_rcas_input_alpha, s_LinearClamp), fUv, 0.0f).r;
+}
+
 #include "ffx_fsr2_rcas.h"
 
 #ifndef FFX_FSR2_THREAD_GROUP_WIDTH
@@ -22,6 +22,10 @@
 #ifndef FFX_FSR2_RECONSTRUCT_DILATED_VELOCITY_AND_PREVIOUS_DEPTH_H
 #define FFX_FSR2_RECONSTRUCT_DILATED_VELOCITY_AND_PREVIOUS_DEPTH_H
 
+#ifndef FFX_FSR2_OPTION_MOTION_VECTOR_DILATION
+#define FFX_FSR2_OPTION_MOTION_VECTOR_DILATION FFX_FSR2_MOTION_VECTOR_DILATION_NEAREST_DEPTH_3X3
+#endif
+
 void ReconstructPrevDepth(FfxInt32x2 iPxPos, FfxFloat32 fDepth, FfxFloat32x2 fMotionVector, FfxInt32x2 iPxDepthSize)
 {
     fMotionVector *= FfxFloat32(length(fMotionVector * DisplaySize()) > 0.1f);
@@ -48,6 +52,11 @@ void ReconstructPrevDepth(FfxInt32x2 iPxPos, FfxFloat32 fDepth, FfxFloat32x2 fMo
     }
 }
 
+FfxBoolean IsNearerDepth(FfxFloat32 fDepth, FfxFloat32 fReferenceDepth)
+{
+    return FFX_FSR2_INVERTED_DEPTH ? fDepth > fReferenceDepth : fDepth < fReferenceDepth;
+}
+
 void FindNearestDepth(FFX_PARAMETER_IN FfxInt32x2 iPxPos, FFX_PARAMETER_IN FfxInt32x2 iPxSize, FFX_PARAMETER_OUT FfxFloat32 fNearestDepth, FFX_PARAMETER_OUT FfxInt32x2 fNearestDepthCoord)
 {
     const FfxInt32 iSampleCount = 9;
@@ -83,11 +92,7 @@ void FindNearestDepth(FFX_PARAMETER_IN FfxInt32x2 iPxPos, FFX_PARAMETER_IN FfxIn
         if (IsOnScreen(iPos, iPxSize)) {
 
             FfxFloat32 fNdDepth = depth[iSampleIndex];
-#if FFX_FSR2_OPTION_INVERTED_DEPTH
-            if (fNdDepth > fNearestDepth) {
-#else
-            if (fNdDepth < fNearestDepth) {
-#endif
+            if (IsNearerDepth(fNdDepth, fNearestDepth)) {
                 fNearestDepthCoord = iPos;
                 fNearestDepth = fNdDepth;
             }
@@ -95,6 +100,109 @@ void FindNearestDepth(FFX_PARAMETER_IN FfxInt32x2 iPxPos, FFX_PARAMETER_IN FfxIn
     }
 }
 
+void FindNearestDepth5x5(FFX_PARAMETER_IN FfxInt32x2 iPxPos, FFX_PARAMETER_IN FfxInt32x2 iPxSize, FFX_PARAMETER_OUT FfxFloat32 fNearestDepth, FFX_PARAMETER_OUT FfxInt32x2 fNearestDepthCoord)
+{
+    fNearestDepthCoord = iPxPos;
+    fNearestDepth = LoadInputDepth(iPxPos);
+
+    FFX_UNROLL
+    for (FfxInt32 y = -2; y <= 2; ++y) {
+        FFX_UNROLL
+        for (FfxInt32 x = -2; x <= 2; ++x) {
+
+            FfxInt32x2 iPos = iPxPos + FfxInt32x2(x, y);
+            if ((x != 0 || y != 0) && IsOnScreen(iPos, iPxSize)) {
+
+                FfxFloat32 fNdDepth = LoadInputDepth(iPos);
+                if (IsNearerDepth(fNdDepth, fNearestDepth)) {
+                    fNearestDepthCoord = iPos;
+                    fNearestDepth = fNdDepth;
+                }
+            }
+        }
+    }
+}
+
+FfxInt32x2 ComputeMotionVectorPos(FfxInt32x2 iPxLrPos)
+{
+    return FFX_FSR2_LOW_RESOLUTION_MOTION_VECTORS ? iPxLrPos : ComputeHrPosFromLrPos(iPxLrPos);
+}
+
+#if FFX_FSR2_OPTION_MOTION_VECTOR_DILATION == FFX_FSR2_MOTION_VECTOR_DILATION_MAX_VELOCITY
+// The 8x8 pixels of a thread group plus a border of 2, the squared velocity of every pixel is loaded once
+#define MAX_VELOCITY_GROUP_SIZE 8
+#define MAX_VELOCITY_TILE_SIZE  12
+FFX_GROUPSHARED FfxFloat32 fMaxVelocityTileSq[MAX_VELOCITY_TILE_SIZE][MAX_VELOCITY_TILE_SIZE];
+
+// The result of the horizontal pass for each row of the tile and column of the group, and its column in the tile
+FFX_GROUPSHARED FfxFloat32 fMaxVelocityRowSq[MAX_VELOCITY_TILE_SIZE][MAX_VELOCITY_GROUP_SIZE];
+FFX_GROUPSHARED FfxInt32 iMaxVelocityRowX[MAX_VELOCITY_TILE_SIZE][MAX_VELOCITY_GROUP_SIZE];
+
+// Picks the longest motion vector in the 5x5 neighborhood with a separable max filter, first along the rows of
+// the tile and then down the columns of the row maxima. Both passes start from the center and only move on a
+// strictly longer vector, so the pixel itself wins any tie. Must be called by every thread of the 8x8 group.
+void FindMaxVelocity(FFX_PARAMETER_IN FfxInt32x2 iPxPos, FFX_PARAMETER_IN FfxInt32x2 iGroupThreadPos, FFX_PARAMETER_IN FfxInt32x2 iPxSize, FFX_PARAMETER_OUT FfxFloat32 fDepth, FFX_PARAMETER_OUT FfxInt32x2 fMaxVelocityCoord)
+{
+    const FfxInt32x2 iTileOrigin = iPxPos - iGroupThreadPos - FfxInt32x2(2, 2);
+    const FfxInt32 iThreadIndex = iGroupThreadPos.y * MAX_VELOCITY_GROUP_SIZE + iGroupThreadPos.x;
+    const FfxInt32 iThreadCount = MAX_VELOCITY_GROUP_SIZE * MAX_VELOCITY_GROUP_SIZE;
+
+    // Off screen pixels are never picked
+    for (FfxInt32 i = iThreadIndex; i < MAX_VELOCITY_TILE_SIZE * MAX_VELOCITY_TILE_SIZE; i += iThreadCount) {
+
+        const FfxInt32x2 iTilePos = FfxInt32x2(i % MAX_VELOCITY_TILE_SIZE, i / MAX_VELOCITY_TILE_SIZE);
+        const FfxInt32x2 iPos = iTileOrigin + iTilePos;
+
+        FfxFloat32 fVelocitySq = -1.0f;
+        if (IsOnScreen(iPos, iPxSize)) {
+            const FfxFloat32x2 fMotionVector = LoadInputMotionVector(ComputeMotionVectorPos(iPos));
+            fVelocitySq = dot(fMotionVector, fMotionVector);
+        }
+        fMaxVelocityTileSq[iTilePos.y][iTilePos.x] = fVelocitySq;
+    }
+
+    FFX_GROUP_MEMORY_BARRIER();
+
+    for (FfxInt32 i = iThreadIndex; i < MAX_VELOCITY_TILE_SIZE * MAX_VELOCITY_GROUP_SIZE; i += iThreadCount) {
+
+        const FfxInt32 iRow = i / MAX_VELOCITY_GROUP_SIZE;
+        const FfxInt32 iColumn = i % MAX_VELOCITY_GROUP_SIZE;
+
+        FfxInt32 iMaxX = iColumn + 2;
+        FfxFloat32 fMaxVelocitySq = fMaxVelocityTileSq[iRow][iMaxX];
+        FFX_UNROLL
+        for (FfxInt32 x = 0; x < 5; ++x) {
+
+            const FfxFloat32 fVelocitySq = fMaxVelocityTileSq[iRow][iColumn + x];
+            if (fVelocitySq > fMaxVelocitySq) {
+                iMaxX = iColumn + x;
+                fMaxVelocitySq = fVelocitySq;
+            }
+        }
+
+        fMaxVelocityRowSq[iRow][iColumn] = fMaxVelocitySq;
+        iMaxVelocityRowX[iRow][iColumn] = iMaxX;
+    }
+
+    FFX_GROUP_MEMORY_BARRIER();
+
+    FfxInt32 iMaxY = iGroupThreadPos.y + 2;
+    FfxFloat32 fMaxVelocitySq = fMaxVelocityRowSq[iMaxY][iGroupThreadPos.x];
+    FFX_UNROLL
+    for (FfxInt32 y = 0; y < 5; ++y) {
+
+        const FfxFloat32 fVelocitySq = fMaxVelocityRowSq[iGroupThreadPos.y + y][iGroupThreadPos.x];
+        if (fVelocitySq > fMaxVelocitySq) {
+            iMaxY = iGroupThreadPos.y + y;
+            fMaxVelocitySq = fVelocitySq;
+        }
+    }
+
+    fMaxVelocityCoord = iTileOrigin + FfxInt32x2(iMaxVelocityRowX[iMaxY][iGroupThreadPos.x], iMaxY);
+    fDepth = LoadInputDepth(fMaxVelocityCoord);
+}
+#endif
+
 FfxFloat32 ComputeLockInputLuma(FfxInt32x2 iPxLrPos)
 {
     //We assume linear data. if non-linear input (sRGB, ...),
@@ -105,9 +213,9 @@ FfxFloat32 ComputeLockInputLuma(FfxInt32x2 iPxLrPos)
     fRgb /= PreExposure();
     fRgb *= Exposure();
 
-#if FFX_FSR2_OPTION_HDR_COLOR_INPUT
-    fRgb = Tonemap(fRgb);
-#endif
+    if (FFX_FSR2_HDR_COLOR_INPUT) {
+        fRgb = Tonemap(fRgb);
+    }
 
     //compute luma used to lock pixels, if used elsewhere the ffxPow must be moved!
     const FfxFloat32 fLockInputLuma = ffxPow(RGBToPerceivedLuma(fRgb), FfxFloat32(1.0 / 6.0));
@@ -115,21 +223,24 @@ FfxFloat32 ComputeLockInputLuma(FfxInt32x2 iPxLrPos)
     return fLockInputLuma;
 }
 
-void ReconstructAndDilate(FfxInt32x2 iPxLrPos)
+void ReconstructAndDilate(FfxInt32x2 iPxLrPos, FfxInt32x2 iGroupThreadPos)
 {
     FfxFloat32 fDilatedDepth;
     FfxInt32x2 iNearestDepthCoord;
 
-    FindNearestDepth(iPxLrPos, RenderSize(), fDilatedDepth, iNearestDepthCoord);
-
-#if FFX_FSR2_OPTION_LOW_RESOLUTION_MOTION_VECTORS
-    FfxInt32x2 iSamplePos = iPxLrPos;
-    FfxInt32x2 iMotionVectorPos = iNearestDepthCoord;
+#if FFX_FSR2_OPTION_MOTION_VECTOR_DILATION == FFX_FSR2_MOTION_VECTOR_DILATION_NONE
+    fDilatedDepth = LoadInputDepth(iPxLrPos);
+    iNearestDepthCoord = iPxLrPos;
+#elif FFX_FSR2_OPTION_MOTION_VECTOR_DILATION == FFX_FSR2_MOTION_VECTOR_DILATION_NEAREST_DEPTH_5X5
+    FindNearestDepth5x5(iPxLrPos, RenderSize(), fDilatedDepth, iNearestDepthCoord);
+#elif FFX_FSR2_OPTION_MOTION_VECTOR_DILATION == FFX_FSR2_MOTION_VECTOR_DILATION_MAX_VELOCITY
+    FindMaxVelocity(iPxLrPos, iGroupThreadPos, RenderSize(), fDilatedDepth, iNearestDepthCoord);
 #else
-    FfxInt32x2 iSamplePos = ComputeHrPosFromLrPos(iPxLrPos);
-    FfxInt32x2 iMotionVectorPos = ComputeHrPosFromLrPos(iNearestDepthCoord);
+    FindNearestDepth(iPxLrPos, RenderSize(), fDilatedDepth, iNearestDepthCoord);
 #endif
 
+    FfxInt32x2 iMotionVectorPos = ComputeMotionVectorPos(iNearestDepthCoord);
+
     FfxFloat32x2 fDilatedMotionVector = LoadInputMotionVector(iMotionVectorPos);
 
     StoreDilatedDepth(iPxLrPos, fDilatedDepth);
@@ -61,5 +61,5 @@
 FFX_FSR2_NUM_THREADS
 void main()
 {
-	ReconstructAndDilate(FFX_MIN16_I2(gl_GlobalInvocationID.xy));
+	ReconstructAndDilate(FFX_MIN16_I2(gl_GlobalInvocationID.xy), FFX_MIN16_I2(gl_LocalInvocationID.xy));
 }
@@ -59,5 +59,5 @@ void CS(
     int iGroupIndex : SV_GroupIndex
 )
 {
-    ReconstructAndDilate(iDispatchThreadId);
+    ReconstructAndDilate(iDispatchThreadId, iGroupThreadId);
 }
@@ -26,14 +26,34 @@
 #define FFX_FSR2_OPTION_REPROJECT_USE_LANCZOS_TYPE 0 // Reference
 #endif
 
+#if FFX_FSR2_OPTION_UBER
+#define FFX_FSR2_REPROJECT_LANCZOS_TYPE UBER
+#else
+#define FFX_FSR2_REPROJECT_LANCZOS_TYPE FFX_FSR2_OPTION_REPROJECT_USE_LANCZOS_TYPE
+#endif
+
+#ifndef FFX_FSR2_OPTION_PACKED_LOCK_STATUS
+#define FFX_FSR2_OPTION_PACKED_LOCK_STATUS 0
+#endif
+
 FfxFloat32x4 WrapHistory(FfxInt32x2 iPxSample)
 {
+#if FFX_FSR2_OPTION_PACKED_LOCK_STATUS
+    if (FFX_FSR2_PACKED_LOCK_STATUS) {
+        return UnpackHistory(LoadHistory(iPxSample));
+    }
+#endif
     return LoadHistory(iPxSample);
 }
 
 #if FFX_HALF
 FFX_MIN16_F4 WrapHistory(FFX_MIN16_I2 iPxSample)
 {
+#if FFX_FSR2_OPTION_PACKED_LOCK_STATUS
+    if (FFX_FSR2_PACKED_LOCK_STATUS) {
+        return FFX_MIN16_F4(UnpackHistory(LoadHistory(iPxSample)));
+    }
+#endif
     return FFX_MIN16_F4(LoadHistory(iPxSample));
 }
 #endif
@@ -41,14 +61,60 @@ FFX_MIN16_F4 WrapHistory(FFX_MIN16_I2 iPxSample)
 
 #if FFX_FSR2_OPTION_REPROJECT_SAMPLERS_USE_DATA_HALF && FFX_HALF
 DeclareCustomFetchBicubicSamplesMin16(FetchHistorySamples, WrapHistory)
-DeclareCustomTextureSampleMin16(HistorySample, FFX_FSR2_GET_LANCZOS_SAMPLER1D(FFX_FSR2_OPTION_REPROJECT_USE_LANCZOS_TYPE), FetchHistorySamples)
+DeclareCustomTextureSampleMin16(HistorySample, FFX_FSR2_GET_LANCZOS_SAMPLER1D(FFX_FSR2_REPROJECT_LANCZOS_TYPE), FetchHistorySamples)
 #else
 DeclareCustomFetchBicubicSamples(FetchHistorySamples, WrapHistory)
-DeclareCustomTextureSample(HistorySample, FFX_FSR2_GET_LANCZOS_SAMPLER1D(FFX_FSR2_OPTION_REPROJECT_USE_LANCZOS_TYPE), FetchHistorySamples)
+DeclareCustomTextureSample(HistorySample, FFX_FSR2_GET_LANCZOS_SAMPLER1D(FFX_FSR2_REPROJECT_LANCZOS_TYPE), FetchHistorySamples)
 #endif
 
+// Catmull-Rom through 5 bilinear taps instead of 16 texel fetches: the two middle texels of each axis are folded into one
+// tap at their weighted position and the corners of the 4x4 footprint, whose weights are small, are dropped.
+// Clamping to the range of the folded taps would blur fine detail, so there is no deringing step like in the Lanczos path.
+FfxFloat32x4 HistorySampleCatmullRom(FfxFloat32x2 fUvSample, FfxInt32x2 iTextureSize)
+{
+    const FfxFloat32x2 fTextureSize = FfxFloat32x2(iTextureSize);
+    const FfxFloat32x2 fPxSample = fUvSample * fTextureSize - FfxFloat32x2(0.5f, 0.5f);
+    const FfxFloat32x2 fPxBase = floor(fPxSample);
+    const FfxFloat32x2 t = fPxSample - fPxBase;
+
+    const FfxFloat32x2 fWeight0 = t * (-0.5f + t * (1.0f - 0.5f * t));
+    const FfxFloat32x2 fWeight1 = 1.0f + t * t * (-2.5f + 1.5f * t);
+    const FfxFloat32x2 fWeight2 = t * (0.5f + t * (2.0f - 1.5f * t));
+    const FfxFloat32x2 fWeight3 = t * t * (-0.5f + 0.5f * t);
+    const FfxFloat32x2 fWeight12 = fWeight1 + fWeight2;
+
+    const FfxFloat32x2 fUv0 = (fPxBase - 0.5f) / fTextureSize;
+    const FfxFloat32x2 fUv12 = (fPxBase + 0.5f + fWeight2 / fWeight12) / fTextureSize;
+    const FfxFloat32x2 fUv3 = (fPxBase + 2.5f) / fTextureSize;
+
+    const FfxFloat32x4 fTop = SampleHistory(FfxFloat32x2(fUv12.x, fUv0.y));
+    const FfxFloat32x4 fLeft = SampleHistory(FfxFloat32x2(fUv0.x, fUv12.y));
+    const FfxFloat32x4 fCenter = SampleHistory(fUv12);
+    const FfxFloat32x4 fRight = SampleHistory(FfxFloat32x2(fUv3.x, fUv12.y));
+    const FfxFloat32x4 fBottom = SampleHistory(FfxFloat32x2(fUv12.x, fUv3.y));
+
+    const FfxFloat32 fTopWeight = fWeight12.x * fWeight0.y;
+    const FfxFloat32 fLeftWeight = fWeight0.x * fWeight12.y;
+    const FfxFloat32 fCenterWeight = fWeight12.x * fWeight12.y;
+    const FfxFloat32 fRightWeight = fWeight3.x * fWeight12.y;
+    const FfxFloat32 fBottomWeight = fWeight12.x * fWeight3.y;
+
+    const FfxFloat32 fWeightSum = fTopWeight + fLeftWeight + fCenterWeight + fRightWeight + fBottomWeight;
+    FfxFloat32x4 fColor = (fTop * fTopWeight + fLeft * fLeftWeight + fCenter * fCenterWeight + fRight * fRightWeight + fBottom * fBottomWeight) / fWeightSum;
+
+    // Only the negative lobes are removed here, overshoot above the neighbourhood is left to RectifyHistory.
+    fColor.rgb = ffxMax(FfxFloat32x3(0.0f, 0.0f, 0.0f), fColor.rgb);
+
+    return fColor;
+}
+
 FfxFloat32x4 WrapLockStatus(FfxInt32x2 iPxSample)
 {
+#if FFX_FSR2_OPTION_PACKED_LOCK_STATUS
+    if (FFX_FSR2_PACKED_LOCK_STATUS) {
+        return FfxFloat32x4(UnpackLockStatus(LoadHistory(iPxSample)), 0.0f, 0.0f);
+    }
+#endif
     FfxFloat32x4 fSample = FfxFloat32x4(LoadLockStatus(iPxSample), 0.0f, 0.0f);
     return fSample;
 }
@@ -56,6 +122,11 @@ FfxFloat32x4 WrapLockStatus(FfxInt32x2 iPxSample)
 #if FFX_HALF
 FFX_MIN16_F4 WrapLockStatus(FFX_MIN16_I2 iPxSample)
 {
+#if FFX_FSR2_OPTION_PACKED_LOCK_STATUS
+    if (FFX_FSR2_PACKED_LOCK_STATUS) {
+        return FFX_MIN16_F4(UnpackLockStatus(LoadHistory(iPxSample)), 0.0, 0.0);
+    }
+#endif
     FFX_MIN16_F4 fSample = FFX_MIN16_F4(LoadLockStatus(iPxSample), 0.0, 0.0);
 
     return fSample;
@@ -73,16 +144,24 @@ DeclareCustomTextureSample(LockStatusSample, Bilinear, FetchLockStatusSamples)
 #else
 #if FFX_FSR2_OPTION_REPROJECT_SAMPLERS_USE_DATA_HALF && FFX_HALF
 DeclareCustomFetchBicubicSamplesMin16(FetchLockStatusSamples, WrapLockStatus)
-DeclareCustomTextureSampleMin16(LockStatusSample, FFX_FSR2_GET_LANCZOS_SAMPLER1D(FFX_FSR2_OPTION_REPROJECT_USE_LANCZOS_TYPE), FetchLockStatusSamples)
+DeclareCustomTextureSampleMin16(LockStatusSample, FFX_FSR2_GET_LANCZOS_SAMPLER1D(FFX_FSR2_REPROJECT_LANCZOS_TYPE), FetchLockStatusSamples)
 #else
 DeclareCustomFetchBicubicSamples(FetchLockStatusSamples, WrapLockStatus)
-DeclareCustomTextureSample(LockStatusSample, FFX_FSR2_GET_LANCZOS_SAMPLER1D(FFX_FSR2_OPTION_REPROJECT_USE_LANCZOS_TYPE), FetchLockStatusSamples)
+DeclareCustomTextureSample(LockStatusSample, FFX_FSR2_GET_LANCZOS_SAMPLER1D(FFX_FSR2_REPROJECT_LANCZOS_TYPE), FetchLockStatusSamples)
 #endif
 #endif
 
 FfxFloat32x2 GetMotionVector(FfxInt32x2 iPxHrPos, FfxFloat32x2 fHrUv)
 {
-#if FFX_FSR2_OPTION_LOW_RESOLUTION_MOTION_VECTORS
+#if FFX_FSR2_OPTION_UBER
+    // the uber accumulate pass binds both motion vector sources, a branch rather than a select fetches only one
+    FfxFloat32x2 fDilatedMotionVector;
+    if (FFX_FSR2_LOW_RESOLUTION_MOTION_VECTORS) {
+        fDilatedMotionVector = LoadDilatedMotionVector(FFX_MIN16_I2(fHrUv * RenderSize()));
+    } else {
+        fDilatedMotionVector = LoadInputMotionVector(iPxHrPos);
+    }
+#elif FFX_FSR2_OPTION_LOW_RESOLUTION_MOTION_VECTORS
     FfxFloat32x2 fDilatedMotionVector = LoadDilatedMotionVector(FFX_MIN16_I2(fHrUv * RenderSize()));
 #else
     FfxFloat32x2 fDilatedMotionVector = LoadInputMotionVector(iPxHrPos);
@@ -105,7 +184,13 @@ void ComputeReprojectedUVs(const AccumulationPassCommonParams params, FFX_PARAME
 
 void ReprojectHistoryColor(const AccumulationPassCommonParams params, FFX_PARAMETER_OUT FfxFloat32x3 fHistoryColor, FFX_PARAMETER_OUT FfxFloat32 fTemporalReactiveFactor, FFX_PARAMETER_OUT FfxBoolean bInMotionLastFrame)
 {
-    FfxFloat32x4 fHistory = HistorySample(params.fReprojectedHrUv, DisplaySize());
+    FfxFloat32x4 fHistory;
+    // The packed history can't be filtered by the sampler, so it is always reprojected with Lanczos
+    if (FFX_FSR2_REPROJECT_CATMULL_ROM && !FFX_FSR2_PACKED_LOCK_STATUS) {
+        fHistory = HistorySampleCatmullRom(params.fReprojectedHrUv, DisplaySize());
+    } else {
+        fHistory = HistorySample(params.fReprojectedHrUv, DisplaySize());
+    }
 
     fHistoryColor = PrepareRgb(fHistory.rgb, Exposure(), PreviousFramePreExposure());
 
@@ -124,7 +209,15 @@ LockState ReprojectHistoryLockStatus(const AccumulationPassCommonParams params,
 
     FfxFloat32 fInPlaceLockLifetime = state.NewLock ? fNewLockIntensity : 0;
 
-    fReprojectedLockStatus = SampleLockStatus(params.fReprojectedHrUv);
+#if FFX_FSR2_OPTION_PACKED_LOCK_STATUS
+    if (FFX_FSR2_PACKED_LOCK_STATUS) {
+        // bilinear over the 2x2 center of the history footprint, which the color reprojection has just fetched.
+        fReprojectedLockStatus = FfxFloat32x2(LockStatusSample(params.fReprojectedHrUv, DisplaySize()).xy);
+    } else
+#endif
+    {
+        fReprojectedLockStatus = SampleLockStatus(params.fReprojectedHrUv);
+    }
 
     if (fReprojectedLockStatus[LOCK_LIFETIME_REMAINING] != FfxFloat32(0.0f)) {
         state.WasLockedPrevFrame = true;
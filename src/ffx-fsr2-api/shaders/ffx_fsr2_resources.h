@@ -83,12 +83,26 @@
 #define FFX_FSR2_RESOURCE_IDENTIFIER_LUMA_HISTORY_1                                 55
 #define FFX_FSR2_RESOURCE_IDENTIFIER_LUMA_HISTORY_2                                 56
 #define FFX_FSR2_RESOURCE_IDENTIFIER_LOCK_INPUT_LUMA                                57
+#define FFX_FSR2_RESOURCE_IDENTIFIER_INPUT_HISTORY_INVALIDATION_MASK                58
+#define FFX_FSR2_RESOURCE_IDENTIFIER_EXPOSURE_HISTOGRAM                             59
+#define FFX_FSR2_RESOURCE_IDENTIFIER_UPSCALED_DEPTH_OUTPUT                          60
+#define FFX_FSR2_RESOURCE_IDENTIFIER_UPSCALED_MOTION_VECTOR_OUTPUT                  61
+#define FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_UPSCALED_ALPHA                        62
+#define FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_UPSCALED_ALPHA_1                      63
+#define FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_UPSCALED_ALPHA_2                      64
+#define FFX_FSR2_RESOURCE_IDENTIFIER_RCAS_INPUT_ALPHA                               65
+#define FFX_FSR2_RESOURCE_IDENTIFIER_INPUT_SHARPNESS_MAP                            66
+#define FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_DEFAULT_SHARPNESS                     67
+#define FFX_FSR2_RESOURCE_IDENTIFIER_INPUT_MATERIAL_ID                              68
+#define FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_MATERIAL_REACTIVITY_TABLE             69
+#define FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_DEFAULT_UPSCALED_DEPTH_OUTPUT         70
+#define FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_DEFAULT_UPSCALED_MOTION_VECTOR_OUTPUT 71
 
 // Shading change detection mip level setting, value must be in the range [FFX_FSR2_RESOURCE_IDENTIFIER_SCENE_LUMINANCE_MIPMAP_0, FFX_FSR2_RESOURCE_IDENTIFIER_SCENE_LUMINANCE_MIPMAP_12]
 #define FFX_FSR2_RESOURCE_IDENTIFIER_SCENE_LUMINANCE_MIPMAP_SHADING_CHANGE          FFX_FSR2_RESOURCE_IDENTIFIER_SCENE_LUMINANCE_MIPMAP_4
 #define FFX_FSR2_SHADING_CHANGE_MIP_LEVEL                                           (FFX_FSR2_RESOURCE_IDENTIFIER_SCENE_LUMINANCE_MIPMAP_SHADING_CHANGE - FFX_FSR2_RESOURCE_IDENTIFIER_SCENE_LUMINANCE)
 
-#define FFX_FSR2_RESOURCE_IDENTIFIER_COUNT                                          58
+#define FFX_FSR2_RESOURCE_IDENTIFIER_COUNT                                          72
 
 #define FFX_FSR2_CONSTANTBUFFER_IDENTIFIER_FSR2                                     0
 #define FFX_FSR2_CONSTANTBUFFER_IDENTIFIER_SPD                                      1
@@ -100,6 +114,88 @@
 #define FFX_FSR2_AUTOREACTIVEFLAGS_APPLY_THRESHOLD                                  4
 #define FFX_FSR2_AUTOREACTIVEFLAGS_USE_COMPONENTS_MAX                               8
 
+#define FFX_FSR2_MOTION_VECTOR_DILATION_NEAREST_DEPTH_3X3                           0
+#define FFX_FSR2_MOTION_VECTOR_DILATION_NONE                                        1
+#define FFX_FSR2_MOTION_VECTOR_DILATION_NEAREST_DEPTH_5X5                           2
+#define FFX_FSR2_MOTION_VECTOR_DILATION_MAX_VELOCITY                                3
+
+#define FFX_FSR2_AUTO_EXPOSURE_AVERAGE                                              0
+#define FFX_FSR2_AUTO_EXPOSURE_HISTOGRAM                                            1
+
+#define FFX_FSR2_DEBUGVIEW_NONE                                                     0
+#define FFX_FSR2_DEBUGVIEW_DILATED_MOTION_VECTORS                                   1
+#define FFX_FSR2_DEBUGVIEW_DEPTH_CLIP                                               2
+#define FFX_FSR2_DEBUGVIEW_LOCK_STATUS                                              3
+#define FFX_FSR2_DEBUGVIEW_REACTIVE_MASKS                                           4
+#define FFX_FSR2_DEBUGVIEW_TEMPORAL_REACTIVE_FACTOR                                 5
+#define FFX_FSR2_DEBUGVIEW_ACCUMULATION_WEIGHT                                      6
+#define FFX_FSR2_DEBUGVIEW_LUMA_INSTABILITY                                         7
+#define FFX_FSR2_DEBUGVIEW_TILED                                                    8
+
+#define FFX_FSR2_OUTPUTENCODING_LINEAR                                              0
+#define FFX_FSR2_OUTPUTENCODING_PQ_BT2020                                           1
+#define FFX_FSR2_OUTPUTENCODING_SCRGB                                               2
+
+// Permutation switches read from cbFSR2, all of them by the uber shaders (FFX_FSR2_OPTION_UBER), the per-pass options by every build
+#define FFX_FSR2_PERMUTATION_OPTION_REPROJECT_USE_LANCZOS_LUT                       1
+#define FFX_FSR2_PERMUTATION_OPTION_HDR_COLOR_INPUT                                 2
+#define FFX_FSR2_PERMUTATION_OPTION_LOW_RESOLUTION_MOTION_VECTORS                   4
+#define FFX_FSR2_PERMUTATION_OPTION_JITTERED_MOTION_VECTORS                         8
+#define FFX_FSR2_PERMUTATION_OPTION_INVERTED_DEPTH                                  16
+#define FFX_FSR2_PERMUTATION_OPTION_APPLY_SHARPENING                                32
+#define FFX_FSR2_PERMUTATION_OPTION_REPROJECT_CATMULL_ROM                           64
+#define FFX_FSR2_PERMUTATION_OPTION_PACKED_LOCK_STATUS                              128
+#define FFX_FSR2_PERMUTATION_OPTION_UPSCALED_DEPTH_OUTPUT                           256
+#define FFX_FSR2_PERMUTATION_OPTION_UPSCALED_MOTION_VECTOR_OUTPUT                   512
+#define FFX_FSR2_PERMUTATION_OPTION_ALPHA_UPSCALING                                 1024
+#define FFX_FSR2_PERMUTATION_OPTION_OUTPUT_ENCODING_SHIFT                           11 // 2 bits, one of FFX_FSR2_OUTPUTENCODING_*
+#define FFX_FSR2_PERMUTATION_OPTION_LENS_DISTORTION                                 8192
+#define FFX_FSR2_PERMUTATION_OPTION_RCAS_GROUPSHARED                                16384
+
+// RCAS config flags, stored in the z component of cbRCAS, the w component holds the depth edge threshold
+#define FFX_FSR2_RCAS_CONFIG_DENOISE                                                1
+
+// Log2 luminance histogram used by FFX_FSR2_AUTO_EXPOSURE_HISTOGRAM, bins are half a stop wide
+#define FFX_FSR2_EXPOSURE_HISTOGRAM_BIN_COUNT                                       64
+#define FFX_FSR2_EXPOSURE_HISTOGRAM_MIN_LOG2_LUMA                                   (-16.0f)
+#define FFX_FSR2_EXPOSURE_HISTOGRAM_MAX_LOG2_LUMA                                   (16.0f)
+
+// Width of the material reactivity table, material IDs at or past it map to 0
+#define FFX_FSR2_MATERIAL_REACTIVITY_TABLE_SIZE                                     256
+
 #endif // #if defined(FFX_CPU) || defined(FFX_GPU)
 
+#if defined(FFX_GPU)
+// Permutation switches. Specialized permutations fold these at compile time, the uber shaders
+// (FFX_FSR2_OPTION_UBER) read them from cbFSR2 and branch uniformly.
+#define FFX_FSR2_PERMUTATION_OPTION(x) ((PermutationOptions() & FfxUInt32(x)) != FfxUInt32(0))
+#if FFX_FSR2_OPTION_UBER
+#define FFX_FSR2_REPROJECT_USE_LANCZOS_LUT                                          FFX_FSR2_PERMUTATION_OPTION(FFX_FSR2_PERMUTATION_OPTION_REPROJECT_USE_LANCZOS_LUT)
+#define FFX_FSR2_HDR_COLOR_INPUT                                                    FFX_FSR2_PERMUTATION_OPTION(FFX_FSR2_PERMUTATION_OPTION_HDR_COLOR_INPUT)
+#define FFX_FSR2_LOW_RESOLUTION_MOTION_VECTORS                                      FFX_FSR2_PERMUTATION_OPTION(FFX_FSR2_PERMUTATION_OPTION_LOW_RESOLUTION_MOTION_VECTORS)
+#define FFX_FSR2_JITTERED_MOTION_VECTORS                                            FFX_FSR2_PERMUTATION_OPTION(FFX_FSR2_PERMUTATION_OPTION_JITTERED_MOTION_VECTORS)
+#define FFX_FSR2_INVERTED_DEPTH                                                     FFX_FSR2_PERMUTATION_OPTION(FFX_FSR2_PERMUTATION_OPTION_INVERTED_DEPTH)
+#define FFX_FSR2_APPLY_SHARPENING                                                   FFX_FSR2_PERMUTATION_OPTION(FFX_FSR2_PERMUTATION_OPTION_APPLY_SHARPENING)
+#define FFX_FSR2_PACKED_LOCK_STATUS                                                 FFX_FSR2_PERMUTATION_OPTION(FFX_FSR2_PERMUTATION_OPTION_PACKED_LOCK_STATUS)
+#else
+#define FFX_FSR2_REPROJECT_USE_LANCZOS_LUT                                          (FFX_FSR2_OPTION_REPROJECT_USE_LANCZOS_TYPE == 1)
+#define FFX_FSR2_HDR_COLOR_INPUT                                                    (FFX_FSR2_OPTION_HDR_COLOR_INPUT != 0)
+#define FFX_FSR2_LOW_RESOLUTION_MOTION_VECTORS                                      (FFX_FSR2_OPTION_LOW_RESOLUTION_MOTION_VECTORS != 0)
+#define FFX_FSR2_JITTERED_MOTION_VECTORS                                            (FFX_FSR2_OPTION_JITTERED_MOTION_VECTORS != 0)
+#define FFX_FSR2_INVERTED_DEPTH                                                     (FFX_FSR2_OPTION_INVERTED_DEPTH != 0)
+#define FFX_FSR2_APPLY_SHARPENING                                                   (FFX_FSR2_OPTION_APPLY_SHARPENING != 0)
+#define FFX_FSR2_PACKED_LOCK_STATUS                                                 (FFX_FSR2_OPTION_PACKED_LOCK_STATUS != 0)
+#endif // #if FFX_FSR2_OPTION_UBER
+
+// The per-pass options only change code paths, so every build reads them from cbFSR2. The packed lock status
+// above changes the format of the history, outside the uber shaders it stays a compiled permutation.
+#define FFX_FSR2_REPROJECT_CATMULL_ROM                                              FFX_FSR2_PERMUTATION_OPTION(FFX_FSR2_PERMUTATION_OPTION_REPROJECT_CATMULL_ROM)
+#define FFX_FSR2_UPSCALED_DEPTH_OUTPUT                                              FFX_FSR2_PERMUTATION_OPTION(FFX_FSR2_PERMUTATION_OPTION_UPSCALED_DEPTH_OUTPUT)
+#define FFX_FSR2_UPSCALED_MOTION_VECTOR_OUTPUT                                      FFX_FSR2_PERMUTATION_OPTION(FFX_FSR2_PERMUTATION_OPTION_UPSCALED_MOTION_VECTOR_OUTPUT)
+#define FFX_FSR2_ALPHA_UPSCALING                                                    FFX_FSR2_PERMUTATION_OPTION(FFX_FSR2_PERMUTATION_OPTION_ALPHA_UPSCALING)
+#define FFX_FSR2_OUTPUT_ENCODING                                                    ((PermutationOptions() >> FfxUInt32(FFX_FSR2_PERMUTATION_OPTION_OUTPUT_ENCODING_SHIFT)) & FfxUInt32(3))
+#define FFX_FSR2_LENS_DISTORTION                                                    FFX_FSR2_PERMUTATION_OPTION(FFX_FSR2_PERMUTATION_OPTION_LENS_DISTORTION)
+#define FFX_FSR2_RCAS_GROUPSHARED                                                   FFX_FSR2_PERMUTATION_OPTION(FFX_FSR2_PERMUTATION_OPTION_RCAS_GROUPSHARED)
+#endif // #if defined(FFX_GPU)
+
 #endif //!defined( FFX_FSR2_RESOURCES_H )
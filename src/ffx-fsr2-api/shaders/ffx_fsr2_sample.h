@@ -594,11 +594,33 @@ FFX_MIN16_I2 ClampCoord(FFX_MIN16_I2 iPxSample, FFX_MIN16_I2 iPxOffset, FFX_MIN1
         return fColorXY;                                                                                             \
     }
 
+#if FFX_FSR2_OPTION_UBER
+// Reference or LUT Lanczos, picked by a uniform branch in the uber shaders
+FfxFloat32x4 Lanczos2Uber(FetchedBicubicSamples Samples, FfxFloat32x2 fPxFrac)
+{
+    if (FFX_FSR2_REPROJECT_USE_LANCZOS_LUT) {
+        return Lanczos2LUT(Samples, fPxFrac);
+    }
+    return Lanczos2(Samples, fPxFrac);
+}
+
+#if FFX_HALF
+FFX_MIN16_F4 Lanczos2Uber(FetchedBicubicSamplesMin16 Samples, FFX_MIN16_F2 fPxFrac)
+{
+    if (FFX_FSR2_REPROJECT_USE_LANCZOS_LUT) {
+        return Lanczos2LUT(Samples, fPxFrac);
+    }
+    return Lanczos2(Samples, fPxFrac);
+}
+#endif //FFX_HALF
+#endif //FFX_FSR2_OPTION_UBER
+
 #define FFX_FSR2_CONCAT_ID(x, y) x ## y
 #define FFX_FSR2_CONCAT(x, y) FFX_FSR2_CONCAT_ID(x, y)
 #define FFX_FSR2_SAMPLER_1D_0 Lanczos2
 #define FFX_FSR2_SAMPLER_1D_1 Lanczos2LUT
 #define FFX_FSR2_SAMPLER_1D_2 Lanczos2Approx
+#define FFX_FSR2_SAMPLER_1D_UBER Lanczos2Uber
 
 #define FFX_FSR2_GET_LANCZOS_SAMPLER1D(x) FFX_FSR2_CONCAT(FFX_FSR2_SAMPLER_1D_, x)
 
@@ -23,12 +23,63 @@
 
 #define fAutogenEpsilon 0.01f
 
+#if FFX_FSR2_OPTION_COMPACT_TCR_HISTORY
+// The compact histories only keep the luma of the previous frame, so the current frame is compared as grey of the same luma.
+FfxFloat32x3 TcrLumaOnly(FfxFloat32x3 fRgb)
+{
+    const FfxFloat32 fLuma = RGBToYCoCg(fRgb).x;
+    return FfxFloat32x3(fLuma, fLuma, fLuma);
+}
+
+FfxFloat32x3 LoadTcrOpaqueOnly(FFX_MIN16_I2 iPxPos)
+{
+    return TcrLumaOnly(LoadOpaqueOnly(iPxPos));
+}
+
+FfxFloat32x3 LoadTcrInputColor(FFX_MIN16_I2 iPxPos)
+{
+    return TcrLumaOnly(LoadInputColor(iPxPos));
+}
+
+FfxFloat32x3 LoadPrevPreAlpha(FFX_MIN16_I2 iPxPos)
+{
+    const FfxFloat32 fLuma = LoadPrevPreAlphaLuma(iPxPos);
+    return FfxFloat32x3(fLuma, fLuma, fLuma);
+}
+
+FfxFloat32x3 LoadPrevPostAlpha(FFX_MIN16_I2 iPxPos)
+{
+    const FfxFloat32 fLuma = LoadPrevPostAlphaLuma(iPxPos);
+    return FfxFloat32x3(fLuma, fLuma, fLuma);
+}
+
+void StorePrevPreAlpha(FFX_MIN16_I2 iPxPos, FFX_MIN16_F3 fColor)
+{
+    StorePrevPreAlphaLuma(iPxPos, RGBToYCoCg(FfxFloat32x3(fColor)).x);
+}
+
+void StorePrevPostAlpha(FFX_MIN16_I2 iPxPos, FFX_MIN16_F3 fColor)
+{
+    StorePrevPostAlphaLuma(iPxPos, RGBToYCoCg(FfxFloat32x3(fColor)).x);
+}
+#else
+FfxFloat32x3 LoadTcrOpaqueOnly(FFX_MIN16_I2 iPxPos)
+{
+    return LoadOpaqueOnly(iPxPos);
+}
+
+FfxFloat32x3 LoadTcrInputColor(FFX_MIN16_I2 iPxPos)
+{
+    return LoadInputColor(iPxPos);
+}
+#endif
+
 // EXPERIMENTAL
 
 FFX_MIN16_F ComputeAutoTC_01(FFX_MIN16_I2 uDispatchThreadId, FFX_MIN16_I2 iPrevIdx)
 {
-    FfxFloat32x3 colorPreAlpha = LoadOpaqueOnly(uDispatchThreadId);
-    FfxFloat32x3 colorPostAlpha = LoadInputColor(uDispatchThreadId);
+    FfxFloat32x3 colorPreAlpha = LoadTcrOpaqueOnly(uDispatchThreadId);
+    FfxFloat32x3 colorPostAlpha = LoadTcrInputColor(uDispatchThreadId);
     FfxFloat32x3 colorPrevPreAlpha = LoadPrevPreAlpha(iPrevIdx);
     FfxFloat32x3 colorPrevPostAlpha = LoadPrevPostAlpha(iPrevIdx);
 
@@ -60,8 +111,8 @@ FFX_MIN16_F ComputeAutoTC_01(FFX_MIN16_I2 uDispatchThreadId, FFX_MIN16_I2 iPrevI
 // works ok: thin edges
 FFX_MIN16_F ComputeAutoTC_02(FFX_MIN16_I2 uDispatchThreadId, FFX_MIN16_I2 iPrevIdx)
 {
-    FfxFloat32x3 colorPreAlpha = LoadOpaqueOnly(uDispatchThreadId);
-    FfxFloat32x3 colorPostAlpha = LoadInputColor(uDispatchThreadId);
+    FfxFloat32x3 colorPreAlpha = LoadTcrOpaqueOnly(uDispatchThreadId);
+    FfxFloat32x3 colorPostAlpha = LoadTcrInputColor(uDispatchThreadId);
     FfxFloat32x3 colorPrevPreAlpha = LoadPrevPreAlpha(iPrevIdx);
     FfxFloat32x3 colorPrevPostAlpha = LoadPrevPostAlpha(iPrevIdx);
 
@@ -87,7 +138,12 @@ FFX_MIN16_F ComputeAutoTC_02(FFX_MIN16_I2 uDispatchThreadId, FFX_MIN16_I2 iPrevI
 
     FfxFloat32x3 A = (hasAlpha || hadAlpha) ? NminusNA / max(FfxFloat32x3(fAutogenEpsilon, fAutogenEpsilon, fAutogenEpsilon), N) : FfxFloat32x3(0, 0, 0);
 
+#if FFX_FSR2_OPTION_COMPACT_TCR_HISTORY
+    // without chroma a darkening change has no positive component left, so the size of the luma change is used instead
+    FFX_MIN16_F retVal = FFX_MIN16_F( abs(A.x) );
+#else
     FFX_MIN16_F retVal = FFX_MIN16_F( max(max(A.x, A.y), A.z) );
+#endif
 
     // only pixels that have significantly changed in color shuold be considered
     retVal = ffxSaturate(retVal * FFX_MIN16_F(length(colorPostAlpha - colorPrevPostAlpha)) );
@@ -129,7 +185,7 @@ float computeSolidEdge(FFX_MIN16_I2 curPos, FFX_MIN16_I2 prevPos)
     {
         for (int x = -1; x < 2; ++x)
         {
-            FfxFloat32x3 curCol  = LoadOpaqueOnly(curPos + FFX_MIN16_I2(x, y)).rgb;
+            FfxFloat32x3 curCol  = LoadTcrOpaqueOnly(curPos + FFX_MIN16_I2(x, y)).rgb;
             FfxFloat32x3 prevCol = LoadPrevPreAlpha(prevPos + FFX_MIN16_I2(x, y)).rgb;
             lum[i++] = length(curCol - prevCol);
         }
@@ -154,7 +210,7 @@ float computeAlphaEdge(FFX_MIN16_I2 curPos, FFX_MIN16_I2 prevPos)
     {
         for (int x = -1; x < 2; ++x)
         {
-            FfxFloat32x3 curCol  = abs(LoadInputColor(curPos + FFX_MIN16_I2(x, y)).rgb - LoadOpaqueOnly(curPos + FFX_MIN16_I2(x, y)).rgb);
+            FfxFloat32x3 curCol  = abs(LoadTcrInputColor(curPos + FFX_MIN16_I2(x, y)).rgb - LoadTcrOpaqueOnly(curPos + FFX_MIN16_I2(x, y)).rgb);
             FfxFloat32x3 prevCol = abs(LoadPrevPostAlpha(prevPos + FFX_MIN16_I2(x, y)).rgb - LoadPrevPreAlpha(prevPos + FFX_MIN16_I2(x, y)).rgb);
             lum[i++] = length(curCol - prevCol);
         }
@@ -176,8 +232,8 @@ FFX_MIN16_F ComputeAabbOverlap(FFX_MIN16_I2 uDispatchThreadId, FFX_MIN16_I2 iPre
     FFX_MIN16_F retVal = FFX_MIN16_F(0.f);
 
     FfxFloat32x2 fMotionVector = LoadInputMotionVector(uDispatchThreadId);
-    FfxFloat32x3 colorPreAlpha = LoadOpaqueOnly(uDispatchThreadId);
-    FfxFloat32x3 colorPostAlpha = LoadInputColor(uDispatchThreadId);
+    FfxFloat32x3 colorPreAlpha = LoadTcrOpaqueOnly(uDispatchThreadId);
+    FfxFloat32x3 colorPostAlpha = LoadTcrInputColor(uDispatchThreadId);
     FfxFloat32x3 colorPrevPreAlpha = LoadPrevPreAlpha(iPrevIdx);
     FfxFloat32x3 colorPrevPostAlpha = LoadPrevPostAlpha(iPrevIdx);
 
@@ -209,7 +265,7 @@ FFX_MIN16_F ComputeAabbOverlap(FFX_MIN16_I2 uDispatchThreadId, FFX_MIN16_I2 iPre
     {
         for (int x = -1; x < 2; ++x)
         {
-            FfxFloat32x3 Y = LoadInputColor(uDispatchThreadId + FFX_MIN16_I2(x, y));
+            FfxFloat32x3 Y = LoadTcrInputColor(uDispatchThreadId + FFX_MIN16_I2(x, y));
 
 #if USE_YCOCG
             Y = RGBToYCoCg(Y);
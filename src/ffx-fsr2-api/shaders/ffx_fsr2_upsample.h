@@ -82,8 +82,17 @@ FfxFloat32 ComputeMaxKernelWeight() {
     return ffxMin(FfxFloat32(1.99f), fKernelWeight);
 }
 
+struct UpsampledAlpha
+{
+    FfxFloat32 fAlpha;
+    FfxFloat32 fMin;
+    FfxFloat32 fMax;
+};
+
 FfxFloat32x4 ComputeUpsampledColorAndWeight(const AccumulationPassCommonParams params,
-    FFX_PARAMETER_INOUT RectificationBox clippingBox, FfxFloat32 fReactiveFactor)
+    FFX_PARAMETER_INOUT RectificationBox clippingBox, FfxFloat32 fReactiveFactor
+    , FFX_PARAMETER_OUT UpsampledAlpha upsampledAlpha
+    )
 {
     #if FFX_FSR2_OPTION_UPSAMPLE_SAMPLERS_USE_DATA_HALF && FFX_HALF
     #include "ffx_fsr2_force16_begin.h"
@@ -98,6 +107,7 @@ FfxFloat32x4 ComputeUpsampledColorAndWeight(const AccumulationPassCommonParams p
     #endif
 
     FfxFloat32x3 fSamples[iLanczos2SampleCount];
+    FfxFloat32 fAlphaSamples[iLanczos2SampleCount];
 
     FfxFloat32x2 fSrcUnjitteredPos = (FfxFloat32x2(iSrcInputPos) + FfxFloat32x2(0.5f, 0.5f)) - Jitter(); // This is the un-jittered position of the sample at offset 0,0
 
@@ -127,10 +137,18 @@ FfxFloat32x4 ComputeUpsampledColorAndWeight(const AccumulationPassCommonParams p
                 const FfxInt32x2 sampleCoord = ClampLoad(iSrcSamplePos, FfxInt32x2(0, 0), FfxInt32x2(RenderSize()));
 
                 fSamples[iSampleIndex] = LoadPreparedInputColor(FfxInt32x2(sampleCoord));
+                // a branch rather than a select, so the fetch is skipped when alpha isn't upscaled
+                fAlphaSamples[iSampleIndex] = 1.0f;
+                if (FFX_FSR2_ALPHA_UPSCALING) {
+                    fAlphaSamples[iSampleIndex] = LoadInputAlpha(FfxInt32x2(sampleCoord));
+                }
             }
     }
 
     FfxFloat32x4 fColorAndWeight = FfxFloat32x4(0.0f, 0.0f, 0.0f, 0.0f);
+    FfxFloat32 fWeightedAlpha = 0.0f;
+    upsampledAlpha.fMin = fAlphaSamples[0];
+    upsampledAlpha.fMax = fAlphaSamples[0];
 
     FfxFloat32x2 fBaseSampleOffset = FfxFloat32x2(fSrcUnjitteredPos - fSrcOutputPos);
 
@@ -160,6 +178,10 @@ FfxFloat32x4 ComputeUpsampledColorAndWeight(const AccumulationPassCommonParams p
             FfxFloat32 fSampleWeight = fOnScreenFactor * FfxFloat32(GetUpsampleLanczosWeight(fSrcSampleOffset, fKernelBias));
 
             fColorAndWeight += FfxFloat32x4(fSamples[iSampleIndex] * fSampleWeight, fSampleWeight);
+            // Alpha shares the color kernel weights, its own rectification range covers the same 3x3 footprint as the color box
+            fWeightedAlpha += fAlphaSamples[iSampleIndex] * fSampleWeight;
+            upsampledAlpha.fMin = ffxMin(upsampledAlpha.fMin, fAlphaSamples[iSampleIndex]);
+            upsampledAlpha.fMax = ffxMax(upsampledAlpha.fMax, fAlphaSamples[iSampleIndex]);
 
             // Update rectification box
             {
@@ -176,9 +198,12 @@ FfxFloat32x4 ComputeUpsampledColorAndWeight(const AccumulationPassCommonParams p
 
     fColorAndWeight.w *= FfxFloat32(fColorAndWeight.w > FSR2_EPSILON);
 
+    upsampledAlpha.fAlpha = 0.0f;
+
     if (fColorAndWeight.w > FSR2_EPSILON) {
         // Normalize for deringing (we need to compare colors)
         fColorAndWeight.xyz = fColorAndWeight.xyz / fColorAndWeight.w;
+        upsampledAlpha.fAlpha = clamp(fWeightedAlpha / fColorAndWeight.w, upsampledAlpha.fMin, upsampledAlpha.fMax);
         fColorAndWeight.w *= fUpsampleLanczosWeightScale;
 
         Deringing(clippingBox, fColorAndWeight.xyz);
@@ -93,6 +93,9 @@ FfxFloat32x4 SpdReduce4(FfxFloat32x4 v0, FfxFloat32x4 v1, FfxFloat32x4 v2, FfxFl
 //_____________________________________________________________/\_______________________________________________________________
 #if defined(FFX_GLSL) && !defined(SPD_NO_WAVE_OPERATIONS)
 #extension GL_KHR_shader_subgroup_quad:require
+#if defined(SPD_SUBGROUP_SHUFFLE)
+#extension GL_KHR_shader_subgroup_shuffle:require
+#endif
 #endif
 
 void SpdWorkgroupShuffleBarrier()
@@ -438,6 +441,51 @@ void SpdDownsampleMip_5(FfxUInt32x2 workGroupID, FfxUInt32 localInvocationIndex,
 #endif
 }
 
+#if defined(FFX_GLSL) && !defined(SPD_NO_WAVE_OPERATIONS) && defined(SPD_SUBGROUP_SHUFFLE)
+// Lane holding the quad result which the next mip would load from LDS at this lane's remapped position.
+FfxUInt32 SpdSubgroupShuffleSourceLane(FfxUInt32 localInvocationIndex)
+{
+    FfxUInt32 lane = localInvocationIndex & 0xF;
+    return ((lane & 0x5) << 3) | ((lane & 0xA) << 1);
+}
+
+// Mips 3, 4 and 5 are only reduced by the first 64 invocations. When the subgroup size is at least 64
+// these form a single subgroup, so the results of mip 3 and 4 are passed on by shuffles instead of
+// going through LDS, which removes two barriers. Requires a subgroup size of at least 64.
+void SpdDownsampleMips_3_4_5_Subgroup(FfxUInt32 x, FfxUInt32 y, FfxUInt32x2 workGroupID, FfxUInt32 localInvocationIndex, FfxUInt32 mip, FfxUInt32 mips, FfxUInt32 slice)
+{
+    if (localInvocationIndex < 64)
+    {
+        FfxFloat32x4 v = SpdLoadIntermediate(x * 2 + y % 2, y * 2);
+        v        = SpdReduceQuad(v);
+        // quad index 0 stores result
+        if (localInvocationIndex % 4 == 0)
+        {
+            SpdStore(FfxInt32x2(workGroupID.xy * 4) + FfxInt32x2(x / 2, y / 2), v, mip, slice);
+        }
+
+        if (mips <= mip + 1)
+            return;
+        // every lane takes part in the shuffle, only the first 16 produce mip 4
+        v = subgroupShuffle(v, SpdSubgroupShuffleSourceLane(localInvocationIndex));
+        v = SpdReduceQuad(v);
+        if (localInvocationIndex < 16 && localInvocationIndex % 4 == 0)
+        {
+            SpdStore(FfxInt32x2(workGroupID.xy * 2) + FfxInt32x2(x / 2, y / 2), v, mip + 1, slice);
+        }
+
+        if (mips <= mip + 2)
+            return;
+        v = subgroupShuffle(v, SpdSubgroupShuffleSourceLane(localInvocationIndex));
+        v = SpdReduceQuad(v);
+        if (localInvocationIndex == 0)
+        {
+            SpdStore(FfxInt32x2(workGroupID.xy), v, mip + 2, slice);
+        }
+    }
+}
+#endif
+
 void SpdDownsampleMips_6_7(FfxUInt32 x, FfxUInt32 y, FfxUInt32 mips, FfxUInt32 slice)
 {
     FfxInt32x2   tex = FfxInt32x2(x * 4 + 0, y * 4 + 0);
@@ -479,6 +527,9 @@ void SpdDownsampleNextFour(FfxUInt32 x, FfxUInt32 y, FfxUInt32x2 workGroupID, Ff
     if (mips <= baseMip + 1)
         return;
     SpdWorkgroupShuffleBarrier();
+#if defined(FFX_GLSL) && !defined(SPD_NO_WAVE_OPERATIONS) && defined(SPD_SUBGROUP_SHUFFLE)
+    SpdDownsampleMips_3_4_5_Subgroup(x, y, workGroupID, localInvocationIndex, baseMip + 1, mips, slice);
+#else
     SpdDownsampleMip_3(x, y, workGroupID, localInvocationIndex, baseMip + 1, slice);
 
     if (mips <= baseMip + 2)
@@ -490,6 +541,7 @@ void SpdDownsampleNextFour(FfxUInt32 x, FfxUInt32 y, FfxUInt32x2 workGroupID, Ff
         return;
     SpdWorkgroupShuffleBarrier();
     SpdDownsampleMip_5(workGroupID, localInvocationIndex, baseMip + 3, slice);
+#endif
 }
 
 void SpdDownsample(FfxUInt32x2 workGroupID, FfxUInt32 localInvocationIndex, FfxUInt32 mips, FfxUInt32 numWorkGroups, FfxUInt32 slice)
@@ -528,18 +528,26 @@ VkDescriptorBufferInfo accquireDynamicUBO(BackendContext_VK* backendContext, uin
     return bufferInfo;
 }
 
-static uint32_t getDefaultSubgroupSize(const BackendContext_VK* backendContext)
+// VkPhysicalDeviceVulkan11Properties may only be chained on Vulkan 1.2 devices, the subgroup properties are core in 1.1
+static VkPhysicalDeviceSubgroupProperties getSubgroupProperties(const BackendContext_VK* backendContext)
 {
-    VkPhysicalDeviceVulkan11Properties vulkan11Properties = {};
-    vulkan11Properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_PROPERTIES;
+    VkPhysicalDeviceSubgroupProperties subgroupProperties = {};
+    subgroupProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES;
 
     VkPhysicalDeviceProperties2 deviceProperties2 = {};
     deviceProperties2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
-    deviceProperties2.pNext = &vulkan11Properties;
+    deviceProperties2.pNext = &subgroupProperties;
     backendContext->vkFunctionTable.vkGetPhysicalDeviceProperties2(backendContext->physicalDevice, &deviceProperties2);
-    FFX_ASSERT(vulkan11Properties.subgroupSize == 32 || vulkan11Properties.subgroupSize == 64); // current desktop market
 
-    return vulkan11Properties.subgroupSize;
+    return subgroupProperties;
+}
+
+static uint32_t getDefaultSubgroupSize(const BackendContext_VK* backendContext)
+{
+    const VkPhysicalDeviceSubgroupProperties subgroupProperties = getSubgroupProperties(backendContext);
+    FFX_ASSERT(subgroupProperties.subgroupSize == 32 || subgroupProperties.subgroupSize == 64); // current desktop market
+
+    return subgroupProperties.subgroupSize;
 }
 
 // Create a FfxFsr2Device from a VkDevice
@@ -737,8 +745,14 @@ FfxErrorCode GetDeviceCapabilitiesVK(FfxFsr2Interface* backendInterface, FfxDevi
     deviceCapabilities->waveLaneCountMin = defaultSubgroupSize;
     deviceCapabilities->waveLaneCountMax = defaultSubgroupSize;
     deviceCapabilities->fp16Supported = false;
+    deviceCapabilities->waveLaneShuffleSupported = false;
     deviceCapabilities->raytracingSupported = false;
 
+    // check if subgroup shuffles are available in compute shaders
+    const VkPhysicalDeviceSubgroupProperties subgroupProperties = getSubgroupProperties(backendContext);
+    deviceCapabilities->waveLaneShuffleSupported = (subgroupProperties.supportedStages & VK_SHADER_STAGE_COMPUTE_BIT) &&
+                                                   (subgroupProperties.supportedOperations & VK_SUBGROUP_FEATURE_SHUFFLE_BIT);
+
     // check if extensions are enabled
 
     for (uint32_t i = 0; i < backendContext->numDeviceExtensions; i++)
@@ -1318,14 +1332,31 @@ FfxErrorCode CreatePipelineVK(FfxFsr2Interface* backendInterface, FfxFsr2Pass pa
             supportedFP16 = false;
     }
 
+    // the subgroup shuffle SPD path needs the first 64 invocations of the luminance pyramid to share a subgroup.
+    const bool useSpdSubgroupShuffle = deviceCapabilities.waveLaneShuffleSupported && (defaultSubgroupSize >= 64 || canForceWave64);
+
     // work out what permutation to load.
     uint32_t flags = 0;
     flags |= (pipelineDescription->contextFlags & FFX_FSR2_ENABLE_HIGH_DYNAMIC_RANGE) ? FSR2_SHADER_PERMUTATION_HDR_COLOR_INPUT : 0;
     flags |= (pipelineDescription->contextFlags & FFX_FSR2_ENABLE_DISPLAY_RESOLUTION_MOTION_VECTORS) ? 0 : FSR2_SHADER_PERMUTATION_LOW_RES_MOTION_VECTORS;
     flags |= (pipelineDescription->contextFlags & FFX_FSR2_ENABLE_MOTION_VECTORS_JITTER_CANCELLATION) ? FSR2_SHADER_PERMUTATION_JITTER_MOTION_VECTORS : 0;
     flags |= (pipelineDescription->contextFlags & FFX_FSR2_ENABLE_DEPTH_INVERTED) ? FSR2_SHADER_PERMUTATION_DEPTH_INVERTED : 0;
+    flags |= ((pipelineDescription->motionVectorDilationMode & 1) && (pass == FFX_FSR2_PASS_RECONSTRUCT_PREVIOUS_DEPTH)) ? FSR2_SHADER_PERMUTATION_MOTION_VECTOR_DILATION_0 : 0;
+    flags |= ((pipelineDescription->motionVectorDilationMode & 2) && (pass == FFX_FSR2_PASS_RECONSTRUCT_PREVIOUS_DEPTH)) ? FSR2_SHADER_PERMUTATION_MOTION_VECTOR_DILATION_1 : 0;
     flags |= (pass == FFX_FSR2_PASS_ACCUMULATE_SHARPEN) ? FSR2_SHADER_PERMUTATION_ENABLE_SHARPENING : 0;
     flags |= (useLut) ? FSR2_SHADER_PERMUTATION_REPROJECT_USE_LANCZOS_TYPE : 0;
+    flags |= (useSpdSubgroupShuffle && (pass == FFX_FSR2_PASS_COMPUTE_LUMINANCE_PYRAMID)) ? FSR2_SHADER_PERMUTATION_SPD_SUBGROUP_SHUFFLE : 0;
+    flags |= ((pipelineDescription->contextFlags & FFX_FSR2_ENABLE_COMPACT_TCR_HISTORY) && (pass == FFX_FSR2_PASS_TCR_AUTOGENERATE)) ? FSR2_SHADER_PERMUTATION_COMPACT_TCR_HISTORY : 0;
+    flags |= ((pipelineDescription->contextFlags & FFX_FSR2_ENABLE_CATMULL_ROM_REPROJECTION) && (pass == FFX_FSR2_PASS_ACCUMULATE || pass == FFX_FSR2_PASS_ACCUMULATE_SHARPEN)) ? FSR2_SHADER_PERMUTATION_REPROJECT_CATMULL_ROM : 0;
+    flags |= ((pipelineDescription->contextFlags & FFX_FSR2_ENABLE_PACKED_LOCK_STATUS) && (pass == FFX_FSR2_PASS_ACCUMULATE || pass == FFX_FSR2_PASS_ACCUMULATE_SHARPEN || pass == FFX_FSR2_PASS_RCAS)) ? FSR2_SHADER_PERMUTATION_PACKED_LOCK_STATUS : 0;
+    flags |= ((pipelineDescription->contextFlags & FFX_FSR2_ENABLE_DISPLAY_RESOLUTION_DEPTH_OUTPUT) && (pass == FFX_FSR2_PASS_ACCUMULATE || pass == FFX_FSR2_PASS_ACCUMULATE_SHARPEN)) ? FSR2_SHADER_PERMUTATION_UPSCALED_DEPTH_OUTPUT : 0;
+    flags |= ((pipelineDescription->contextFlags & FFX_FSR2_ENABLE_DISPLAY_RESOLUTION_MOTION_VECTOR_OUTPUT) && (pass == FFX_FSR2_PASS_ACCUMULATE || pass == FFX_FSR2_PASS_ACCUMULATE_SHARPEN)) ? FSR2_SHADER_PERMUTATION_UPSCALED_MOTION_VECTOR_OUTPUT : 0;
+    flags |= ((pipelineDescription->contextFlags & FFX_FSR2_ENABLE_ALPHA_UPSCALING) && (pass == FFX_FSR2_PASS_ACCUMULATE || pass == FFX_FSR2_PASS_ACCUMULATE_SHARPEN || pass == FFX_FSR2_PASS_RCAS)) ? FSR2_SHADER_PERMUTATION_ALPHA_UPSCALING : 0;
+    flags |= ((pipelineDescription->outputEncoding & 1) && (pass == FFX_FSR2_PASS_ACCUMULATE || pass == FFX_FSR2_PASS_RCAS)) ? FSR2_SHADER_PERMUTATION_OUTPUT_ENCODING_0 : 0;
+    flags |= ((pipelineDescription->outputEncoding & 2) && (pass == FFX_FSR2_PASS_ACCUMULATE || pass == FFX_FSR2_PASS_RCAS)) ? FSR2_SHADER_PERMUTATION_OUTPUT_ENCODING_1 : 0;
+    flags |= ((pipelineDescription->contextFlags & FFX_FSR2_ENABLE_LENS_DISTORTION) && (pass == FFX_FSR2_PASS_RCAS)) ? FSR2_SHADER_PERMUTATION_LENS_DISTORTION : 0;
+    flags |= ((pipelineDescription->contextFlags & FFX_FSR2_ENABLE_MATERIAL_ID_REACTIVITY) && (pass == FFX_FSR2_PASS_DEPTH_CLIP)) ? FSR2_SHADER_PERMUTATION_MATERIAL_ID_REACTIVITY : 0;
+    flags |= ((pipelineDescription->contextFlags & FFX_FSR2_ENABLE_GROUPSHARED_RCAS) && (pass == FFX_FSR2_PASS_RCAS)) ? FSR2_SHADER_PERMUTATION_RCAS_GROUPSHARED : 0;
     flags |= (canForceWave64) ? FSR2_SHADER_PERMUTATION_FORCE_WAVE64 : 0;
     flags |= (supportedFP16 && (pass != FFX_FSR2_PASS_RCAS)) ? FSR2_SHADER_PERMUTATION_ALLOW_FP16 : 0;
 
@@ -1337,6 +1368,24 @@ FfxErrorCode CreatePipelineVK(FfxFsr2Interface* backendInterface, FfxFsr2Pass pa
     outPipeline->uavCount = shaderBlob.storageImageCount;
     outPipeline->constCount = shaderBlob.uniformBufferCount;
 
+    // the same switches, read at runtime by the uber shaders and, for the per-pass options, by every build
+    outPipeline->permutationOptions = 0;
+    outPipeline->permutationOptions |= (flags & FSR2_SHADER_PERMUTATION_REPROJECT_USE_LANCZOS_TYPE) ? FFX_FSR2_PERMUTATION_OPTION_REPROJECT_USE_LANCZOS_LUT : 0;
+    outPipeline->permutationOptions |= (flags & FSR2_SHADER_PERMUTATION_HDR_COLOR_INPUT) ? FFX_FSR2_PERMUTATION_OPTION_HDR_COLOR_INPUT : 0;
+    outPipeline->permutationOptions |= (flags & FSR2_SHADER_PERMUTATION_LOW_RES_MOTION_VECTORS) ? FFX_FSR2_PERMUTATION_OPTION_LOW_RESOLUTION_MOTION_VECTORS : 0;
+    outPipeline->permutationOptions |= (flags & FSR2_SHADER_PERMUTATION_JITTER_MOTION_VECTORS) ? FFX_FSR2_PERMUTATION_OPTION_JITTERED_MOTION_VECTORS : 0;
+    outPipeline->permutationOptions |= (flags & FSR2_SHADER_PERMUTATION_DEPTH_INVERTED) ? FFX_FSR2_PERMUTATION_OPTION_INVERTED_DEPTH : 0;
+    outPipeline->permutationOptions |= (flags & FSR2_SHADER_PERMUTATION_ENABLE_SHARPENING) ? FFX_FSR2_PERMUTATION_OPTION_APPLY_SHARPENING : 0;
+    outPipeline->permutationOptions |= (flags & FSR2_SHADER_PERMUTATION_REPROJECT_CATMULL_ROM) ? FFX_FSR2_PERMUTATION_OPTION_REPROJECT_CATMULL_ROM : 0;
+    outPipeline->permutationOptions |= (flags & FSR2_SHADER_PERMUTATION_PACKED_LOCK_STATUS) ? FFX_FSR2_PERMUTATION_OPTION_PACKED_LOCK_STATUS : 0;
+    outPipeline->permutationOptions |= (flags & FSR2_SHADER_PERMUTATION_UPSCALED_DEPTH_OUTPUT) ? FFX_FSR2_PERMUTATION_OPTION_UPSCALED_DEPTH_OUTPUT : 0;
+    outPipeline->permutationOptions |= (flags & FSR2_SHADER_PERMUTATION_UPSCALED_MOTION_VECTOR_OUTPUT) ? FFX_FSR2_PERMUTATION_OPTION_UPSCALED_MOTION_VECTOR_OUTPUT : 0;
+    outPipeline->permutationOptions |= (flags & FSR2_SHADER_PERMUTATION_ALPHA_UPSCALING) ? FFX_FSR2_PERMUTATION_OPTION_ALPHA_UPSCALING : 0;
+    outPipeline->permutationOptions |= (flags & FSR2_SHADER_PERMUTATION_OUTPUT_ENCODING_0) ? (1 << FFX_FSR2_PERMUTATION_OPTION_OUTPUT_ENCODING_SHIFT) : 0;
+    outPipeline->permutationOptions |= (flags & FSR2_SHADER_PERMUTATION_OUTPUT_ENCODING_1) ? (2 << FFX_FSR2_PERMUTATION_OPTION_OUTPUT_ENCODING_SHIFT) : 0;
+    outPipeline->permutationOptions |= (flags & FSR2_SHADER_PERMUTATION_LENS_DISTORTION) ? FFX_FSR2_PERMUTATION_OPTION_LENS_DISTORTION : 0;
+    outPipeline->permutationOptions |= (flags & FSR2_SHADER_PERMUTATION_RCAS_GROUPSHARED) ? FFX_FSR2_PERMUTATION_OPTION_RCAS_GROUPSHARED : 0;
+
     FFX_ASSERT(shaderBlob.storageImageCount < FFX_MAX_NUM_UAVS);
     FFX_ASSERT(shaderBlob.sampledImageCount < FFX_MAX_NUM_SRVS);
     std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
@@ -33,6 +33,12 @@
 #if defined(POPULATE_PERMUTATION_KEY)
 #undef POPULATE_PERMUTATION_KEY
 #endif // #if defined(POPULATE_PERMUTATION_KEY)
+#if defined(FFX_FSR2_UBER_SHADERS)
+// the remaining switches are read from cbFSR2 at runtime, see FfxPipelineState::permutationOptions
+#define POPULATE_PERMUTATION_KEY(options, key)                                                                \
+key.index = 0;                                                                                                \
+key.FFX_HALF = FFX_CONTAINS_FLAG(options, FSR2_SHADER_PERMUTATION_ALLOW_FP16);
+#else
 #define POPULATE_PERMUTATION_KEY(options, key)                                                                \
 key.index = 0;                                                                                                \
 key.FFX_FSR2_OPTION_REPROJECT_USE_LANCZOS_TYPE = FFX_CONTAINS_FLAG(options, FSR2_SHADER_PERMUTATION_REPROJECT_USE_LANCZOS_TYPE);                     \
@@ -42,6 +48,7 @@ key.FFX_FSR2_OPTION_JITTERED_MOTION_VECTORS = FFX_CONTAINS_FLAG(options, FSR2_SH
 key.FFX_FSR2_OPTION_INVERTED_DEPTH = FFX_CONTAINS_FLAG(options, FSR2_SHADER_PERMUTATION_DEPTH_INVERTED);                   \
 key.FFX_FSR2_OPTION_APPLY_SHARPENING = FFX_CONTAINS_FLAG(options, FSR2_SHADER_PERMUTATION_ENABLE_SHARPENING);                 \
 key.FFX_HALF = FFX_CONTAINS_FLAG(options, FSR2_SHADER_PERMUTATION_ALLOW_FP16);
+#endif // #if defined(FFX_FSR2_UBER_SHADERS)
 
 #if defined(POPULATE_SHADER_BLOB)
 #undef POPULATE_SHADER_BLOB
@@ -53,6 +60,7 @@ Fsr2ShaderBlobVK fsr2GetDepthClipPassPermutationBlobByIndex(uint32_t permutation
     ffx_fsr2_depth_clip_pass_PermutationKey key;
 
     POPULATE_PERMUTATION_KEY(permutationOptions, key);
+    key.FFX_FSR2_OPTION_MATERIAL_ID_REACTIVITY = FFX_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_MATERIAL_ID_REACTIVITY);
 
     const int32_t tableIndex = g_ffx_fsr2_depth_clip_pass_IndirectionTable[key.index];
     return POPULATE_SHADER_BLOB(g_ffx_fsr2_depth_clip_pass_PermutationInfo, tableIndex);
@@ -63,6 +71,7 @@ Fsr2ShaderBlobVK fsr2GetReconstructPreviousDepthPassPermutationBlobByIndex(uint3
     ffx_fsr2_reconstruct_previous_depth_pass_PermutationKey key;
 
     POPULATE_PERMUTATION_KEY(permutationOptions, key);
+    key.FFX_FSR2_OPTION_MOTION_VECTOR_DILATION = FFX_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_MOTION_VECTOR_DILATION_0) | (FFX_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_MOTION_VECTOR_DILATION_1) << 1);
 
     const int32_t tableIndex = g_ffx_fsr2_reconstruct_previous_depth_pass_IndirectionTable[key.index];
     return POPULATE_SHADER_BLOB(g_ffx_fsr2_reconstruct_previous_depth_pass_PermutationInfo, tableIndex);
@@ -83,6 +92,9 @@ Fsr2ShaderBlobVK fsr2GetAccumulatePassPermutationBlobByIndex(uint32_t permutatio
     ffx_fsr2_accumulate_pass_PermutationKey key;
 
     POPULATE_PERMUTATION_KEY(permutationOptions, key);
+#if !defined(FFX_FSR2_UBER_SHADERS)
+    key.FFX_FSR2_OPTION_PACKED_LOCK_STATUS = FFX_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_PACKED_LOCK_STATUS);
+#endif // #if !defined(FFX_FSR2_UBER_SHADERS)
 
     const int32_t tableIndex = g_ffx_fsr2_accumulate_pass_IndirectionTable[key.index];
     return POPULATE_SHADER_BLOB(g_ffx_fsr2_accumulate_pass_PermutationInfo, tableIndex);
@@ -93,6 +105,9 @@ Fsr2ShaderBlobVK fsr2GetRCASPassPermutationBlobByIndex(uint32_t permutationOptio
     ffx_fsr2_rcas_pass_PermutationKey key;
 
     POPULATE_PERMUTATION_KEY(permutationOptions, key);
+#if !defined(FFX_FSR2_UBER_SHADERS)
+    key.FFX_FSR2_OPTION_PACKED_LOCK_STATUS = FFX_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_PACKED_LOCK_STATUS);
+#endif // #if !defined(FFX_FSR2_UBER_SHADERS)
 
     const int32_t tableIndex = g_ffx_fsr2_rcas_pass_IndirectionTable[key.index];
     return POPULATE_SHADER_BLOB(g_ffx_fsr2_rcas_pass_PermutationInfo, tableIndex);
@@ -103,12 +118,15 @@ Fsr2ShaderBlobVK fsr2GetComputeLuminancePyramidPassPermutationBlobByIndex(uint32
     ffx_fsr2_compute_luminance_pyramid_pass_PermutationKey key;
 
     key.index = 0;                                                                                                
+#if !defined(FFX_FSR2_UBER_SHADERS)
     key.FFX_FSR2_OPTION_REPROJECT_USE_LANCZOS_TYPE = FFX_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_REPROJECT_USE_LANCZOS_TYPE);
     key.FFX_FSR2_OPTION_HDR_COLOR_INPUT = FFX_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_HDR_COLOR_INPUT);
     key.FFX_FSR2_OPTION_LOW_RESOLUTION_MOTION_VECTORS = FFX_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_LOW_RES_MOTION_VECTORS);
     key.FFX_FSR2_OPTION_JITTERED_MOTION_VECTORS = FFX_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_JITTER_MOTION_VECTORS);
     key.FFX_FSR2_OPTION_INVERTED_DEPTH = FFX_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_DEPTH_INVERTED);
     key.FFX_FSR2_OPTION_APPLY_SHARPENING = FFX_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_ENABLE_SHARPENING);
+#endif
+    key.FFX_FSR2_OPTION_SPD_SUBGROUP_SHUFFLE = FFX_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_SPD_SUBGROUP_SHUFFLE);
 
     const int32_t tableIndex = g_ffx_fsr2_compute_luminance_pyramid_pass_IndirectionTable[key.index];
     return POPULATE_SHADER_BLOB(g_ffx_fsr2_compute_luminance_pyramid_pass_PermutationInfo, tableIndex);
@@ -129,6 +147,7 @@ Fsr2ShaderBlobVK fsr2GetTcrAutogeneratePassPermutationBlobByIndex(uint32_t permu
     ffx_fsr2_tcr_autogen_pass_PermutationKey key;
 
     POPULATE_PERMUTATION_KEY(permutationOptions, key);
+    key.FFX_FSR2_OPTION_COMPACT_TCR_HISTORY = FFX_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_COMPACT_TCR_HISTORY);
 
     const int32_t tableIndex = g_ffx_fsr2_tcr_autogen_pass_IndirectionTable[key.index];
     return POPULATE_SHADER_BLOB(g_ffx_fsr2_tcr_autogen_pass_PermutationInfo, tableIndex);
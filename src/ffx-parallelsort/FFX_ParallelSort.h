@@ -34,7 +34,26 @@
 //	NumScanValues						How many values to perform scan prefix (+ add) on
 //////////////////////////////////////////////////////////////////////////
 
+//////////////////////////////////////////////////////////////////////////
+// Segmented sorting:
+//
+//	Several independent key ranges (e.g. one per emitter) can be sorted by the same set of dispatches
+//	by storing the segment ID in the top SegmentBits bits of each key (see FFX_ParallelSort_MakeSegmentedKey),
+//	where the segment ID is either read per element or found from a segment offsets buffer
+//	(see FFX_ParallelSort_SegmentFromOffsets). Every pass is a stable LSD radix pass, so after all 32 bits
+//	the keys are grouped by ascending segment and each segment is sorted by its remaining low bits.
+//	FFX_ParallelSort_SegmentHeads_uint then writes the sorted index of the first key of every segment
+//	(1 << SegmentBits entries, plus a final entry holding NumKeys), so segment s occupies
+//	[SegmentHeads[s], SegmentHeads[s + 1]) and can be drawn indirectly on its own.
+//	The DX12 and Vulkan FFXParallelSort wrappers of the sample take the heads buffer as an optional argument
+//	of OnCreate. The GPU particle system sorts all particles as one segment and draws them in one call, so it
+//	does not pass one.
+//////////////////////////////////////////////////////////////////////////
+
 #ifdef FFX_CPP
+	#include <algorithm>
+	#include <vector>
+
 	struct FFX_ParallelSortCB
 	{
 		uint32_t NumKeys;
@@ -83,6 +102,68 @@
 		ConstantBuffer.NumScanValues = NumReducedThreadGroupsToRun;	// The number of reduce thread groups becomes our scan count (as each thread group writes out 1 value that needs scan prefix)
 	}
 
+	// A SegmentBits of 0 is an unsegmented sort, the key is kept whole and every key is in segment 0
+	uint32_t FFX_ParallelSort_MakeSegmentedKey(uint32_t SegmentID, uint32_t Key, uint32_t SegmentBits)
+	{
+		if (SegmentBits == 0)
+			return Key;
+
+		// Keep the most significant bits of the key below the segment ID
+		return (SegmentID << (32 - SegmentBits)) | (Key >> SegmentBits);
+	}
+
+	uint32_t FFX_ParallelSort_SegmentOfKey(uint32_t Key, uint32_t SegmentBits)
+	{
+		return (SegmentBits == 0) ? 0 : (Key >> (32 - SegmentBits));
+	}
+
+	// CPU reference for a segmented sort with the same 4 bit LSD passes as the GPU path. SrcKeys must already be segmented
+	// keys, DstKeys/DstPayload receive the sorted result and SegmentHeads needs (1 << SegmentBits) + 1 entries.
+	void FFX_ParallelSort_SegmentedSortReference(uint32_t NumKeys, uint32_t SegmentBits, const uint32_t* SrcKeys, const uint32_t* SrcPayload,
+												 uint32_t* DstKeys, uint32_t* DstPayload, uint32_t* SegmentHeads)
+	{
+		std::vector<uint32_t> Keys(SrcKeys, SrcKeys + NumKeys), Payload(SrcPayload, SrcPayload + NumKeys);
+		std::vector<uint32_t> ScratchKeys(NumKeys), ScratchPayload(NumKeys);
+
+		for (uint32_t Shift = 0; Shift < 32u; Shift += FFX_PARALLELSORT_SORT_BITS_PER_PASS)
+		{
+			uint32_t BinOffsets[FFX_PARALLELSORT_SORT_BIN_COUNT] = {};
+			for (uint32_t i = 0; i < NumKeys; i++)
+				BinOffsets[(Keys[i] >> Shift) & (FFX_PARALLELSORT_SORT_BIN_COUNT - 1)]++;
+
+			uint32_t BinStart = 0;
+			for (uint32_t Bin = 0; Bin < FFX_PARALLELSORT_SORT_BIN_COUNT; Bin++)
+			{
+				uint32_t BinCount = BinOffsets[Bin];
+				BinOffsets[Bin] = BinStart;
+				BinStart += BinCount;
+			}
+
+			for (uint32_t i = 0; i < NumKeys; i++)
+			{
+				uint32_t Dst = BinOffsets[(Keys[i] >> Shift) & (FFX_PARALLELSORT_SORT_BIN_COUNT - 1)]++;
+				ScratchKeys[Dst] = Keys[i];
+				ScratchPayload[Dst] = Payload[i];
+			}
+
+			Keys.swap(ScratchKeys);
+			Payload.swap(ScratchPayload);
+		}
+
+		std::copy(Keys.begin(), Keys.end(), DstKeys);
+		std::copy(Payload.begin(), Payload.end(), DstPayload);
+
+		// Same per key boundary walk as FFX_ParallelSort_SegmentHeads_uint
+		uint32_t NumSegments = 1u << SegmentBits;
+		for (uint32_t KeyIndex = 0; KeyIndex <= NumKeys; KeyIndex++)
+		{
+			uint32_t FirstSegment = (KeyIndex == 0) ? 0 : FFX_ParallelSort_SegmentOfKey(Keys[KeyIndex - 1], SegmentBits) + 1;
+			uint32_t LastSegment = (KeyIndex == NumKeys) ? NumSegments : FFX_ParallelSort_SegmentOfKey(Keys[KeyIndex], SegmentBits);
+			for (uint32_t Segment = FirstSegment; Segment <= LastSegment; Segment++)
+				SegmentHeads[Segment] = KeyIndex;
+		}
+	}
+
 	// We are using some optimizations to hide buffer load latency, so make sure anyone changing this define is made aware of that fact.
 	static_assert(FFX_PARALLELSORT_ELEMENTS_PER_THREAD == 4, "FFX_ParallelSort Shaders currently explicitly rely on FFX_PARALLELSORT_ELEMENTS_PER_THREAD being set to 4 in order to optimize buffer loads. Please adjust the optimization to factor in the new define value.");
 #elif defined(FFX_HLSL)
@@ -473,6 +554,53 @@
 		}
 	}
 
+	// A SegmentBits of 0 is an unsegmented sort, the key is kept whole and every key is in segment 0
+	uint FFX_ParallelSort_MakeSegmentedKey(uint SegmentID, uint Key, uint SegmentBits)
+	{
+		if (SegmentBits == 0)
+			return Key;
+
+		// Keep the most significant bits of the key below the segment ID
+		return (SegmentID << (32 - SegmentBits)) | (Key >> SegmentBits);
+	}
+
+	uint FFX_ParallelSort_SegmentOfKey(uint Key, uint SegmentBits)
+	{
+		return (SegmentBits == 0) ? 0 : (Key >> (32 - SegmentBits));
+	}
+
+	// Finds the segment of an element from a buffer of NumSegments + 1 ascending start offsets
+	uint FFX_ParallelSort_SegmentFromOffsets(uint ElementIndex, uint NumSegments, StructuredBuffer<uint> SegmentOffsets)
+	{
+		uint First = 0;
+		uint Count = NumSegments;
+		while (Count > 0)
+		{
+			uint Step = Count / 2;
+			if (SegmentOffsets[First + Step + 1] <= ElementIndex)
+			{
+				First += Step + 1;
+				Count -= Step + 1;
+			}
+			else
+				Count = Step;
+		}
+		return First;
+	}
+
+	// One thread per sorted key plus one for the end of the list. Each thread writes the heads of the segments that start
+	// between the previous key and its own, so empty segments get a zero length range.
+	void FFX_ParallelSort_SegmentHeads_uint(uint KeyIndex, uint NumKeys, uint SegmentBits, RWStructuredBuffer<uint> SortedKeys, RWStructuredBuffer<uint> SegmentHeads)
+	{
+		if (KeyIndex > NumKeys)
+			return;
+
+		uint FirstSegment = (KeyIndex == 0) ? 0 : FFX_ParallelSort_SegmentOfKey(SortedKeys[KeyIndex - 1], SegmentBits) + 1;
+		uint LastSegment = (KeyIndex == NumKeys) ? (1u << SegmentBits) : FFX_ParallelSort_SegmentOfKey(SortedKeys[KeyIndex], SegmentBits);
+		for (uint Segment = FirstSegment; Segment <= LastSegment; Segment++)
+			SegmentHeads[Segment] = KeyIndex;
+	}
+
 	void FFX_ParallelSort_SetupIndirectParams(uint NumKeys, uint MaxThreadGroups, RWStructuredBuffer<FFX_ParallelSortCB> CBuffer, RWStructuredBuffer<uint> CountScatterArgs, RWStructuredBuffer<uint> ReduceScanArgs)
 	{
 		CBuffer[0].NumKeys = NumKeys;